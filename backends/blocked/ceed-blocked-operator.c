@@ -25,7 +25,7 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf,
     CeedVector *fullevecs, CeedVector *evecs,
     CeedVector *qvecs, CeedInt starte,
     CeedInt numfields, CeedInt Q) {
-  CeedInt dim, ierr, ncomp, size, P;
+  CeedInt dim, ierr, size, P;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
   CeedBasis basis;
@@ -53,34 +53,8 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf,
     if (emode != CEED_EVAL_WEIGHT) {
       ierr = CeedOperatorFieldGetElemRestriction(opfields[i], &r);
       CeedChk(ierr);
-      ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChk(ierr);
-      CeedInt nelem, elemsize, lsize, compstride;
-      ierr = CeedElemRestrictionGetNumElements(r, &nelem); CeedChk(ierr);
-      ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
-      ierr = CeedElemRestrictionGetLVectorSize(r, &lsize); CeedChk(ierr);
-      ierr = CeedElemRestrictionGetNumComponents(r, &ncomp); CeedChk(ierr);
-
-      bool strided;
-      ierr = CeedElemRestrictionIsStrided(r, &strided); CeedChk(ierr);
-      if (strided) {
-        CeedInt strides[3];
-        ierr = CeedElemRestrictionGetStrides(r, &strides); CeedChk(ierr);
-        ierr = CeedElemRestrictionCreateBlockedStrided(ceed, nelem, elemsize,
-               blksize, ncomp, lsize, strides, &blkrestr[i+starte]);
-        CeedChk(ierr);
-      } else {
-        const CeedInt *offsets = NULL;
-        ierr = CeedElemRestrictionGetOffsets(r, CEED_MEM_HOST, &offsets);
-        CeedChk(ierr);
-        ierr = CeedElemRestrictionGetCompStride(r, &compstride); CeedChk(ierr);
-        ierr = CeedElemRestrictionCreateBlocked(ceed, nelem, elemsize,
-                                                blksize, ncomp, compstride,
-                                                lsize, CEED_MEM_HOST,
-                                                CEED_COPY_VALUES, offsets,
-                                                &blkrestr[i+starte]);
-        CeedChk(ierr);
-        ierr = CeedElemRestrictionRestoreOffsets(r, &offsets); CeedChk(ierr);
-      }
+      ierr = CeedElemRestrictionGetBlocked(r, blksize, &blkrestr[i+starte]);
+      CeedChk(ierr);
       ierr = CeedElemRestrictionCreateVector(blkrestr[i+starte], NULL,
                                              &fullevecs[i+starte]);
       CeedChk(ierr);
@@ -124,6 +98,56 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Setup Shared Input E-vectors
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupSharedInputs_Blocked(CeedOperator op,
+    CeedOperator_Blocked *impl) {
+  int ierr;
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt numinputfields;
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, NULL); CeedChk(ierr);
+  CeedOperatorField *opfields;
+  ierr = CeedOperatorGetFields(op, &opfields, NULL); CeedChk(ierr);
+  CeedQFunctionField *qffields;
+  ierr = CeedQFunctionGetFields(qf, &qffields, NULL); CeedChk(ierr);
+
+  // Inputs with the same vector and restriction share the full E-vector of the
+  //   first of these inputs, which is the only one restricted
+  for (CeedInt i=0; i<numinputfields; i++) {
+    impl->inputshared[i] = -1;
+    CeedEvalMode emode;
+    ierr = CeedQFunctionFieldGetEvalMode(qffields[i], &emode); CeedChk(ierr);
+    if (emode == CEED_EVAL_WEIGHT)
+      continue;
+    CeedVector vec;
+    CeedElemRestriction rstr;
+    ierr = CeedOperatorFieldGetVector(opfields[i], &vec); CeedChk(ierr);
+    ierr = CeedOperatorFieldGetElemRestriction(opfields[i], &rstr);
+    CeedChk(ierr);
+    for (CeedInt j=0; j<i; j++) {
+      CeedVector vecj;
+      CeedElemRestriction rstrj;
+      ierr = CeedQFunctionFieldGetEvalMode(qffields[j], &emode); CeedChk(ierr);
+      if (emode == CEED_EVAL_WEIGHT || impl->inputshared[j] >= 0)
+        continue;
+      ierr = CeedOperatorFieldGetVector(opfields[j], &vecj); CeedChk(ierr);
+      ierr = CeedOperatorFieldGetElemRestriction(opfields[j], &rstrj);
+      CeedChk(ierr);
+      if (vecj != vec || rstrj != rstr)
+        continue;
+
+      ierr = CeedVectorDestroy(&impl->evecs[i]); CeedChk(ierr);
+      impl->evecs[i] = impl->evecs[j];
+      ierr = CeedVectorAddReference(impl->evecs[j]); CeedChk(ierr);
+      impl->inputshared[i] = j;
+      break;
+    }
+  }
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Setup Operator
 //------------------------------------------------------------------------------
@@ -159,10 +183,12 @@ static int CeedOperatorSetup_Blocked(CeedOperator op) {
   CeedChk(ierr);
 
   ierr = CeedCalloc(16, &impl->inputstate); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->inputshared); CeedChk(ierr);
   ierr = CeedCalloc(16, &impl->evecsin); CeedChk(ierr);
   ierr = CeedCalloc(16, &impl->evecsout); CeedChk(ierr);
   ierr = CeedCalloc(16, &impl->qvecsin); CeedChk(ierr);
   ierr = CeedCalloc(16, &impl->qvecsout); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->escale); CeedChk(ierr);
 
   impl->numein = numinputfields; impl->numeout = numoutputfields;
 
@@ -180,6 +206,9 @@ static int CeedOperatorSetup_Blocked(CeedOperator op) {
                                          numoutputfields, Q);
   CeedChk(ierr);
 
+  // Inputs sharing a vector and restriction
+  ierr = CeedOperatorSetupSharedInputs_Blocked(op, impl); CeedChk(ierr);
+
   // Identity QFunctions
   if (impl->identityqf) {
     CeedEvalMode inmode, outmode;
@@ -229,9 +258,10 @@ static inline int CeedOperatorSetupInputs_Blocked(CeedInt numinputfields,
     CeedChk(ierr);
     if (emode == CEED_EVAL_WEIGHT) { // Skip
     } else {
-      // Restrict
+      // Restrict, unless restricted for another input
       ierr = CeedVectorGetState(vec, &state); CeedChk(ierr);
-      if (state != impl->inputstate[i] || vec == invec) {
+      if (impl->inputshared[i] < 0 &&
+          (state != impl->inputstate[i] || vec == invec)) {
         ierr = CeedElemRestrictionApply(impl->blkrestr[i], CEED_NOTRANSPOSE,
                                         vec, impl->evecs[i], request);
         CeedChk(ierr);
@@ -389,6 +419,41 @@ static inline int CeedOperatorOutputBasis_Blocked(CeedInt e, CeedInt Q,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Output Scaling
+//------------------------------------------------------------------------------
+static inline int CeedOperatorScaleOutput_Blocked(CeedElemRestriction blkrestr,
+    CeedVector evec, const CeedScalar beta, CeedVector scale,
+    CeedVector *escale, CeedRequest *request) {
+  CeedInt ierr;
+  CeedInt len;
+  ierr = CeedVectorGetLength(evec, &len); CeedChk(ierr);
+  if (!*escale) {
+    Ceed ceed;
+    ierr = CeedVectorGetCeed(evec, &ceed); CeedChk(ierr);
+    ierr = CeedVectorCreate(ceed, len, escale); CeedChk(ierr);
+  }
+
+  // Scaling factors for element nodes
+  if (scale != CEED_VECTOR_NONE) {
+    ierr = CeedElemRestrictionApply(blkrestr, CEED_NOTRANSPOSE, scale, *escale,
+                                    request); CeedChk(ierr);
+  } else {
+    ierr = CeedVectorSetValue(*escale, 1.0); CeedChk(ierr);
+  }
+
+  // Scale element output
+  const CeedScalar *ev;
+  CeedScalar *es;
+  ierr = CeedVectorGetArrayRead(evec, CEED_MEM_HOST, &ev); CeedChk(ierr);
+  ierr = CeedVectorGetArray(*escale, CEED_MEM_HOST, &es); CeedChk(ierr);
+  for (CeedInt i=0; i<len; i++)
+    es[i] *= beta*ev[i];
+  ierr = CeedVectorRestoreArray(*escale, &es); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(evec, &ev); CeedChk(ierr);
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Restore Input Vectors
 //------------------------------------------------------------------------------
@@ -419,11 +484,11 @@ static inline int CeedOperatorRestoreInputs_Blocked(CeedInt numinputfields,
 }
 
 //------------------------------------------------------------------------------
-// Operator Apply
+// Operator Apply, with active output scaled by beta and pointwise by scale
 //------------------------------------------------------------------------------
-static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector invec,
-                                        CeedVector outvec,
-                                        CeedRequest *request) {
+static int CeedOperatorApplyAddCore_Blocked(CeedOperator op, CeedVector invec,
+    CeedVector outvec, const CeedScalar beta, CeedVector scale,
+    CeedRequest *request) {
   int ierr;
   CeedOperator_Blocked *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
@@ -503,10 +568,19 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector invec,
     // Active
     if (vec == CEED_VECTOR_ACTIVE)
       vec = outvec;
+    // Scale active output
+    CeedVector evec = impl->evecs[i+impl->numein];
+    if (vec == outvec && (scale != CEED_VECTOR_NONE || beta != 1.0)) {
+      ierr = CeedOperatorScaleOutput_Blocked(impl->blkrestr[i+impl->numein],
+                                             evec, beta, scale,
+                                             &impl->escale[i], request);
+      CeedChk(ierr);
+      evec = impl->escale[i];
+    }
     // Restrict
     ierr = CeedElemRestrictionApply(impl->blkrestr[i+impl->numein],
-                                    CEED_TRANSPOSE, impl->evecs[i+impl->numein],
-                                    vec, request); CeedChk(ierr);
+                                    CEED_TRANSPOSE, evec, vec, request);
+    CeedChk(ierr);
 
   }
 
@@ -517,6 +591,31 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector invec,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector invec,
+                                        CeedVector outvec,
+                                        CeedRequest *request) {
+  int ierr;
+  ierr = CeedOperatorApplyAddCore_Blocked(op, invec, outvec, 1.0,
+                                          CEED_VECTOR_NONE, request);
+  CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply with Scaled Output
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyScaledAdd_Blocked(CeedOperator op,
+    CeedVector invec, CeedVector outvec, CeedScalar beta, CeedVector scale,
+    CeedRequest *request) {
+  int ierr;
+  ierr = CeedOperatorApplyAddCore_Blocked(op, invec, outvec, beta, scale,
+                                          request); CeedChk(ierr);
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Assemble Linear QFunction
 //------------------------------------------------------------------------------
@@ -689,6 +788,57 @@ static int CeedOperatorLinearAssembleQFunction_Blocked(CeedOperator op,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Add Memory Usage of a Work Vector
+//------------------------------------------------------------------------------
+static int CeedOperatorAddVectorUsage_Blocked(CeedVector vec, size_t *bytes) {
+  int ierr;
+  size_t vecbytes;
+
+  if (!vec) return 0;
+  ierr = CeedVectorGetMemoryUsage(vec, &vecbytes); CeedChk(ierr);
+  *bytes += vecbytes;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Operator Get Memory Usage
+//------------------------------------------------------------------------------
+static int CeedOperatorGetMemoryUsage_Blocked(CeedOperator op, size_t *usage) {
+  int ierr;
+  CeedOperator_Blocked *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  // E-vectors are owned by the operator, and counted once when shared between
+  //   inputs; blocked restrictions are counted with the field restrictions
+  for (CeedInt i=0; i<impl->numein+impl->numeout; i++) {
+    if (i < impl->numein && impl->inputshared[i] >= 0)
+      continue;
+    ierr = CeedOperatorAddVectorUsage_Blocked(impl->evecs[i],
+        &usage[CEED_MEMORY_EVEC]);
+    CeedChk(ierr);
+  }
+  for (CeedInt i=0; i<impl->numein; i++) {
+    ierr = CeedOperatorAddVectorUsage_Blocked(impl->evecsin[i],
+        &usage[CEED_MEMORY_EVEC]);
+    CeedChk(ierr);
+    ierr = CeedOperatorAddVectorUsage_Blocked(impl->qvecsin[i],
+        &usage[CEED_MEMORY_QVEC]);
+    CeedChk(ierr);
+  }
+  for (CeedInt i=0; i<impl->numeout; i++) {
+    ierr = CeedOperatorAddVectorUsage_Blocked(impl->evecsout[i],
+        &usage[CEED_MEMORY_EVEC]);
+    CeedChk(ierr);
+    ierr = CeedOperatorAddVectorUsage_Blocked(impl->qvecsout[i],
+        &usage[CEED_MEMORY_QVEC]);
+    CeedChk(ierr);    ierr = CeedOperatorAddVectorUsage_Blocked(impl->escale[i],
+        &usage[CEED_MEMORY_EVEC]);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Operator Destroy
 //------------------------------------------------------------------------------
@@ -705,6 +855,7 @@ static int CeedOperatorDestroy_Blocked(CeedOperator op) {
   ierr = CeedFree(&impl->evecs); CeedChk(ierr);
   ierr = CeedFree(&impl->edata); CeedChk(ierr);
   ierr = CeedFree(&impl->inputstate); CeedChk(ierr);
+  ierr = CeedFree(&impl->inputshared); CeedChk(ierr);
 
   for (CeedInt i=0; i<impl->numein; i++) {
     ierr = CeedVectorDestroy(&impl->evecsin[i]); CeedChk(ierr);
@@ -716,9 +867,11 @@ static int CeedOperatorDestroy_Blocked(CeedOperator op) {
   for (CeedInt i=0; i<impl->numeout; i++) {
     ierr = CeedVectorDestroy(&impl->evecsout[i]); CeedChk(ierr);
     ierr = CeedVectorDestroy(&impl->qvecsout[i]); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&impl->escale[i]); CeedChk(ierr);
   }
   ierr = CeedFree(&impl->evecsout); CeedChk(ierr);
   ierr = CeedFree(&impl->qvecsout); CeedChk(ierr);
+  ierr = CeedFree(&impl->escale); CeedChk(ierr);
 
   ierr = CeedFree(&impl); CeedChk(ierr);
   return 0;
@@ -741,6 +894,12 @@ int CeedOperatorCreate_Blocked(CeedOperator op) {
   CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd",
                                 CeedOperatorApplyAdd_Blocked); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyScaledAdd",
+                                CeedOperatorApplyScaledAdd_Blocked);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "GetMemoryUsage",
+                                CeedOperatorGetMemoryUsage_Blocked);
+  CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
                                 CeedOperatorDestroy_Blocked); CeedChk(ierr);
   return 0;
@@ -28,10 +28,12 @@ typedef struct {
   *evecs;   /// E-vectors needed to apply operator (input followed by outputs)
   CeedScalar **edata;
   uint64_t *inputstate;  /// State counter of inputs
+  CeedInt *inputshared;  /// Earlier input sharing each input's E-vector, or -1
   CeedVector *evecsin;   /// Input E-vectors needed to apply operator
   CeedVector *evecsout;  /// Output E-vectors needed to apply operator
   CeedVector *qvecsin;   /// Input Q-vectors needed to apply operator
   CeedVector *qvecsout;  /// Output Q-vectors needed to apply operator
+  CeedVector *escale;    /// Scaled output blocked E-vectors
   CeedInt    numein;
   CeedInt    numeout;
 } CeedOperator_Blocked;
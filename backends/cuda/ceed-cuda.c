@@ -18,6 +18,11 @@
 #include <stdarg.h>
 #include "ceed-cuda.h"
 
+// Location of libCEED headers, such as ceed-math.h, for JiT QFunction sources
+#ifndef CEED_JIT_INCLUDE_DIR
+#define CEED_JIT_INCLUDE_DIR "."
+#endif
+
 //------------------------------------------------------------------------------
 // Compile CUDA kernel
 //------------------------------------------------------------------------------
@@ -30,7 +35,7 @@ int CeedCompileCuda(Ceed ceed, const char *source, CUmodule *module,
 
   // Get kernel specific options, such as kernel constants
   const int optslen = 32;
-  const int optsextra = 4;
+  const int optsextra = 5;
   const char *opts[numopts + optsextra];
   char buf[numopts][optslen];
   if (numopts > 0) {
@@ -51,6 +56,7 @@ int CeedCompileCuda(Ceed ceed, const char *source, CUmodule *module,
   opts[numopts]     = "-DCeedScalar=double";
   opts[numopts + 1] = "-DCeedInt=int";
   opts[numopts + 2] = "-default-device";
+  opts[numopts + 4] = "-I" CEED_JIT_INCLUDE_DIR;
   struct cudaDeviceProp prop;
   Ceed_Cuda *ceed_data;
   ierr = CeedGetData(ceed, &ceed_data); CeedChk(ierr);
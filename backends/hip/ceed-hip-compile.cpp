@@ -22,6 +22,11 @@
 #include "ceed-hip.h"
 #include "ceed-hip-compile.h"
 
+// Location of libCEED headers, such as ceed-math.h, for JiT QFunction sources
+#ifndef CEED_JIT_INCLUDE_DIR
+#define CEED_JIT_INCLUDE_DIR "."
+#endif
+
 #define CeedChk_hiprtc(ceed, x) \
 do { \
   hiprtcResult result = static_cast<hiprtcResult>(x); \
@@ -45,7 +50,7 @@ int CeedCompileHip(Ceed ceed, const char *source, hipModule_t *module,
   // Macro definitions
   // Get kernel specific options, such as kernel constants
   const int optslen = 32;
-  const int optssize = 2;
+  const int optssize = 3;
   const char *opts[optssize];
   if (numopts > 0) {
     va_list args;
@@ -74,6 +79,7 @@ int CeedCompileHip(Ceed ceed, const char *source, hipModule_t *module,
   std::string archArg = "--gpu-architecture="  + gfxName;
   snprintf(buff, optslen, "%s", archArg.c_str());
   opts[1] = buff;
+  opts[2] = "-I" CEED_JIT_INCLUDE_DIR;
 
   // Add string source argument provided in call
   code << source;
@@ -22,14 +22,12 @@
 static int CeedQFunctionApply_Memcheck(CeedQFunction qf, CeedInt Q,
                                        CeedVector *U, CeedVector *V) {
   int ierr;
-  CeedQFunction_Memcheck *impl;
-  ierr = CeedQFunctionGetData(qf, &impl); CeedChk(ierr);
 
   CeedQFunctionContext ctx;
   ierr = CeedQFunctionGetContext(qf, &ctx); CeedChk(ierr);
   void *ctxData = NULL;
   if (ctx) {
-    ierr = CeedQFunctionContextGetData(ctx, CEED_MEM_HOST, &ctxData);
+    ierr = CeedQFunctionContextGetDataRead(ctx, CEED_MEM_HOST, &ctxData);
     CeedChk(ierr);
   }
 
@@ -39,28 +37,33 @@ static int CeedQFunctionApply_Memcheck(CeedQFunction qf, CeedInt Q,
   CeedInt nIn, nOut;
   ierr = CeedQFunctionGetNumArgs(qf, &nIn, &nOut); CeedChk(ierr);
 
+  // Field arrays are per call, so operators sharing the QFunction may be
+  //   applied from different threads
+  const CeedScalar *inputs[16];
+  CeedScalar *outputs[16];
+
   for (int i = 0; i<nIn; i++) {
-    ierr = CeedVectorGetArrayRead(U[i], CEED_MEM_HOST, &impl->inputs[i]);
+    ierr = CeedVectorGetArrayRead(U[i], CEED_MEM_HOST, &inputs[i]);
     CeedChk(ierr);
   }
   for (int i = 0; i<nOut; i++) {
-    ierr = CeedVectorGetArray(V[i], CEED_MEM_HOST, &impl->outputs[i]);
+    ierr = CeedVectorGetArray(V[i], CEED_MEM_HOST, &outputs[i]);
     CeedChk(ierr);
     CeedInt len;
     ierr = CeedVectorGetLength(V[i], &len); CeedChk(ierr);
-    VALGRIND_MAKE_MEM_UNDEFINED(impl->outputs[i], len);
+    VALGRIND_MAKE_MEM_UNDEFINED(outputs[i], len);
   }
 
-  ierr = f(ctxData, Q, impl->inputs, impl->outputs); CeedChk(ierr);
+  ierr = f(ctxData, Q, inputs, outputs); CeedChk(ierr);
 
   for (int i = 0; i<nIn; i++) {
-    ierr = CeedVectorRestoreArrayRead(U[i], &impl->inputs[i]); CeedChk(ierr);
+    ierr = CeedVectorRestoreArrayRead(U[i], &inputs[i]); CeedChk(ierr);
   }
   for (int i = 0; i<nOut; i++) {
-    ierr = CeedVectorRestoreArray(V[i], &impl->outputs[i]); CeedChk(ierr);
+    ierr = CeedVectorRestoreArray(V[i], &outputs[i]); CeedChk(ierr);
   }
   if (ctx) {
-    ierr = CeedQFunctionContextRestoreData(ctx, &ctxData); CeedChk(ierr);
+    ierr = CeedQFunctionContextRestoreDataRead(ctx, &ctxData); CeedChk(ierr);
   }
 
   return 0;
@@ -74,8 +77,6 @@ static int CeedQFunctionDestroy_Memcheck(CeedQFunction qf) {
   CeedQFunction_Memcheck *impl;
   ierr = CeedQFunctionGetData(qf, (void *)&impl); CeedChk(ierr);
 
-  ierr = CeedFree(&impl->inputs); CeedChk(ierr);
-  ierr = CeedFree(&impl->outputs); CeedChk(ierr);
   ierr = CeedFree(&impl); CeedChk(ierr);
 
   return 0;
@@ -91,8 +92,6 @@ int CeedQFunctionCreate_Memcheck(CeedQFunction qf) {
 
   CeedQFunction_Memcheck *impl;
   ierr = CeedCalloc(1, &impl); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->inputs); CeedChk(ierr);
-  ierr = CeedCalloc(16, &impl->outputs); CeedChk(ierr);
   ierr = CeedQFunctionSetData(qf, impl); CeedChk(ierr);
 
   ierr = CeedSetBackendFunction(ceed, "QFunction", qf, "Apply",
@@ -30,6 +30,19 @@ namespace ceed {
       return _device;
     }
 
+    ::occa::kernel CeedObject::buildKernel(::occa::kernelBuilder &kernelBuilder,
+                                           const ::occa::properties &props) {
+      Context::KernelCacheScope cacheScope(*Context::from(ceed));
+      return kernelBuilder.build(getDevice(), props);
+    }
+
+    ::occa::kernel CeedObject::buildKernelFromString(const std::string &source,
+                                                     const std::string &kernelName,
+                                                     const ::occa::properties &props) {
+      Context::KernelCacheScope cacheScope(*Context::from(ceed));
+      return getDevice().buildKernelFromString(source, kernelName, props);
+    }
+
     bool CeedObject::usingCpuDevice() const {
       return Context::from(ceed)->usingCpuDevice();
     }
@@ -38,6 +51,10 @@ namespace ceed {
       return Context::from(ceed)->usingGpuDevice();
     }
 
+    bool CeedObject::usingOpenMPDevice() const {
+      return Context::from(ceed)->usingOpenMPDevice();
+    }
+
     int CeedObject::ceedError(const std::string &message) const {
       return CeedError(ceed, 1, message.c_str());
     }
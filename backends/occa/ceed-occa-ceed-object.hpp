@@ -33,8 +33,15 @@ namespace ceed {
 
       ::occa::device getDevice();
 
+      ::occa::kernel buildKernel(::occa::kernelBuilder &kernelBuilder,
+                                 const ::occa::properties &props);
+      ::occa::kernel buildKernelFromString(const std::string &source,
+                                           const std::string &kernelName,
+                                           const ::occa::properties &props);
+
       bool usingCpuDevice() const;
       bool usingGpuDevice() const;
+      bool usingOpenMPDevice() const;
 
       int ceedError(const std::string &message) const;
       static int staticCeedError(const std::string &message);
@@ -18,11 +18,17 @@
 
 namespace ceed {
   namespace occa {
-    Context::Context(::occa::device device_) :
-        device(device_) {
+    Context::Context(::occa::device device_,
+                     const std::string &kernelCacheDir_) :
+        device(device_),
+        kernelCacheDir(kernelCacheDir_) {
+      if (kernelCacheDir.empty()) {
+        kernelCacheDir = ::occa::env::OCCA_CACHE_DIR;
+      }
       const std::string mode = device.mode();
       _usingCpuDevice = (mode == "Serial" || mode == "OpenMP");
       _usingGpuDevice = (mode == "CUDA" || mode == "HIP" || mode == "OpenCL");
+      _usingOpenMPDevice = (mode == "OpenMP");
     }
 
     Context* Context::from(Ceed ceed) {
@@ -42,5 +48,21 @@ namespace ceed {
     bool Context::usingGpuDevice() const {
       return _usingGpuDevice;
     }
+
+    bool Context::usingOpenMPDevice() const {
+      return _usingOpenMPDevice;
+    }
+
+    std::mutex Context::KernelCacheScope::mutex;
+
+    Context::KernelCacheScope::KernelCacheScope(const Context &context) :
+        lock(mutex),
+        previousDir(::occa::env::OCCA_CACHE_DIR) {
+      ::occa::env::setOccaCacheDir(context.kernelCacheDir);
+    }
+
+    Context::KernelCacheScope::~KernelCacheScope() {
+      ::occa::env::setOccaCacheDir(previousDir);
+    }
   }
 }
@@ -17,6 +17,8 @@
 #ifndef CEED_OCCA_CONTEXT_HEADER
 #define CEED_OCCA_CONTEXT_HEADER
 
+#include <mutex>
+
 #include "ceed-occa-types.hpp"
 
 namespace ceed {
@@ -25,16 +27,33 @@ namespace ceed {
      private:
       bool _usingCpuDevice;
       bool _usingGpuDevice;
+      bool _usingOpenMPDevice;
 
      public:
       ::occa::device device;
+      std::string kernelCacheDir;
 
-      Context(::occa::device device_);
+      Context(::occa::device device_,
+              const std::string &kernelCacheDir_ = "");
 
       static Context* from(Ceed ceed);
 
       bool usingCpuDevice() const;
       bool usingGpuDevice() const;
+      bool usingOpenMPDevice() const;
+
+      // OCCA reads a single, process-wide cache directory when building
+      // kernels, so builds select the directory of their context in turn
+      class KernelCacheScope {
+       private:
+        static std::mutex mutex;
+        std::lock_guard<std::mutex> lock;
+        std::string previousDir;
+
+       public:
+        KernelCacheScope(const Context &context);
+        ~KernelCacheScope();
+      };
     };
   }
 }
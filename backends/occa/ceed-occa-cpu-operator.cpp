@@ -210,6 +210,13 @@ namespace ceed {
 
       props["defines/OCCA_Q"] = ceedQ;
 
+      // OpenMP parallelizes the @outer loop, so each thread takes a
+      // contiguous range of single elements instead of the few 128-element
+      // tiles there are on small meshes. Each element only writes its own
+      // slice of the output E-vectors, and the transpose restriction gathers
+      // by node through the inverse map, so no atomics are needed.
+      props["defines/OCCA_ELEMENT_TILE"] = usingOpenMPDevice() ? 1 : 128;
+
       return props;
     }
 
@@ -242,9 +249,9 @@ namespace ceed {
       CeedDebug(kernelSource.c_str());
 
       // TODO: Store a kernel per Q
-      return getDevice().buildKernelFromString(kernelSource,
-                                               "applyAdd",
-                                               getKernelProps());
+      return buildKernelFromString(kernelSource,
+                                   "applyAdd",
+                                   getKernelProps());
     }
 
     //---[ Kernel Generation ]--------------------
@@ -333,7 +340,7 @@ namespace ceed {
 
       ss <<                                                                   std::endl
          << ") {"                                                          << std::endl
-         << "  @tile(128, @outer, @inner)"                                 << std::endl
+         << "  @tile(OCCA_ELEMENT_TILE, @outer, @inner)"                   << std::endl
          << "  for (int element = 0; element < elementCount; ++element) {" << std::endl;
 
 #if CEED_OCCA_PRINT_KERNEL_HASHES
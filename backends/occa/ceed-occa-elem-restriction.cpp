@@ -300,8 +300,8 @@ namespace ceed {
       kernelProps["defines/UNSTRIDED_COMPONENT_STRIDE"] = ceedUnstridedComponentStride;
 
       if (rIsTransposed) {
-        ::occa::kernel applyTranspose = applyTransposeKernelBuilder.build(
-          getDevice(),
+        ::occa::kernel applyTranspose = buildKernel(
+          applyTransposeKernelBuilder,
           kernelProps
         );
 
@@ -312,8 +312,8 @@ namespace ceed {
                        u.getConstKernelArg(),
                        v.getKernelArg());
       } else {
-        ::occa::kernel apply = applyKernelBuilder.build(
-          getDevice(),
+        ::occa::kernel apply = buildKernel(
+          applyKernelBuilder,
           kernelProps
         );
 
@@ -106,9 +106,9 @@ namespace ceed {
         const std::string kernelName = "qFunctionKernel";
 
         qFunctionKernel = (
-          getDevice().buildKernelFromString(getKernelSource(kernelName, Q),
-                                            kernelName,
-                                            props)
+          buildKernelFromString(getKernelSource(kernelName, Q),
+                                kernelName,
+                                props)
         );
       }
 
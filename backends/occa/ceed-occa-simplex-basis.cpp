@@ -167,7 +167,7 @@ namespace ceed {
       ::occa::properties kernelProps;
       kernelProps["defines/TRANSPOSE"] = transpose;
 
-      return kernelBuilder.build(getDevice(), kernelProps);
+      return buildKernel(kernelBuilder, kernelProps);
     }
 
     ::occa::kernel SimplexBasis::buildGpuEvalKernel(::occa::kernelBuilder &kernelBuilder,
@@ -176,7 +176,7 @@ namespace ceed {
       kernelProps["defines/TRANSPOSE"]          = transpose;
       kernelProps["defines/ELEMENTS_PER_BLOCK"] = Q <= 1024 ? (1024 / Q) : 1;
 
-      return kernelBuilder.build(getDevice(), kernelProps);
+      return buildKernel(kernelBuilder, kernelProps);
     }
 
     int SimplexBasis::apply(const CeedInt elementCount,
@@ -236,7 +236,7 @@ namespace ceed {
       ::occa::properties kernelProps;
       kernelProps["defines/TRANSPOSE"] = transpose;
 
-      return kernelBuilder.build(getDevice(), kernelProps);
+      return buildKernel(kernelBuilder, kernelProps);
     }
 
     ::occa::kernel TensorBasis::buildGpuEvalKernel(::occa::kernelBuilder &kernelBuilder,
@@ -248,7 +248,7 @@ namespace ceed {
       kernelProps["defines/MAX_PQ"]             = Q1D > P1D ? Q1D : P1D;
       kernelProps["defines/ELEMENTS_PER_BLOCK"] = elementsPerBlock;
 
-      return kernelBuilder.build(getDevice(), kernelProps);
+      return buildKernel(kernelBuilder, kernelProps);
     }
 
     int TensorBasis::apply(const CeedInt elementCount,
@@ -142,27 +142,34 @@ namespace ceed {
 
       // Check for /gpu/cuda/occa, /gpu/hip/occa, /cpu/self/occa, /cpu/openmp/occa
       // Note: added for matching style with other backends
-      if (resource == "/gpu/cuda/occa"){
-        match = "cuda";
-        return 0;
+      //   These may be followed by a query, parsed as for /<match>/occa
+      const std::string base = resource.substr(0, resource.find(QUERY_DELIMITER));
+      const std::string queryStr = resource.substr(base.size());
+      std::string baseMatch;
+      if (base == "/gpu/cuda/occa"){
+        baseMatch = "cuda";
       }
-      if (resource == "/gpu/hip/occa"){
-        match = "hip";
-        return 0;
+      if (base == "/gpu/hip/occa"){
+        baseMatch = "hip";
       }
       /*
-      if (resource == "/gpu/opencl/occa"){
-        match = "opencl";
-        return 0;
+      if (base == "/gpu/opencl/occa"){
+        baseMatch = "opencl";
       }
       */
-      if (resource == "/cpu/openmp/occa"){
-        match = "openmp";
-        return 0;
+      if (base == "/cpu/openmp/occa"){
+        baseMatch = "openmp";
       }
-      if (resource == "/cpu/self/occa"){
-        match = "serial";
-        return 0;
+      if (base == "/cpu/self/occa"){
+        baseMatch = "serial";
+      }
+      if (baseMatch.size()) {
+        if (!queryStr.size()) {
+          match = baseMatch;
+          return 0;
+        }
+        return splitCeedResource("/" + baseMatch + "/occa" + queryStr,
+                                 match, query);
       }
 
       // Skip initial slash
@@ -211,6 +218,31 @@ namespace ceed {
       return 0;
     }
 
+    static std::string unquote(const std::string &value) {
+      const int size = (int) value.size();
+      if (size >= 2
+          && (value[0] == '\'' || value[0] == '"')
+          && value[size - 1] == value[0]) {
+        return value.substr(1, size - 2);
+      }
+      return value;
+    }
+
+    static std::string getKernelCacheDir(StringMap &query) {
+      // OCCA stores compiled kernels under a hash of their source and build
+      // properties, so a cache directory filled by an earlier run, or copied
+      // to node-local storage, is reused by every rank without recompiling.
+      // The default is $OCCA_CACHE_DIR, or ~/.occa/cache. The directory
+      // applies to kernels built for this Ceed only.
+      StringMap::iterator it = query.find("cache_dir");
+      if (it == query.end()) {
+        return "";
+      }
+      const std::string kernelCacheDir = unquote(it->second);
+      query.erase(it);
+      return kernelCacheDir;
+    }
+
     void setDefaultProps(::occa::properties &deviceProps,
                          const std::string &defaultMode) {
       std::string mode;
@@ -257,6 +289,8 @@ namespace ceed {
         return CeedError(ceed, 1, "(OCCA) Backend cannot use resource: %s", c_resource);
       }
 
+      const std::string kernelCacheDir = getKernelCacheDir(query);
+
       std::string devicePropsStr = "{\n";
       StringMap::const_iterator it;
       for (it = query.begin(); it != query.end(); ++it) {
@@ -271,7 +305,8 @@ namespace ceed {
       ::occa::properties deviceProps(devicePropsStr);
       setDefaultProps(deviceProps, mode);
 
-      ceed::occa::Context *context = new Context(::occa::device(deviceProps));
+      ceed::occa::Context *context = new Context(::occa::device(deviceProps),
+                                                 kernelCacheDir);
       ierr = CeedSetData(ceed, context); CeedChk(ierr);
 
       return 0;
@@ -26,7 +26,7 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op,
                                        CeedVector *fullevecs, CeedVector *evecs,
                                        CeedVector *qvecs, CeedInt starte,
                                        CeedInt numfields, CeedInt Q) {
-  CeedInt dim, ierr, ncomp, size, P;
+  CeedInt dim, ierr, size, P;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
   CeedBasis basis;
@@ -53,35 +53,8 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op,
     if (emode != CEED_EVAL_WEIGHT) {
       ierr = CeedOperatorFieldGetElemRestriction(opfields[i], &r);
       CeedChk(ierr);
-      Ceed ceed;
-      ierr = CeedElemRestrictionGetCeed(r, &ceed); CeedChk(ierr);
-      CeedInt nelem, elemsize, lsize, compstride;
-      ierr = CeedElemRestrictionGetNumElements(r, &nelem); CeedChk(ierr);
-      ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
-      ierr = CeedElemRestrictionGetLVectorSize(r, &lsize); CeedChk(ierr);
-      ierr = CeedElemRestrictionGetNumComponents(r, &ncomp); CeedChk(ierr);
-
-      bool strided;
-      ierr = CeedElemRestrictionIsStrided(r, &strided); CeedChk(ierr);
-      if (strided) {
-        CeedInt strides[3];
-        ierr = CeedElemRestrictionGetStrides(r, &strides); CeedChk(ierr);
-        ierr = CeedElemRestrictionCreateBlockedStrided(ceed, nelem, elemsize,
-               blksize, ncomp, lsize, strides, &blkrestr[i+starte]);
-        CeedChk(ierr);
-      } else {
-        const CeedInt *offsets = NULL;
-        ierr = CeedElemRestrictionGetOffsets(r, CEED_MEM_HOST, &offsets);
-        CeedChk(ierr);
-        ierr = CeedElemRestrictionGetCompStride(r, &compstride); CeedChk(ierr);
-        ierr = CeedElemRestrictionCreateBlocked(ceed, nelem, elemsize,
-                                                blksize, ncomp, compstride,
-                                                lsize, CEED_MEM_HOST,
-                                                CEED_COPY_VALUES, offsets,
-                                                &blkrestr[i+starte]);
-        CeedChk(ierr);
-        ierr = CeedElemRestrictionRestoreOffsets(r, &offsets); CeedChk(ierr);
-      }
+      ierr = CeedElemRestrictionGetBlocked(r, blksize, &blkrestr[i+starte]);
+      CeedChk(ierr);
       ierr = CeedElemRestrictionCreateVector(blkrestr[i+starte], NULL,
                                              &fullevecs[i+starte]);
       CeedChk(ierr);
@@ -126,6 +99,133 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Setup Combined Interpolation and Gradient Inputs
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupInterpGrad_Opt(CeedOperator op, CeedInt Q,
+    const CeedInt blksize, CeedOperator_Opt *impl) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt numinputfields;
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, NULL); CeedChk(ierr);
+  CeedOperatorField *opfields;
+  ierr = CeedOperatorGetFields(op, &opfields, NULL); CeedChk(ierr);
+  CeedQFunctionField *qffields;
+  ierr = CeedQFunctionGetFields(qf, &qffields, NULL); CeedChk(ierr);
+
+  // An INTERP input and a GRAD input with the same vector, restriction, and
+  //   basis are restricted once and evaluated with a single basis action,
+  //   writing both blocked Q-vectors, which are adjacent in one array
+  for (CeedInt i=0; i<numinputfields; i++) {
+    impl->fusedgrad[i] = -1;
+    CeedEvalMode emode;
+    ierr = CeedQFunctionFieldGetEvalMode(qffields[i], &emode); CeedChk(ierr);
+    if (emode != CEED_EVAL_INTERP)
+      continue;
+    CeedVector vec;
+    CeedElemRestriction rstr;
+    CeedBasis basis;
+    ierr = CeedOperatorFieldGetVector(opfields[i], &vec); CeedChk(ierr);
+    ierr = CeedOperatorFieldGetElemRestriction(opfields[i], &rstr);
+    CeedChk(ierr);
+    ierr = CeedOperatorFieldGetBasis(opfields[i], &basis); CeedChk(ierr);
+    for (CeedInt j=0; j<numinputfields; j++) {
+      CeedVector vecj;
+      CeedElemRestriction rstrj;
+      CeedBasis basisj;
+      ierr = CeedQFunctionFieldGetEvalMode(qffields[j], &emode); CeedChk(ierr);
+      if (emode != CEED_EVAL_GRAD || impl->inputfused[j])
+        continue;
+      ierr = CeedOperatorFieldGetVector(opfields[j], &vecj); CeedChk(ierr);
+      ierr = CeedOperatorFieldGetElemRestriction(opfields[j], &rstrj);
+      CeedChk(ierr);
+      ierr = CeedOperatorFieldGetBasis(opfields[j], &basisj); CeedChk(ierr);
+      if (vecj != vec || rstrj != rstr || basisj != basis)
+        continue;
+
+      CeedInt sizei, sizej;
+      ierr = CeedQFunctionFieldGetSize(qffields[i], &sizei); CeedChk(ierr);
+      ierr = CeedQFunctionFieldGetSize(qffields[j], &sizej); CeedChk(ierr);
+      const CeedInt len = Q*blksize*(sizei + sizej);
+      ierr = CeedCalloc(len, &impl->qdatafused[i]); CeedChk(ierr);
+      ierr = CeedVectorCreate(ceed, len, &impl->qvecsfused[i]); CeedChk(ierr);
+      ierr = CeedVectorSetArray(impl->qvecsfused[i], CEED_MEM_HOST,
+                                CEED_USE_POINTER, impl->qdatafused[i]);
+      CeedChk(ierr);
+      ierr = CeedVectorSetArray(impl->qvecsin[i], CEED_MEM_HOST,
+                                CEED_USE_POINTER, impl->qdatafused[i]);
+      CeedChk(ierr);
+      ierr = CeedVectorSetArray(impl->qvecsin[j], CEED_MEM_HOST,
+                                CEED_USE_POINTER,
+                                &impl->qdatafused[i][Q*blksize*sizei]);
+      CeedChk(ierr);
+      impl->fusedgrad[i] = j;
+      impl->inputfused[j] = true;
+      break;
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Setup Shared Input E-vectors
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupSharedInputs_Opt(CeedOperator op,
+    CeedOperator_Opt *impl) {
+  int ierr;
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt numinputfields;
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, NULL); CeedChk(ierr);
+  CeedOperatorField *opfields;
+  ierr = CeedOperatorGetFields(op, &opfields, NULL); CeedChk(ierr);
+  CeedQFunctionField *qffields;
+  ierr = CeedQFunctionGetFields(qf, &qffields, NULL); CeedChk(ierr);
+
+  // INTERP and GRAD inputs with the same vector and restriction, but not
+  //   evaluated together, share the full and blocked E-vectors of the first of
+  //   these inputs, which is the only one restricted
+  for (CeedInt i=0; i<numinputfields; i++) {
+    impl->inputshared[i] = -1;
+    CeedEvalMode emode;
+    ierr = CeedQFunctionFieldGetEvalMode(qffields[i], &emode); CeedChk(ierr);
+    if ((emode != CEED_EVAL_INTERP && emode != CEED_EVAL_GRAD) ||
+        impl->inputfused[i] || impl->ereduced[i])
+      continue;
+    CeedVector vec;
+    CeedElemRestriction rstr;
+    ierr = CeedOperatorFieldGetVector(opfields[i], &vec); CeedChk(ierr);
+    ierr = CeedOperatorFieldGetElemRestriction(opfields[i], &rstr);
+    CeedChk(ierr);
+    for (CeedInt j=0; j<i; j++) {
+      CeedVector vecj;
+      CeedElemRestriction rstrj;
+      ierr = CeedQFunctionFieldGetEvalMode(qffields[j], &emode); CeedChk(ierr);
+      if ((emode != CEED_EVAL_INTERP && emode != CEED_EVAL_GRAD) ||
+          impl->inputfused[j] || impl->ereduced[j] || impl->inputshared[j] >= 0)
+        continue;
+      ierr = CeedOperatorFieldGetVector(opfields[j], &vecj); CeedChk(ierr);
+      ierr = CeedOperatorFieldGetElemRestriction(opfields[j], &rstrj);
+      CeedChk(ierr);
+      if (vecj != vec || rstrj != rstr)
+        continue;
+
+      ierr = CeedVectorDestroy(&impl->evecs[i]); CeedChk(ierr);
+      impl->evecs[i] = impl->evecs[j];
+      ierr = CeedVectorAddReference(impl->evecs[j]); CeedChk(ierr);
+      ierr = CeedVectorDestroy(&impl->evecsin[i]); CeedChk(ierr);
+      impl->evecsin[i] = impl->evecsin[j];
+      ierr = CeedVectorAddReference(impl->evecsin[j]); CeedChk(ierr);
+      impl->inputshared[i] = j;
+      break;
+    }
+  }
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Setup Operator
 //------------------------------------------------------------------------------
@@ -164,10 +264,18 @@ static int CeedOperatorSetup_Opt(CeedOperator op) {
   CeedChk(ierr);
 
   ierr = CeedCalloc(16, &impl->inputstate); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->inputprecision); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->ereduced); CeedChk(ierr);
   ierr = CeedCalloc(16, &impl->evecsin); CeedChk(ierr);
   ierr = CeedCalloc(16, &impl->evecsout); CeedChk(ierr);
   ierr = CeedCalloc(16, &impl->qvecsin); CeedChk(ierr);
   ierr = CeedCalloc(16, &impl->qvecsout); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->escale); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->fusedgrad); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->inputfused); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->qvecsfused); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->qdatafused); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->inputshared); CeedChk(ierr);
 
   impl->numein = numinputfields; impl->numeout = numoutputfields;
 
@@ -185,6 +293,29 @@ static int CeedOperatorSetup_Opt(CeedOperator op) {
                                      numoutputfields, Q);
   CeedChk(ierr);
 
+  // Inputs stored in reduced precision replace their blocked E-vectors and
+  //   are converted to CeedScalar one block at a time
+  for (CeedInt i=0; i<numinputfields; i++) {
+    ierr = CeedOperatorFieldGetPrecision(opinputfields[i],
+                                         &impl->inputprecision[i]);
+    CeedChk(ierr);
+    if (impl->inputprecision[i] != CEED_PRECISION_SCALAR) {
+      CeedInt len;
+      size_t bytes;
+      ierr = CeedVectorGetLength(impl->evecs[i], &len); CeedChk(ierr);
+      ierr = CeedFieldPrecisionGetSize(impl->inputprecision[i], &bytes);
+      CeedChk(ierr);
+      ierr = CeedMallocArray(len, bytes, &impl->ereduced[i]); CeedChk(ierr);
+      ierr = CeedVectorDestroy(&impl->evecs[i]); CeedChk(ierr);
+    }
+  }
+
+  // Combined interpolation and gradient inputs
+  ierr = CeedOperatorSetupInterpGrad_Opt(op, Q, blksize, impl); CeedChk(ierr);
+
+  // Inputs sharing a vector and restriction
+  ierr = CeedOperatorSetupSharedInputs_Opt(op, impl); CeedChk(ierr);
+
   // Identity QFunctions
   if (impl->identityqf) {
     CeedEvalMode inmode, outmode;
@@ -222,14 +353,34 @@ static inline int CeedOperatorSetupInputs_Opt(CeedInt numinputfields,
   for (CeedInt i=0; i<numinputfields; i++) {
     ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
     CeedChk(ierr);
-    if (emode == CEED_EVAL_WEIGHT) { // Skip
+    if (emode == CEED_EVAL_WEIGHT || impl->inputfused[i]) { // Skip
+    } else if (impl->ereduced[i]) {
+      // Convert to the storage precision when the input changes
+      ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+      ierr = CeedVectorGetState(vec, &state); CeedChk(ierr);
+      if (state != impl->inputstate[i]) {
+        CeedVector evec;
+        CeedInt len;
+        const CeedScalar *edata;
+        ierr = CeedElemRestrictionCreateVector(impl->blkrestr[i], NULL, &evec);
+        CeedChk(ierr);
+        ierr = CeedElemRestrictionApply(impl->blkrestr[i], CEED_NOTRANSPOSE,
+                                        vec, evec, request); CeedChk(ierr);
+        ierr = CeedVectorGetLength(evec, &len); CeedChk(ierr);
+        ierr = CeedVectorGetArrayRead(evec, CEED_MEM_HOST, &edata); CeedChk(ierr);
+        ierr = CeedFieldPrecisionPack(impl->inputprecision[i], len, edata,
+                                      impl->ereduced[i]); CeedChk(ierr);
+        ierr = CeedVectorRestoreArrayRead(evec, &edata); CeedChk(ierr);
+        ierr = CeedVectorDestroy(&evec); CeedChk(ierr);
+        impl->inputstate[i] = state;
+      }
     } else {
       // Get input vector
       ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
       if (vec != CEED_VECTOR_ACTIVE) {
-        // Restrict
+        // Restrict, unless restricted for another input
         ierr = CeedVectorGetState(vec, &state); CeedChk(ierr);
-        if (state != impl->inputstate[i]) {
+        if (state != impl->inputstate[i] && impl->inputshared[i] < 0) {
           ierr = CeedElemRestrictionApply(impl->blkrestr[i], CEED_NOTRANSPOSE,
                                           vec, impl->evecs[i], request);
           CeedChk(ierr);
@@ -271,6 +422,9 @@ static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt Q,
   CeedVector vec;
 
   for (CeedInt i=0; i<numinputfields; i++) {
+    // Skip GRAD input evaluated with an INTERP input
+    if (impl->inputfused[i])
+      continue;
     ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
     // Skip active input
     if (skipactive) {
@@ -287,18 +441,32 @@ static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt Q,
     ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
     CeedChk(ierr);
     ierr = CeedQFunctionFieldGetSize(qfinputfields[i], &size); CeedChk(ierr);
-    // Restrict block active input
+    // Restrict block active input, unless restricted for another input
     if (vec == CEED_VECTOR_ACTIVE) {
-      ierr = CeedElemRestrictionApplyBlock(impl->blkrestr[i], e/blksize,
-                                           CEED_NOTRANSPOSE, invec,
-                                           impl->evecsin[i], request);
-      CeedChk(ierr);
+      if (impl->inputshared[i] < 0) {
+        ierr = CeedElemRestrictionApplyBlock(impl->blkrestr[i], e/blksize,
+                                             CEED_NOTRANSPOSE, invec,
+                                             impl->evecsin[i], request);
+        CeedChk(ierr);
+      }
       activein = 1;
     }
     // Basis action
     switch(emode) {
     case CEED_EVAL_NONE:
-      if (!activein) {
+      if (impl->ereduced[i]) {
+        size_t bytes;
+        CeedScalar *qdata;
+        ierr = CeedFieldPrecisionGetSize(impl->inputprecision[i], &bytes);
+        CeedChk(ierr);
+        ierr = CeedVectorGetArray(impl->qvecsin[i], CEED_MEM_HOST, &qdata);
+        CeedChk(ierr);
+        ierr = CeedFieldPrecisionUnpack(impl->inputprecision[i],
+                                        Q*size*blksize,
+                                        (char *)impl->ereduced[i] +
+                                        e*Q*size*bytes, qdata); CeedChk(ierr);
+        ierr = CeedVectorRestoreArray(impl->qvecsin[i], &qdata); CeedChk(ierr);
+      } else if (!activein) {
         ierr = CeedVectorSetArray(impl->qvecsin[i], CEED_MEM_HOST,
                                   CEED_USE_POINTER,
                                   &impl->edata[i][e*Q*size]); CeedChk(ierr);
@@ -313,9 +481,16 @@ static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt Q,
                                   &impl->edata[i][e*elemsize*size]);
         CeedChk(ierr);
       }
-      ierr = CeedBasisApply(basis, blksize, CEED_NOTRANSPOSE,
-                            CEED_EVAL_INTERP, impl->evecsin[i],
-                            impl->qvecsin[i]); CeedChk(ierr);
+      if (impl->fusedgrad[i] >= 0) {
+        ierr = CeedBasisApply(basis, blksize, CEED_NOTRANSPOSE,
+                              CEED_EVAL_INTERP | CEED_EVAL_GRAD,
+                              impl->evecsin[i], impl->qvecsfused[i]);
+        CeedChk(ierr);
+      } else {
+        ierr = CeedBasisApply(basis, blksize, CEED_NOTRANSPOSE,
+                              CEED_EVAL_INTERP, impl->evecsin[i],
+                              impl->qvecsin[i]); CeedChk(ierr);
+      }
       break;
     case CEED_EVAL_GRAD:
       ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis);
@@ -348,14 +523,49 @@ static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt Q,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Output Scaling
+//------------------------------------------------------------------------------
+static inline int CeedOperatorScaleOutput_Opt(CeedInt blk,
+    CeedElemRestriction blkrestr, CeedVector evec, const CeedScalar beta,
+    CeedVector scale, CeedVector *escale, CeedRequest *request) {
+  CeedInt ierr;
+  CeedInt len;
+  ierr = CeedVectorGetLength(evec, &len); CeedChk(ierr);
+  if (!*escale) {
+    Ceed ceed;
+    ierr = CeedVectorGetCeed(evec, &ceed); CeedChk(ierr);
+    ierr = CeedVectorCreate(ceed, len, escale); CeedChk(ierr);
+  }
+
+  // Scaling factors for block nodes
+  if (scale != CEED_VECTOR_NONE) {
+    ierr = CeedElemRestrictionApplyBlock(blkrestr, blk, CEED_NOTRANSPOSE, scale,
+                                         *escale, request); CeedChk(ierr);
+  } else {
+    ierr = CeedVectorSetValue(*escale, 1.0); CeedChk(ierr);
+  }
+
+  // Scale block output
+  const CeedScalar *ev;
+  CeedScalar *es;
+  ierr = CeedVectorGetArrayRead(evec, CEED_MEM_HOST, &ev); CeedChk(ierr);
+  ierr = CeedVectorGetArray(*escale, CEED_MEM_HOST, &es); CeedChk(ierr);
+  for (CeedInt i=0; i<len; i++)
+    es[i] *= beta*ev[i];
+  ierr = CeedVectorRestoreArray(*escale, &es); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(evec, &ev); CeedChk(ierr);
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Output Basis Action
 //------------------------------------------------------------------------------
 static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt Q,
     CeedQFunctionField *qfoutputfields, CeedOperatorField *opoutputfields,
     CeedInt blksize, CeedInt numinputfields, CeedInt numoutputfields,
-    CeedOperator op, CeedVector outvec, CeedOperator_Opt *impl,
-    CeedRequest *request) {
+    CeedOperator op, CeedVector outvec, const CeedScalar beta, CeedVector scale,
+    CeedOperator_Opt *impl, CeedRequest *request) {
   CeedInt ierr;
   CeedElemRestriction Erestrict;
   CeedEvalMode emode;
@@ -406,11 +616,19 @@ static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt Q,
     ierr = CeedOperatorFieldGetVector(opoutputfields[i], &vec); CeedChk(ierr);
     if (vec == CEED_VECTOR_ACTIVE)
       vec = outvec;
+    // Scale active output
+    CeedVector evec = impl->evecsout[i];
+    if (vec == outvec && (scale != CEED_VECTOR_NONE || beta != 1.0)) {
+      ierr = CeedOperatorScaleOutput_Opt(e/blksize,
+                                         impl->blkrestr[i+impl->numein], evec,
+                                         beta, scale, &impl->escale[i],
+                                         request); CeedChk(ierr);
+      evec = impl->escale[i];
+    }
     // Restrict
     ierr = CeedElemRestrictionApplyBlock(impl->blkrestr[i+impl->numein],
-                                         e/blksize, CEED_TRANSPOSE,
-                                         impl->evecsout[i], vec, request);
-    CeedChk(ierr);
+                                         e/blksize, CEED_TRANSPOSE, evec, vec,
+                                         request); CeedChk(ierr);
   }
   return 0;
 }
@@ -427,7 +645,8 @@ static inline int CeedOperatorRestoreInputs_Opt(CeedInt numinputfields,
   for (CeedInt i=0; i<numinputfields; i++) {
     ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
     CeedChk(ierr);
-    if (emode == CEED_EVAL_WEIGHT) { // Skip
+    if (emode == CEED_EVAL_WEIGHT || impl->inputfused[i] ||
+        impl->ereduced[i]) { // Skip
     } else {
       ierr = CeedVectorRestoreArrayRead(impl->evecs[i],
                                         (const CeedScalar **) &impl->edata[i]);
@@ -438,10 +657,11 @@ static inline int CeedOperatorRestoreInputs_Opt(CeedInt numinputfields,
 }
 
 //------------------------------------------------------------------------------
-// Operator Apply
+// Operator Apply, with active output scaled by beta and pointwise by scale
 //------------------------------------------------------------------------------
-static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector invec,
-                                    CeedVector outvec, CeedRequest *request) {
+static int CeedOperatorApplyAddCore_Opt(CeedOperator op, CeedVector invec,
+    CeedVector outvec, const CeedScalar beta, CeedVector scale,
+    CeedRequest *request) {
   int ierr;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
@@ -509,7 +729,7 @@ static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector invec,
     // Output basis apply and restrict
     ierr = CeedOperatorOutputBasis_Opt(e, Q, qfoutputfields, opoutputfields,
                                        blksize, numinputfields, numoutputfields,
-                                       op, outvec, impl, request);
+                                       op, outvec, beta, scale, impl, request);
     CeedChk(ierr);
   }
 
@@ -521,6 +741,29 @@ static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector invec,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector invec,
+                                    CeedVector outvec, CeedRequest *request) {
+  int ierr;
+  ierr = CeedOperatorApplyAddCore_Opt(op, invec, outvec, 1.0, CEED_VECTOR_NONE,
+                                      request); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply with Scaled Output
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyScaledAdd_Opt(CeedOperator op, CeedVector invec,
+    CeedVector outvec, CeedScalar beta, CeedVector scale,
+    CeedRequest *request) {
+  int ierr;
+  ierr = CeedOperatorApplyAddCore_Opt(op, invec, outvec, beta, scale, request);
+  CeedChk(ierr);
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Assemble Linear QFunction
 //------------------------------------------------------------------------------
@@ -696,6 +939,80 @@ static int CeedOperatorLinearAssembleQFunction_Opt(CeedOperator op,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Add Memory Usage of a Work Vector
+//------------------------------------------------------------------------------
+static int CeedOperatorAddVectorUsage_Opt(CeedVector vec, size_t *bytes) {
+  int ierr;
+  size_t vecbytes;
+
+  if (!vec) return 0;
+  ierr = CeedVectorGetMemoryUsage(vec, &vecbytes); CeedChk(ierr);
+  *bytes += vecbytes;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Operator Get Memory Usage
+//------------------------------------------------------------------------------
+static int CeedOperatorGetMemoryUsage_Opt(CeedOperator op, size_t *usage) {
+  int ierr;
+  CeedOperator_Opt *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  // E-vectors are owned by the operator, and counted once when shared between
+  //   inputs; blocked restrictions are counted with the field restrictions
+  for (CeedInt i=0; i<impl->numein+impl->numeout; i++) {
+    if (i < impl->numein && impl->inputshared[i] >= 0)
+      continue;
+    ierr = CeedOperatorAddVectorUsage_Opt(impl->evecs[i],
+                                          &usage[CEED_MEMORY_EVEC]);
+    CeedChk(ierr);
+  }
+  for (CeedInt i=0; i<impl->numein; i++) {
+    if (impl->inputshared[i] < 0) {
+      ierr = CeedOperatorAddVectorUsage_Opt(impl->evecsin[i],
+                                            &usage[CEED_MEMORY_EVEC]);
+      CeedChk(ierr);
+    }
+    ierr = CeedOperatorAddVectorUsage_Opt(impl->qvecsin[i],
+                                          &usage[CEED_MEMORY_QVEC]);
+    CeedChk(ierr);
+    if (impl->qdatafused[i]) {
+      CeedInt length;
+      ierr = CeedVectorGetLength(impl->qvecsfused[i], &length); CeedChk(ierr);
+      usage[CEED_MEMORY_QVEC] += length*sizeof(CeedScalar);
+    }
+    if (impl->ereduced[i]) {
+      CeedInt nblk, blksize, elemsize, ncomp;
+      size_t bytes;
+      ierr = CeedElemRestrictionGetNumBlocks(impl->blkrestr[i], &nblk);
+      CeedChk(ierr);
+      ierr = CeedElemRestrictionGetBlockSize(impl->blkrestr[i], &blksize);
+      CeedChk(ierr);
+      ierr = CeedElemRestrictionGetElementSize(impl->blkrestr[i], &elemsize);
+      CeedChk(ierr);
+      ierr = CeedElemRestrictionGetNumComponents(impl->blkrestr[i], &ncomp);
+      CeedChk(ierr);
+      ierr = CeedFieldPrecisionGetSize(impl->inputprecision[i], &bytes);
+      CeedChk(ierr);
+      usage[CEED_MEMORY_PASSIVE] += (size_t)nblk*blksize*elemsize*ncomp*bytes;
+    }
+  }
+  for (CeedInt i=0; i<impl->numeout; i++) {
+    ierr = CeedOperatorAddVectorUsage_Opt(impl->evecsout[i],
+                                          &usage[CEED_MEMORY_EVEC]);
+    CeedChk(ierr);
+    ierr = CeedOperatorAddVectorUsage_Opt(impl->qvecsout[i],
+                                          &usage[CEED_MEMORY_QVEC]);
+    CeedChk(ierr);
+    ierr = CeedOperatorAddVectorUsage_Opt(impl->escale[i],
+                                          &usage[CEED_MEMORY_EVEC]);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Operator Destroy
 //------------------------------------------------------------------------------
@@ -712,20 +1029,34 @@ static int CeedOperatorDestroy_Opt(CeedOperator op) {
   ierr = CeedFree(&impl->evecs); CeedChk(ierr);
   ierr = CeedFree(&impl->edata); CeedChk(ierr);
   ierr = CeedFree(&impl->inputstate); CeedChk(ierr);
+  ierr = CeedFree(&impl->inputprecision); CeedChk(ierr);
 
   for (CeedInt i=0; i<impl->numein; i++) {
     ierr = CeedVectorDestroy(&impl->evecsin[i]); CeedChk(ierr);
     ierr = CeedVectorDestroy(&impl->qvecsin[i]); CeedChk(ierr);
+    ierr = CeedFree(&impl->ereduced[i]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&impl->ereduced); CeedChk(ierr);
+  for (CeedInt i=0; i<impl->numein; i++) {
+    ierr = CeedVectorDestroy(&impl->qvecsfused[i]); CeedChk(ierr);
+    ierr = CeedFree(&impl->qdatafused[i]); CeedChk(ierr);
   }
   ierr = CeedFree(&impl->evecsin); CeedChk(ierr);
   ierr = CeedFree(&impl->qvecsin); CeedChk(ierr);
+  ierr = CeedFree(&impl->fusedgrad); CeedChk(ierr);
+  ierr = CeedFree(&impl->inputfused); CeedChk(ierr);
+  ierr = CeedFree(&impl->qvecsfused); CeedChk(ierr);
+  ierr = CeedFree(&impl->qdatafused); CeedChk(ierr);
+  ierr = CeedFree(&impl->inputshared); CeedChk(ierr);
 
   for (CeedInt i=0; i<impl->numeout; i++) {
     ierr = CeedVectorDestroy(&impl->evecsout[i]); CeedChk(ierr);
     ierr = CeedVectorDestroy(&impl->qvecsout[i]); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&impl->escale[i]); CeedChk(ierr);
   }
   ierr = CeedFree(&impl->evecsout); CeedChk(ierr);
   ierr = CeedFree(&impl->qvecsout); CeedChk(ierr);
+  ierr = CeedFree(&impl->escale); CeedChk(ierr);
 
   ierr = CeedFree(&impl); CeedChk(ierr);
   return 0;
@@ -756,6 +1087,10 @@ int CeedOperatorCreate_Opt(CeedOperator op) {
   CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd",
                                 CeedOperatorApplyAdd_Opt); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyScaledAdd",
+                                CeedOperatorApplyScaledAdd_Opt); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "GetMemoryUsage",
+                                CeedOperatorGetMemoryUsage_Opt); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
                                 CeedOperatorDestroy_Opt); CeedChk(ierr);
   return 0;
@@ -32,10 +32,18 @@ typedef struct {
   *evecs;   /// E-vectors needed to apply operator (input followed by outputs)
   CeedScalar **edata;
   uint64_t *inputstate;  /// State counter of inputs
+  CeedFieldPrecision *inputprecision; /// Storage precision of inputs
+  void **ereduced;       /// Blocked E-vectors of reduced precision inputs
   CeedVector *evecsin;   /// Input E-vectors needed to apply operator
   CeedVector *evecsout;  /// Output E-vectors needed to apply operator
   CeedVector *qvecsin;   /// Input Q-vectors needed to apply operator
   CeedVector *qvecsout;  /// Output Q-vectors needed to apply operator
+  CeedVector *escale;    /// Scaled output blocked E-vectors
+  CeedInt *fusedgrad;    /// GRAD input evaluated with each INTERP input, or -1
+  bool *inputfused;      /// GRAD inputs evaluated with an INTERP input
+  CeedVector *qvecsfused;    /// Combined INTERP and GRAD input Q-vectors
+  CeedScalar **qdatafused;   /// Arrays of the combined Q-vectors
+  CeedInt *inputshared;  /// Earlier input sharing each input's E-vectors, or -1
   CeedInt    numein;
   CeedInt    numeout;
 } CeedOperator_Opt;
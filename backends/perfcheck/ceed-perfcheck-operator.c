@@ -0,0 +1,345 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include "ceed-perfcheck.h"
+
+//------------------------------------------------------------------------------
+// Setup Operator on Delegate Ceed
+//------------------------------------------------------------------------------
+static int CeedOperatorSetup_Perfcheck(CeedOperator op) {
+  int ierr;
+  CeedOperator_Perfcheck *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  if (impl->op)
+    return 0;
+  Ceed ceed, delegate;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  ierr = CeedGetDelegate(ceed, &delegate); CeedChk(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt numinputfields, numoutputfields, batchsize;
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  CeedOperatorField *opinputfields, *opoutputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
+  CeedChk(ierr);
+  CeedQFunctionField *qfinputfields, *qfoutputfields;
+  ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
+  CeedChk(ierr);
+
+  // Operator with the same fields
+  ierr = CeedOperatorCreate(delegate, qf, CEED_QFUNCTION_NONE,
+                            CEED_QFUNCTION_NONE, &impl->op); CeedChk(ierr);
+  for (CeedInt i=0; i<numinputfields+numoutputfields; i++) {
+    bool isinput = i < numinputfields;
+    CeedOperatorField opfield = isinput ? opinputfields[i] :
+                                opoutputfields[i-numinputfields];
+    CeedQFunctionField qffield = isinput ? qfinputfields[i] :
+                                 qfoutputfields[i-numinputfields];
+    char *fieldname;
+    ierr = CeedQFunctionFieldGetName(qffield, &fieldname); CeedChk(ierr);
+    CeedElemRestriction rstr;
+    ierr = CeedOperatorFieldGetElemRestriction(opfield, &rstr); CeedChk(ierr);
+    CeedBasis basis;
+    ierr = CeedOperatorFieldGetBasis(opfield, &basis); CeedChk(ierr);
+    CeedVector vec;
+    ierr = CeedOperatorFieldGetVector(opfield, &vec); CeedChk(ierr);
+    ierr = CeedOperatorSetField(impl->op, fieldname, rstr, basis, vec);
+    CeedChk(ierr);
+    CeedFieldPrecision precision;
+    ierr = CeedOperatorFieldGetPrecision(opfield, &precision); CeedChk(ierr);
+    if (precision != CEED_PRECISION_SCALAR) {
+      ierr = CeedOperatorSetFieldPrecision(impl->op, fieldname, precision);
+      CeedChk(ierr);
+    }
+    ierr = CeedPerfcheckRegisterRestriction(ceed, rstr); CeedChk(ierr);
+  }
+  ierr = CeedOperatorGetBatchSize(op, &batchsize); CeedChk(ierr);
+  if (batchsize) {
+    ierr = CeedOperatorSetBatchSize(impl->op, batchsize); CeedChk(ierr);
+  }
+  const char *name;
+  ierr = CeedOperatorGetName(op, &name); CeedChk(ierr);
+  if (name) {
+    ierr = CeedOperatorSetName(impl->op, name); CeedChk(ierr);
+  }
+  ierr = CeedPerfcheckRegisterOperator(ceed, qf); CeedChk(ierr);
+  ierr = CeedOperatorSetSetupDone(op); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Track Passive Input State
+//------------------------------------------------------------------------------
+static int CeedOperatorTrackInputs_Perfcheck(CeedOperator op) {
+  int ierr;
+  CeedOperator_Perfcheck *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt numinputfields;
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, NULL); CeedChk(ierr);
+  CeedOperatorField *opinputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, NULL); CeedChk(ierr);
+
+  // Backends restrict passive inputs again when their state changes
+  for (CeedInt i=0; i<numinputfields; i++) {
+    CeedVector vec;
+    ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+    if (vec == CEED_VECTOR_ACTIVE || vec == CEED_VECTOR_NONE)
+      continue;
+    uint64_t state;
+    ierr = CeedVectorGetState(vec, &state); CeedChk(ierr);
+    if (impl->numapplies && state != impl->passivestate[i]) {
+      CeedInt length;
+      ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+      ierr = CeedPerfcheckRecord(ceed, PERFCHECK_PASSIVE_STATE,
+                                 length*sizeof(CeedScalar)); CeedChk(ierr);
+    }
+    impl->passivestate[i] = state;
+  }
+  impl->numapplies++;
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Apply and Add to Output
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Perfcheck(CeedOperator op, CeedVector invec,
+    CeedVector outvec, CeedRequest *request) {
+  int ierr;
+  CeedOperator_Perfcheck *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  ierr = CeedOperatorSetup_Perfcheck(op); CeedChk(ierr);
+  ierr = CeedOperatorTrackInputs_Perfcheck(op); CeedChk(ierr);
+  CeedPerfcheckOperatorDepth(1);
+  ierr = CeedOperatorApplyAdd(impl->op, invec, outvec, request);
+  CeedPerfcheckOperatorDepth(-1);
+  CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Apply and Add Scaled Contributions to Output
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyScaledAdd_Perfcheck(CeedOperator op,
+    CeedVector invec, CeedVector outvec, CeedScalar beta, CeedVector scale,
+    CeedRequest *request) {
+  int ierr;
+  CeedOperator_Perfcheck *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  // The output is already scaled by alpha
+  ierr = CeedOperatorSetup_Perfcheck(op); CeedChk(ierr);
+  ierr = CeedOperatorTrackInputs_Perfcheck(op); CeedChk(ierr);
+  CeedPerfcheckOperatorDepth(1);
+  ierr = CeedOperatorApplyScaledAdd(impl->op, invec, outvec, 1.0, beta, scale,
+                                    request);
+  CeedPerfcheckOperatorDepth(-1);
+  CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Linear QFunction
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunction_Perfcheck(CeedOperator op,
+    CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request) {
+  int ierr;
+  CeedOperator_Perfcheck *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  ierr = CeedOperatorSetup_Perfcheck(op); CeedChk(ierr);
+  CeedPerfcheckOperatorDepth(1);
+  ierr = CeedOperatorLinearAssembleQFunction(impl->op, assembled, rstr,
+         request);
+  CeedPerfcheckOperatorDepth(-1);
+  CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Linear Diagonal
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleAddDiagonal_Perfcheck(CeedOperator op,
+    CeedVector assembled, CeedRequest *request) {
+  int ierr;
+  CeedOperator_Perfcheck *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  ierr = CeedOperatorSetup_Perfcheck(op); CeedChk(ierr);
+  CeedPerfcheckOperatorDepth(1);
+  ierr = CeedOperatorLinearAssembleAddDiagonal(impl->op, assembled, request);
+  CeedPerfcheckOperatorDepth(-1);
+  CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Linear Point Block Diagonal
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleAddPointBlockDiagonal_Perfcheck(
+  CeedOperator op, CeedVector assembled, CeedRequest *request) {
+  int ierr;
+  CeedOperator_Perfcheck *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  ierr = CeedOperatorSetup_Perfcheck(op); CeedChk(ierr);
+  CeedPerfcheckOperatorDepth(1);
+  ierr = CeedOperatorLinearAssembleAddPointBlockDiagonal(impl->op, assembled,
+         request);
+  CeedPerfcheckOperatorDepth(-1);
+  CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Create FDM Element Inverse
+//------------------------------------------------------------------------------
+static int CeedOperatorCreateFDMElementInverse_Perfcheck(CeedOperator op,
+    CeedOperator *fdminv, CeedRequest *request) {
+  int ierr;
+  CeedOperator_Perfcheck *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  ierr = CeedOperatorSetup_Perfcheck(op); CeedChk(ierr);
+  CeedPerfcheckOperatorDepth(1);
+  ierr = CeedOperatorCreateFDMElementInverse(impl->op, fdminv, request);
+  CeedPerfcheckOperatorDepth(-1);
+  CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Get Memory Usage
+//------------------------------------------------------------------------------
+static int CeedOperatorGetMemoryUsage_Perfcheck(CeedOperator op,
+    size_t *usage) {
+  int ierr;
+  CeedOperator_Perfcheck *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  if (!impl->op)
+    return 0;
+
+  // Fields are shared with op, so only backend categories are added
+  for (CeedInt i=0; i<CEED_MEMORY_TOTAL; i++) {
+    if (i == CEED_MEMORY_OFFSETS || i == CEED_MEMORY_BASIS ||
+        i == CEED_MEMORY_PASSIVE)
+      continue;
+    size_t bytes;
+    ierr = CeedOperatorGetMemoryUsage(impl->op, (CeedMemoryCategory)i, &bytes);
+    CeedChk(ierr);
+    usage[i] += bytes;
+  }
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Operator Destroy
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroy_Perfcheck(CeedOperator op) {
+  int ierr;
+  CeedOperator_Perfcheck *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+
+  if (impl->op) {
+    size_t bytes;
+    ierr = CeedOperatorGetMemoryUsage(impl->op, CEED_MEMORY_FALLBACK, &bytes);
+    CeedChk(ierr);
+    if (bytes) {
+      ierr = CeedPerfcheckRecord(ceed, PERFCHECK_FALLBACK, bytes);
+      CeedChk(ierr);
+    }
+    CeedQFunction qf;
+    ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+    ierr = CeedOperatorGetMemoryUsage(impl->op, CEED_MEMORY_TOTAL, &bytes);
+    CeedChk(ierr);
+    ierr = CeedPerfcheckReleaseOperator(ceed, qf, impl->numapplies <= 1, bytes);
+    CeedChk(ierr);
+
+    CeedInt numinputfields, numoutputfields;
+    ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+    CeedChk(ierr);
+    CeedOperatorField *opinputfields, *opoutputfields;
+    ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
+    CeedChk(ierr);
+    for (CeedInt i=0; i<numinputfields+numoutputfields; i++) {
+      CeedElemRestriction rstr;
+      ierr = CeedOperatorFieldGetElemRestriction(i < numinputfields ?
+             opinputfields[i] : opoutputfields[i-numinputfields], &rstr);
+      CeedChk(ierr);
+      ierr = CeedPerfcheckReleaseRestriction(ceed, rstr); CeedChk(ierr);
+    }
+  }
+  ierr = CeedOperatorDestroy(&impl->op); CeedChk(ierr);
+  ierr = CeedFree(&impl); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Operator Create
+//------------------------------------------------------------------------------
+int CeedOperatorCreate_Perfcheck(CeedOperator op) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+
+  CeedOperator_Perfcheck *impl;
+  ierr = CeedCalloc(1, &impl); CeedChk(ierr);
+  ierr = CeedOperatorSetData(op, impl); CeedChk(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunction",
+                                CeedOperatorLinearAssembleQFunction_Perfcheck);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleAddDiagonal",
+                                CeedOperatorLinearAssembleAddDiagonal_Perfcheck);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op,
+                                "LinearAssembleAddPointBlockDiagonal",
+                                CeedOperatorLinearAssembleAddPointBlockDiagonal_Perfcheck);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "CreateFDMElementInverse",
+                                CeedOperatorCreateFDMElementInverse_Perfcheck);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd",
+                                CeedOperatorApplyAdd_Perfcheck); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyScaledAdd",
+                                CeedOperatorApplyScaledAdd_Perfcheck);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "GetMemoryUsage",
+                                CeedOperatorGetMemoryUsage_Perfcheck);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
+                                CeedOperatorDestroy_Perfcheck); CeedChk(ierr);
+
+  return 0;
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,259 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include "ceed-perfcheck.h"
+
+//------------------------------------------------------------------------------
+// Vector Checksum
+//------------------------------------------------------------------------------
+static int CeedVectorChecksum_Perfcheck(CeedVector vec, const CeedScalar *array,
+                                        uint64_t *checksum) {
+  int ierr;
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+
+  *checksum = CeedPerfcheckHash(array, length*sizeof(CeedScalar),
+                                14695981039346656037ULL);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Record Vector Diagnostic
+//------------------------------------------------------------------------------
+static int CeedVectorRecord_Perfcheck(CeedVector vec,
+                                      CeedPerfcheckDiagnostic diag) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+
+  ierr = CeedPerfcheckRecord(ceed, diag, length*sizeof(CeedScalar));
+  CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Vector Set Array
+//------------------------------------------------------------------------------
+static int CeedVectorSetArray_Perfcheck(CeedVector vec, CeedMemType mtype,
+                                        CeedCopyMode cmode, CeedScalar *array) {
+  int ierr;
+  CeedVector_Perfcheck *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+
+  if (cmode == CEED_COPY_VALUES && array) {
+    if (impl->copied) {
+      ierr = CeedVectorRecord_Perfcheck(vec, PERFCHECK_COPY_VALUES);
+      CeedChk(ierr);
+    }
+    impl->copied = true;
+  }
+  impl->valueset = false;
+  ierr = CeedVectorSetArray(impl->vec, mtype, cmode, array); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Vector Set Value
+//------------------------------------------------------------------------------
+static int CeedVectorSetValue_Perfcheck(CeedVector vec, CeedScalar value) {
+  int ierr;
+  CeedVector_Perfcheck *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+
+  // Arrays set with CEED_USE_POINTER may be modified without the vector, so
+  //   the values are checked
+  if (impl->valueset && impl->value == value) {
+    CeedInt length;
+    ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+    const CeedScalar *array;
+    ierr = CeedVectorGetArrayRead(impl->vec, CEED_MEM_HOST, &array);
+    CeedChk(ierr);
+    bool same = true;
+    for (CeedInt i=0; i<length && same; i++)
+      same = array[i] == value;
+    ierr = CeedVectorRestoreArrayRead(impl->vec, &array); CeedChk(ierr);
+    if (same) {
+      ierr = CeedVectorRecord_Perfcheck(vec, PERFCHECK_SET_VALUE);
+      CeedChk(ierr);
+    }
+  }
+  ierr = CeedVectorSetValue(impl->vec, value); CeedChk(ierr);
+  impl->valueset = true;
+  impl->value = value;
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Vector Take Array
+//------------------------------------------------------------------------------
+static int CeedVectorTakeArray_Perfcheck(CeedVector vec, CeedMemType mtype,
+    CeedScalar **array) {
+  int ierr;
+  CeedVector_Perfcheck *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+
+  impl->valueset = false;
+  ierr = CeedVectorTakeArray(impl->vec, mtype, array); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Vector Get Array
+//------------------------------------------------------------------------------
+static int CeedVectorGetArray_Perfcheck(CeedVector vec, CeedMemType mtype,
+                                        CeedScalar **array) {
+  int ierr;
+  CeedVector_Perfcheck *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+
+  ierr = CeedVectorGetArray(impl->vec, mtype, array); CeedChk(ierr);
+  impl->array = *array;
+  impl->mtype = mtype;
+  impl->valuesetarray = impl->valueset;
+  impl->valueset = false;
+  if (mtype == CEED_MEM_HOST) {
+    ierr = CeedVectorChecksum_Perfcheck(vec, *array, &impl->checksum);
+    CeedChk(ierr);
+  }
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Vector Get Array Read
+//------------------------------------------------------------------------------
+static int CeedVectorGetArrayRead_Perfcheck(CeedVector vec, CeedMemType mtype,
+    const CeedScalar **array) {
+  int ierr;
+  CeedVector_Perfcheck *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+
+  ierr = CeedVectorGetArrayRead(impl->vec, mtype, array); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Vector Restore Array
+//------------------------------------------------------------------------------
+static int CeedVectorRestoreArray_Perfcheck(CeedVector vec) {
+  int ierr;
+  CeedVector_Perfcheck *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+
+  if (impl->mtype == CEED_MEM_HOST) {
+    uint64_t checksum;
+    ierr = CeedVectorChecksum_Perfcheck(vec, impl->array, &checksum);
+    CeedChk(ierr);
+    if (checksum == impl->checksum) {
+      ierr = CeedVectorRecord_Perfcheck(vec, PERFCHECK_GET_ARRAY);
+      CeedChk(ierr);
+      impl->valueset = impl->valuesetarray;
+    }
+  }
+  ierr = CeedVectorRestoreArray(impl->vec, &impl->array); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Vector Restore Array Read
+//------------------------------------------------------------------------------
+static int CeedVectorRestoreArrayRead_Perfcheck(CeedVector vec) {
+  int ierr;
+  CeedVector_Perfcheck *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+
+  const CeedScalar *array = NULL;
+  ierr = CeedVectorRestoreArrayRead(impl->vec, &array); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Vector Memory Usage
+//------------------------------------------------------------------------------
+static int CeedVectorGetMemoryUsage_Perfcheck(CeedVector vec, size_t *bytes) {
+  int ierr;
+  CeedVector_Perfcheck *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+
+  ierr = CeedVectorGetMemoryUsage(impl->vec, bytes); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Vector Destroy
+//------------------------------------------------------------------------------
+static int CeedVectorDestroy_Perfcheck(CeedVector vec) {
+  int ierr;
+  CeedVector_Perfcheck *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+
+  ierr = CeedVectorDestroy(&impl->vec); CeedChk(ierr);
+  ierr = CeedFree(&impl); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Vector Create
+//------------------------------------------------------------------------------
+int CeedVectorCreate_Perfcheck(CeedInt n, CeedVector vec) {
+  int ierr;
+  Ceed ceed, delegate;
+  ierr = CeedVectorGetCeed(vec, &ceed); CeedChk(ierr);
+  ierr = CeedGetDelegate(ceed, &delegate); CeedChk(ierr);
+
+  CeedVector_Perfcheck *impl;
+  ierr = CeedCalloc(1, &impl); CeedChk(ierr);
+  ierr = CeedVectorCreate(delegate, n, &impl->vec); CeedChk(ierr);
+  ierr = CeedVectorSetData(vec, impl); CeedChk(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "SetArray",
+                                CeedVectorSetArray_Perfcheck); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "SetValue",
+                                CeedVectorSetValue_Perfcheck); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "TakeArray",
+                                CeedVectorTakeArray_Perfcheck); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "GetArray",
+                                CeedVectorGetArray_Perfcheck); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "GetArrayRead",
+                                CeedVectorGetArrayRead_Perfcheck);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "RestoreArray",
+                                CeedVectorRestoreArray_Perfcheck);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "RestoreArrayRead",
+                                CeedVectorRestoreArrayRead_Perfcheck);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "GetMemoryUsage",
+                                CeedVectorGetMemoryUsage_Perfcheck);
+  CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Destroy",
+                                CeedVectorDestroy_Perfcheck); CeedChk(ierr);
+
+  return 0;
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,352 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "ceed-perfcheck.h"
+
+// Tables are shared by operators set up and destroyed from different threads,
+//   while the nesting of operator calls is tracked per thread
+#if defined(__GNUC__) || defined(__clang__)
+#  define CeedPerfcheckLock(data) \
+  while (__atomic_test_and_set(&(data)->lock, __ATOMIC_ACQUIRE)) {}
+#  define CeedPerfcheckUnlock(data) \
+  __atomic_clear(&(data)->lock, __ATOMIC_RELEASE)
+#  define CeedThreadLocal __thread
+#else
+#  define CeedPerfcheckLock(data)
+#  define CeedPerfcheckUnlock(data)
+#  define CeedThreadLocal
+#endif
+static CeedThreadLocal CeedInt ceed_perfcheck_depth;
+
+static const char *const CeedPerfcheckMessages[] = {
+  [PERFCHECK_COPY_VALUES] = "CeedVectorSetArray with CEED_COPY_VALUES "
+  "repeated on one vector; use CEED_USE_POINTER or write through "
+  "CeedVectorGetArray",
+  [PERFCHECK_GET_ARRAY] = "CeedVectorGetArray without modifying the array; "
+  "use CeedVectorGetArrayRead, which keeps the vector state unchanged",
+  [PERFCHECK_SET_VALUE] = "CeedVectorSetValue on a vector already holding the "
+  "value, such as zeroing the output of CeedOperatorApply, which zeros it",
+  [PERFCHECK_SINGLE_APPLY] = "operators with the same CeedQFunction set up for "
+  "a single application; create operators once and apply them repeatedly",
+  [PERFCHECK_FALLBACK] = "operator assembly fell back to another backend, "
+  "which sets up a second operator",
+  [PERFCHECK_PASSIVE_STATE] = "passive operator inputs modified between "
+  "applications, so they are restricted again",
+  [PERFCHECK_DUPLICATE_RESTRICTION] = "distinct CeedElemRestrictions with "
+  "identical offsets; share one restriction so blocked offsets and "
+  "restricted inputs are reused",
+};
+
+//------------------------------------------------------------------------------
+// Checksum of an array, in words of 8 bytes
+//------------------------------------------------------------------------------
+uint64_t CeedPerfcheckHash(const void *data, size_t bytes, uint64_t hash) {
+  const unsigned char *p = data;
+  for (size_t i=0; i<bytes; i+=8) {
+    uint64_t word = 0;
+    memcpy(&word, p+i, bytes-i < 8 ? bytes-i : 8);
+    hash = (hash ^ word) * 1099511628211ULL;
+  }
+  return hash;
+}
+
+//------------------------------------------------------------------------------
+// Enter or Leave Operator Call on This Thread
+//------------------------------------------------------------------------------
+void CeedPerfcheckOperatorDepth(CeedInt change) {
+  ceed_perfcheck_depth += change;
+}
+
+//------------------------------------------------------------------------------
+// Record Diagnostic
+//------------------------------------------------------------------------------
+int CeedPerfcheckRecord(Ceed ceed, CeedPerfcheckDiagnostic diag,
+                        size_t bytes) {
+  int ierr;
+  Ceed_Perfcheck *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+
+  // Vector access by backends applying operators is not diagnosed
+  if (diag <= PERFCHECK_SET_VALUE && ceed_perfcheck_depth)
+    return 0;
+
+  CeedPerfcheckLock(data);
+  data->counts[diag].count++;
+  data->counts[diag].bytes += bytes;
+  CeedPerfcheckUnlock(data);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Register Operator by QFunction
+//------------------------------------------------------------------------------
+int CeedPerfcheckRegisterOperator(Ceed ceed, CeedQFunction qf) {
+  int ierr;
+  Ceed_Perfcheck *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+
+  // Operators are counted by QFunction, as setup operators are applied once
+  CeedPerfcheckLock(data);
+  for (CeedInt i=0; i<data->numsingleapply; i++)
+    if (data->singleapply[i].qf == qf) {
+      data->singleapply[i].numoperators++;
+      CeedPerfcheckUnlock(data);
+      return 0;
+    }
+  ierr = CeedRealloc(data->numsingleapply+1, &data->singleapply);
+  if (!ierr) {
+    data->singleapply[data->numsingleapply].qf = qf;
+    data->singleapply[data->numsingleapply].numoperators = 1;
+    data->singleapply[data->numsingleapply].count = 0;
+    data->singleapply[data->numsingleapply].bytes = 0;
+    data->numsingleapply++;
+  }
+  CeedPerfcheckUnlock(data);
+  CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Release Operator, Applied Once or More
+//------------------------------------------------------------------------------
+int CeedPerfcheckReleaseOperator(Ceed ceed, CeedQFunction qf,
+                                 bool singleapply, size_t bytes) {
+  int ierr;
+  Ceed_Perfcheck *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+
+  CeedPerfcheckLock(data);
+  for (CeedInt i=0; i<data->numsingleapply; i++) {
+    CeedPerfcheckSingleApply *entry = &data->singleapply[i];
+    if (entry->qf != qf)
+      continue;
+    if (singleapply) {
+      entry->count++;
+      entry->bytes += bytes;
+    }
+    if (--entry->numoperators)
+      break;
+
+    // Diagnose once the last operator using qf is destroyed
+    if (entry->count > 1) {
+      data->counts[PERFCHECK_SINGLE_APPLY].count += entry->count;
+      data->counts[PERFCHECK_SINGLE_APPLY].bytes += entry->bytes;
+    }
+    *entry = data->singleapply[--data->numsingleapply];
+    if (!data->numsingleapply)
+      ierr = CeedFree(&data->singleapply);
+    break;
+  }
+  CeedPerfcheckUnlock(data);
+  CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Register Restriction Used by an Operator Field
+//------------------------------------------------------------------------------
+int CeedPerfcheckRegisterRestriction(Ceed ceed, CeedElemRestriction rstr) {
+  int ierr;
+  Ceed_Perfcheck *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+  bool isstrided;
+
+  if (rstr == CEED_ELEMRESTRICTION_NONE)
+    return 0;
+  ierr = CeedElemRestrictionIsStrided(rstr, &isstrided); CeedChk(ierr);
+  if (isstrided)
+    return 0;
+
+  // Hash of sizes and offsets
+  CeedInt sizes[6];
+  ierr = CeedElemRestrictionGetNumBlocks(rstr, &sizes[0]); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetBlockSize(rstr, &sizes[1]); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(rstr, &sizes[2]); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(rstr, &sizes[3]); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetCompStride(rstr, &sizes[4]); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetLVectorSize(rstr, &sizes[5]); CeedChk(ierr);
+  size_t bytes = (size_t)sizes[0]*sizes[1]*sizes[2]*sizeof(CeedInt);
+  const CeedInt *offsets;
+  ierr = CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets);
+  CeedChk(ierr);
+  uint64_t hash = CeedPerfcheckHash(sizes, sizeof(sizes),
+                                    14695981039346656037ULL);
+  hash = CeedPerfcheckHash(offsets, bytes, hash);
+  ierr = CeedElemRestrictionRestoreOffsets(rstr, &offsets); CeedChk(ierr);
+
+  // Compare with restrictions of operators not yet destroyed
+  bool duplicate = false;
+  CeedPerfcheckLock(data);
+  for (CeedInt i=0; i<data->numrstrs; i++) {
+    if (data->rstrs[i].rstr == rstr) {
+      data->rstrs[i].numfields++;
+      CeedPerfcheckUnlock(data);
+      return 0;
+    }
+    duplicate |= data->rstrs[i].hash == hash;
+  }
+  ierr = CeedRealloc(data->numrstrs+1, &data->rstrs);
+  if (!ierr) {
+    data->rstrs[data->numrstrs].rstr = rstr;
+    data->rstrs[data->numrstrs].numfields = 1;
+    data->rstrs[data->numrstrs].hash = hash;
+    data->numrstrs++;
+  }
+  CeedPerfcheckUnlock(data);
+  CeedChk(ierr);
+  if (duplicate) {
+    ierr = CeedPerfcheckRecord(ceed, PERFCHECK_DUPLICATE_RESTRICTION, bytes);
+    CeedChk(ierr);
+  }
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Release Restriction Used by an Operator Field
+//------------------------------------------------------------------------------
+int CeedPerfcheckReleaseRestriction(Ceed ceed, CeedElemRestriction rstr) {
+  int ierr;
+  Ceed_Perfcheck *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+
+  CeedPerfcheckLock(data);
+  for (CeedInt i=0; i<data->numrstrs; i++)
+    if (data->rstrs[i].rstr == rstr) {
+      if (--data->rstrs[i].numfields)
+        break;
+      data->rstrs[i] = data->rstrs[--data->numrstrs];
+      if (!data->numrstrs)
+        ierr = CeedFree(&data->rstrs);
+      break;
+    }
+  CeedPerfcheckUnlock(data);
+  CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Report Diagnostics
+//------------------------------------------------------------------------------
+static int CeedPerfcheckReport(Ceed_Perfcheck *data, FILE *stream) {
+  CeedInt order[PERFCHECK_NUM_DIAGNOSTICS], numdiags = 0;
+
+  // Operators not destroyed before the Ceed
+  for (CeedInt i=0; i<data->numsingleapply; i++)
+    if (data->singleapply[i].count > 1) {
+      data->counts[PERFCHECK_SINGLE_APPLY].count += data->singleapply[i].count;
+      data->counts[PERFCHECK_SINGLE_APPLY].bytes += data->singleapply[i].bytes;
+    }
+
+  // Rank by estimated excess memory traffic, then by count
+  for (CeedInt i=0; i<PERFCHECK_NUM_DIAGNOSTICS; i++) {
+    if (!data->counts[i].count)
+      continue;
+    CeedInt j = numdiags++;
+    for (; j>0; j--) {
+      CeedPerfcheckCount *a = &data->counts[i], *b = &data->counts[order[j-1]];
+      if (a->bytes < b->bytes || (a->bytes == b->bytes && a->count <= b->count))
+        break;
+      order[j] = order[j-1];
+    }
+    order[j] = i;
+  }
+  if (!numdiags)
+    return 0;
+
+  fprintf(stream, "perfcheck: %d performance diagnostics, ranked by estimated "
+          "excess memory traffic\n", numdiags);
+  for (CeedInt i=0; i<numdiags; i++)
+    fprintf(stream, "perfcheck: %2d. %6d times, %10zu bytes: %s\n", i+1,
+            data->counts[order[i]].count, data->counts[order[i]].bytes,
+            CeedPerfcheckMessages[order[i]]);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Backend Destroy
+//------------------------------------------------------------------------------
+static int CeedDestroy_Perfcheck(Ceed ceed) {
+  int ierr;
+  Ceed_Perfcheck *data;
+  ierr = CeedGetData(ceed, &data); CeedChk(ierr);
+
+  // Report to the file named by CEED_PERFCHECK_FILE, or to stderr
+  const char *filename = getenv("CEED_PERFCHECK_FILE");
+  FILE *stream = filename ? fopen(filename, "a") : stderr;
+  if (!stream)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Unable to open perfcheck report file %s",
+                     filename);
+  // LCOV_EXCL_STOP
+  ierr = CeedPerfcheckReport(data, stream); CeedChk(ierr);
+  if (filename)
+    fclose(stream);
+  ierr = CeedFree(&data->singleapply); CeedChk(ierr);
+  ierr = CeedFree(&data->rstrs); CeedChk(ierr);
+  ierr = CeedFree(&data); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Backend Init
+//------------------------------------------------------------------------------
+static int CeedInit_Perfcheck(const char *resource, Ceed ceed) {
+  int ierr;
+  if (strcmp(resource, "/cpu/self/perfcheck")
+      && strcmp(resource, "/cpu/self/perfcheck/blocked"))
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Perfcheck backend cannot use resource: %s",
+                     resource);
+  // LCOV_EXCL_STOP
+  ierr = CeedSetDeterministic(ceed, true); CeedChk(ierr);
+
+  // Create optimized CEED that implementation will be dispatched
+  //   through unless overridden
+  Ceed ceedopt;
+  CeedInit("/cpu/self/opt/blocked", &ceedopt);
+  ierr = CeedSetDelegate(ceed, ceedopt); CeedChk(ierr);
+
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy",
+                                CeedDestroy_Perfcheck); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "VectorCreate",
+                                CeedVectorCreate_Perfcheck); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Ceed", ceed, "OperatorCreate",
+                                CeedOperatorCreate_Perfcheck); CeedChk(ierr);
+
+  Ceed_Perfcheck *data;
+  ierr = CeedCalloc(1, &data); CeedChk(ierr);
+  ierr = CeedSetData(ceed, data); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Backend Register
+//------------------------------------------------------------------------------
+__attribute__((constructor))
+static void Register(void) {
+  CeedRegister("/cpu/self/perfcheck/blocked", CeedInit_Perfcheck, 120);
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,105 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <ceed-backend.h>
+#include <stdint.h>
+#include <string.h>
+
+/// Performance anti-patterns reported by the perfcheck backend
+typedef enum {
+  /// CeedVectorSetArray with CEED_COPY_VALUES repeated on one vector
+  PERFCHECK_COPY_VALUES = 0,
+  /// CeedVectorGetArray without modifying the array
+  PERFCHECK_GET_ARRAY = 1,
+  /// CeedVectorSetValue on a vector already holding the value
+  PERFCHECK_SET_VALUE = 2,
+  /// Operators set up for a single application
+  PERFCHECK_SINGLE_APPLY = 3,
+  /// Operator assembly falling back to another backend
+  PERFCHECK_FALLBACK = 4,
+  /// Passive inputs modified between operator applications
+  PERFCHECK_PASSIVE_STATE = 5,
+  /// Distinct restrictions with identical offsets
+  PERFCHECK_DUPLICATE_RESTRICTION = 6,
+  PERFCHECK_NUM_DIAGNOSTICS = 7,
+} CeedPerfcheckDiagnostic;
+
+typedef struct {
+  CeedInt count;
+  size_t bytes; /// Estimated excess memory traffic
+} CeedPerfcheckCount;
+
+typedef struct {
+  CeedQFunction qf;
+  CeedInt numoperators; /// Operators using qf that are not yet destroyed
+  CeedInt count;
+  size_t bytes;
+} CeedPerfcheckSingleApply;
+
+typedef struct {
+  CeedElemRestriction rstr;
+  CeedInt numfields;    /// Operator fields using rstr
+  uint64_t hash;
+} CeedPerfcheckRestriction;
+
+typedef struct {
+  CeedPerfcheckCount counts[PERFCHECK_NUM_DIAGNOSTICS];
+  bool lock;                             /// Lock of the tables below
+  CeedPerfcheckSingleApply *singleapply; /// Single apply operators by QFunction
+  CeedInt numsingleapply;
+  CeedPerfcheckRestriction *rstrs;       /// Restrictions used by operators
+  CeedInt numrstrs;
+} Ceed_Perfcheck;
+
+typedef struct {
+  CeedVector vec;     /// Vector on the delegate Ceed holding the data
+  CeedScalar *array;  /// Array with read-write access
+  CeedMemType mtype;  /// Memory type of read-write access
+  uint64_t checksum;  /// Checksum of the host array at CeedVectorGetArray
+  bool copied;        /// Array was set with CEED_COPY_VALUES
+  bool valueset;      /// All entries hold value since CeedVectorSetValue
+  bool valuesetarray; /// valueset before read-write access
+  CeedScalar value;
+} CeedVector_Perfcheck;
+
+typedef struct {
+  CeedOperator op;            /// Operator on the delegate Ceed, built at setup
+  CeedInt numapplies;
+  uint64_t passivestate[16];  /// State of passive inputs at the last apply
+} CeedOperator_Perfcheck;
+
+CEED_INTERN uint64_t CeedPerfcheckHash(const void *data, size_t bytes,
+                                       uint64_t hash);
+
+CEED_INTERN void CeedPerfcheckOperatorDepth(CeedInt change);
+
+CEED_INTERN int CeedPerfcheckRecord(Ceed ceed, CeedPerfcheckDiagnostic diag,
+                                    size_t bytes);
+
+CEED_INTERN int CeedPerfcheckRegisterOperator(Ceed ceed, CeedQFunction qf);
+
+CEED_INTERN int CeedPerfcheckReleaseOperator(Ceed ceed, CeedQFunction qf,
+    bool singleapply, size_t bytes);
+
+CEED_INTERN int CeedPerfcheckRegisterRestriction(Ceed ceed,
+    CeedElemRestriction rstr);
+
+CEED_INTERN int CeedPerfcheckReleaseRestriction(Ceed ceed,
+    CeedElemRestriction rstr);
+
+CEED_INTERN int CeedVectorCreate_Perfcheck(CeedInt n, CeedVector vec);
+
+CEED_INTERN int CeedOperatorCreate_Perfcheck(CeedOperator op);
@@ -17,11 +17,196 @@
 #include "ceed-ref.h"
 
 //------------------------------------------------------------------------------
-// Basis Apply
+// Collapsed Coordinate Basis Sum Factorization
 //------------------------------------------------------------------------------
-static int CeedBasisApply_Ref(CeedBasis basis, CeedInt nelem,
-                              CeedTransposeMode tmode, CeedEvalMode emode,
-                              CeedVector U, CeedVector V) {
+static void CeedBasisCollapsedContract_Ref(CeedInt dim, CeedInt P1d,
+    CeedInt Q1d, CeedInt P, const CeedScalar *const *tab,
+    CeedTransposeMode tmode, const CeedScalar *in, CeedScalar *out,
+    CeedScalar *work) {
+  const CeedInt npairs = P1d*(P1d+1)/2;
+  const CeedScalar *A = tab[0], *B = tab[1], *C = tab[2];
+  CeedScalar *t1 = work, *t2 = work + npairs*Q1d;
+
+  if (dim == 2) {
+    if (tmode == CEED_NOTRANSPOSE) {
+      // t2[p][j] = sum_q B[j][pq] in[pq]
+      for (CeedInt p=0, pq=0; p<P1d; pq+=P1d-p, p++)
+        for (CeedInt j=0; j<Q1d; j++) {
+          CeedScalar sum = 0;
+          for (CeedInt q=0; q<P1d-p; q++)
+            sum += B[j*P+pq+q] * in[pq+q];
+          t2[p*Q1d+j] = sum;
+        }
+      // out[j][i] = sum_p A[i][p] t2[p][j]
+      for (CeedInt j=0; j<Q1d; j++)
+        for (CeedInt i=0; i<Q1d; i++) {
+          CeedScalar sum = 0;
+          for (CeedInt p=0; p<P1d; p++)
+            sum += A[i*P1d+p] * t2[p*Q1d+j];
+          out[i+Q1d*j] = sum;
+        }
+    } else {
+      for (CeedInt p=0; p<P1d; p++)
+        for (CeedInt j=0; j<Q1d; j++) {
+          CeedScalar sum = 0;
+          for (CeedInt i=0; i<Q1d; i++)
+            sum += A[i*P1d+p] * in[i+Q1d*j];
+          t2[p*Q1d+j] = sum;
+        }
+      for (CeedInt p=0, pq=0; p<P1d; p++)
+        for (CeedInt q=0; q<P1d-p; q++, pq++) {
+          CeedScalar sum = 0;
+          for (CeedInt j=0; j<Q1d; j++)
+            sum += B[j*P+pq] * t2[p*Q1d+j];
+          out[pq] += sum;
+        }
+    }
+  } else {
+    if (tmode == CEED_NOTRANSPOSE) {
+      // t1[pq][k] = sum_r C[k][pqr] in[pqr]
+      for (CeedInt p=0, pq=0, m=0; p<P1d; p++)
+        for (CeedInt q=0; q<P1d-p; m+=P1d-p-q, q++, pq++)
+          for (CeedInt k=0; k<Q1d; k++) {
+            CeedScalar sum = 0;
+            for (CeedInt r=0; r<P1d-p-q; r++)
+              sum += C[k*P+m+r] * in[m+r];
+            t1[pq*Q1d+k] = sum;
+          }
+      // t2[p][j][k] = sum_q B[j][pq] t1[pq][k]
+      for (CeedInt p=0, pq=0; p<P1d; pq+=P1d-p, p++)
+        for (CeedInt j=0; j<Q1d; j++)
+          for (CeedInt k=0; k<Q1d; k++) {
+            CeedScalar sum = 0;
+            for (CeedInt q=0; q<P1d-p; q++)
+              sum += B[j*npairs+pq+q] * t1[(pq+q)*Q1d+k];
+            t2[(p*Q1d+j)*Q1d+k] = sum;
+          }
+      // out[k][j][i] = sum_p A[i][p] t2[p][j][k]
+      for (CeedInt k=0; k<Q1d; k++)
+        for (CeedInt j=0; j<Q1d; j++)
+          for (CeedInt i=0; i<Q1d; i++) {
+            CeedScalar sum = 0;
+            for (CeedInt p=0; p<P1d; p++)
+              sum += A[i*P1d+p] * t2[(p*Q1d+j)*Q1d+k];
+            out[i+Q1d*(j+Q1d*k)] = sum;
+          }
+    } else {
+      for (CeedInt p=0; p<P1d; p++)
+        for (CeedInt j=0; j<Q1d; j++)
+          for (CeedInt k=0; k<Q1d; k++) {
+            CeedScalar sum = 0;
+            for (CeedInt i=0; i<Q1d; i++)
+              sum += A[i*P1d+p] * in[i+Q1d*(j+Q1d*k)];
+            t2[(p*Q1d+j)*Q1d+k] = sum;
+          }
+      for (CeedInt p=0, pq=0; p<P1d; p++)
+        for (CeedInt q=0; q<P1d-p; q++, pq++)
+          for (CeedInt k=0; k<Q1d; k++) {
+            CeedScalar sum = 0;
+            for (CeedInt j=0; j<Q1d; j++)
+              sum += B[j*npairs+pq] * t2[(p*Q1d+j)*Q1d+k];
+            t1[pq*Q1d+k] = sum;
+          }
+      for (CeedInt p=0, pq=0, m=0; p<P1d; p++)
+        for (CeedInt q=0; q<P1d-p; q++, pq++)
+          for (CeedInt r=0; r<P1d-p-q; r++, m++) {
+            CeedScalar sum = 0;
+            for (CeedInt k=0; k<Q1d; k++)
+              sum += C[k*P+m] * t1[pq*Q1d+k];
+            out[m] += sum;
+          }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Collapsed Coordinate Basis Apply to Arrays
+//------------------------------------------------------------------------------
+static int CeedBasisApplyCollapsed_Ref(CeedBasis basis, CeedInt nelem,
+                                       CeedTransposeMode tmode,
+                                       CeedEvalMode emode,
+                                       const CeedScalar *u, CeedScalar *v) {
+  int ierr;
+  CeedInt dim, ncomp, P, Q, P1d, Q1d;
+  ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
+  ierr = CeedBasisGetNumComponents(basis, &ncomp); CeedChk(ierr);
+  ierr = CeedBasisGetNumNodes(basis, &P); CeedChk(ierr);
+  ierr = CeedBasisGetNumQuadraturePoints(basis, &Q); CeedChk(ierr);
+  const CeedScalar *x1d, *interp[3] = {NULL, NULL, NULL},
+                          *deriv[3] = {NULL, NULL, NULL};
+  ierr = CeedBasisGetCollapsedData(basis, &P1d, &Q1d, &x1d, interp, deriv);
+  CeedChk(ierr);
+  // Work arrays are per call, as bases are shared between operators applied
+  //   from different threads
+  CeedScalar c[P + 3*Q + P1d*(P1d+1)/2*Q1d + P1d*Q1d*Q1d], *uq = c + P,
+             *work = uq + 3*Q;
+  const CeedInt dimstride = Q*ncomp*nelem;
+  const bool grad = emode == CEED_EVAL_GRAD;
+
+  for (CeedInt a=0; a<ncomp; a++)
+    for (CeedInt e=0; e<nelem; e++) {
+      if (tmode == CEED_NOTRANSPOSE) {
+        for (CeedInt m=0; m<P; m++)
+          c[m] = u[(a*P+m)*nelem+e];
+        for (CeedInt d=0; d<(grad ? dim : 1); d++) {
+          const CeedScalar *tab[3] = {interp[0], interp[1], interp[2]};
+          if (grad)
+            tab[d] = deriv[d];
+          CeedBasisCollapsedContract_Ref(dim, P1d, Q1d, P, tab, tmode, c,
+                                         &uq[d*Q], work);
+        }
+        for (CeedInt pt=0; pt<Q; pt++) {
+          if (!grad) {
+            v[(a*Q+pt)*nelem+e] = uq[pt];
+            continue;
+          }
+          // Chain rule for the collapsed coordinates
+          const CeedScalar s = x1d[pt%Q1d], t = x1d[(pt/Q1d)%Q1d],
+                           r = dim == 3 ? x1d[pt/(Q1d*Q1d)] : 0;
+          const CeedScalar ds = uq[pt]/((1-t)*(1-r)), dt = uq[Q+pt]/(1-r);
+          v[(a*Q+pt)*nelem+e] = ds;
+          v[dimstride+(a*Q+pt)*nelem+e] = s*ds + dt;
+          if (dim == 3)
+            v[2*dimstride+(a*Q+pt)*nelem+e] = s*ds + t*dt + uq[2*Q+pt];
+        }
+      } else {
+        for (CeedInt pt=0; pt<Q; pt++) {
+          if (!grad) {
+            uq[pt] = u[(a*Q+pt)*nelem+e];
+            continue;
+          }
+          // Transpose of the chain rule
+          const CeedScalar s = x1d[pt%Q1d], t = x1d[(pt/Q1d)%Q1d],
+                           r = dim == 3 ? x1d[pt/(Q1d*Q1d)] : 0;
+          const CeedScalar gx = u[(a*Q+pt)*nelem+e],
+                           gy = u[dimstride+(a*Q+pt)*nelem+e],
+                           gz = dim == 3 ? u[2*dimstride+(a*Q+pt)*nelem+e] : 0;
+          uq[pt] = (gx + s*(gy + gz))/((1-t)*(1-r));
+          uq[Q+pt] = (gy + t*gz)/(1-r);
+          uq[2*Q+pt] = gz;
+        }
+        for (CeedInt m=0; m<P; m++)
+          c[m] = 0;
+        for (CeedInt d=0; d<(grad ? dim : 1); d++) {
+          const CeedScalar *tab[3] = {interp[0], interp[1], interp[2]};
+          if (grad)
+            tab[d] = deriv[d];
+          CeedBasisCollapsedContract_Ref(dim, P1d, Q1d, P, tab, tmode,
+                                         &uq[d*Q], c, work);
+        }
+        for (CeedInt m=0; m<P; m++)
+          v[(a*P+m)*nelem+e] += c[m];
+      }
+    }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Basis Apply to Arrays
+//------------------------------------------------------------------------------
+static int CeedBasisApplyCore_Ref(CeedBasis basis, CeedInt nelem,
+                                  CeedTransposeMode tmode, CeedEvalMode emode,
+                                  const CeedScalar *u, CeedScalar *v) {
   int ierr;
   Ceed ceed;
   ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
@@ -33,24 +218,6 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt nelem,
   CeedTensorContract contract;
   ierr = CeedBasisGetTensorContract(basis, &contract); CeedChk(ierr);
   const CeedInt add = (tmode == CEED_TRANSPOSE);
-  const CeedScalar *u;
-  CeedScalar *v;
-  if (U != CEED_VECTOR_NONE) {
-    ierr = CeedVectorGetArrayRead(U, CEED_MEM_HOST, &u); CeedChk(ierr);
-  } else if (emode != CEED_EVAL_WEIGHT) {
-    // LCOV_EXCL_START
-    return CeedError(ceed, 1,
-                     "An input vector is required for this CeedEvalMode");
-    // LCOV_EXCL_STOP
-  }
-  ierr = CeedVectorGetArray(V, CEED_MEM_HOST, &v); CeedChk(ierr);
-
-  // Clear v if operating in transpose
-  if (tmode == CEED_TRANSPOSE) {
-    const CeedInt vsize = nelem*ncomp*nnodes;
-    for (CeedInt i = 0; i < vsize; i++)
-      v[i] = (CeedScalar) 0.0;
-  }
   bool tensorbasis;
   ierr = CeedBasisIsTensor(basis, &tensorbasis); CeedChk(ierr);
   // Tensor basis
@@ -229,6 +396,10 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt nelem,
     }
   } else {
     // Non-tensor basis
+    bool collapsed;
+    ierr = CeedBasisIsCollapsed(basis, &collapsed); CeedChk(ierr);
+    if (collapsed && (emode == CEED_EVAL_INTERP || emode == CEED_EVAL_GRAD))
+      return CeedBasisApplyCollapsed_Ref(basis, nelem, tmode, emode, u, v);
     switch (emode) {
     // Interpolate to/from quadrature points
     case CEED_EVAL_INTERP: {
@@ -293,6 +464,43 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt nelem,
       // LCOV_EXCL_STOP
     }
   }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Basis Apply
+//------------------------------------------------------------------------------
+static int CeedBasisApply_Ref(CeedBasis basis, CeedInt nelem,
+                              CeedTransposeMode tmode, CeedEvalMode emode,
+                              CeedVector U, CeedVector V) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedBasisGetCeed(basis, &ceed); CeedChk(ierr);
+  CeedInt ncomp, nnodes;
+  ierr = CeedBasisGetNumComponents(basis, &ncomp); CeedChk(ierr);
+  ierr = CeedBasisGetNumNodes(basis, &nnodes); CeedChk(ierr);
+  const CeedScalar *u = NULL;
+  CeedScalar *v;
+  if (U != CEED_VECTOR_NONE) {
+    ierr = CeedVectorGetArrayRead(U, CEED_MEM_HOST, &u); CeedChk(ierr);
+  } else if (emode != CEED_EVAL_WEIGHT) {
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1,
+                     "An input vector is required for this CeedEvalMode");
+    // LCOV_EXCL_STOP
+  }
+  ierr = CeedVectorGetArray(V, CEED_MEM_HOST, &v); CeedChk(ierr);
+
+  // Clear v if operating in transpose
+  if (tmode == CEED_TRANSPOSE) {
+    const CeedInt vsize = nelem*ncomp*nnodes;
+    for (CeedInt i = 0; i < vsize; i++)
+      v[i] = (CeedScalar) 0.0;
+  }
+
+  ierr = CeedBasisApplyCore_Ref(basis, nelem, tmode, emode, u, v);
+  CeedChk(ierr);
+
   if (U != CEED_VECTOR_NONE) {
     ierr = CeedVectorRestoreArrayRead(U, &u); CeedChk(ierr);
   }
@@ -300,6 +508,141 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt nelem,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Basis Apply Interpolation and Gradient
+//------------------------------------------------------------------------------
+static int CeedBasisApplyInterpGrad_Ref(CeedBasis basis, CeedInt nelem,
+                                        CeedTransposeMode tmode, CeedVector U,
+                                        CeedVector V) {
+  int ierr;
+  CeedInt dim, ncomp, nnodes, nqpt;
+  ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
+  ierr = CeedBasisGetNumComponents(basis, &ncomp); CeedChk(ierr);
+  ierr = CeedBasisGetNumNodes(basis, &nnodes); CeedChk(ierr);
+  ierr = CeedBasisGetNumQuadraturePoints(basis, &nqpt); CeedChk(ierr);
+  CeedTensorContract contract;
+  ierr = CeedBasisGetTensorContract(basis, &contract); CeedChk(ierr);
+  CeedBasis_Ref *impl;
+  ierr = CeedBasisGetData(basis, &impl); CeedChk(ierr);
+  bool tensorbasis;
+  ierr = CeedBasisIsTensor(basis, &tensorbasis); CeedChk(ierr);
+  const CeedInt qsize = nelem*ncomp*nqpt;
+  const CeedScalar *u;
+  CeedScalar *v;
+  ierr = CeedVectorGetArrayRead(U, CEED_MEM_HOST, &u); CeedChk(ierr);
+  ierr = CeedVectorGetArray(V, CEED_MEM_HOST, &v); CeedChk(ierr);
+
+  // Clear v if operating in transpose
+  if (tmode == CEED_TRANSPOSE) {
+    const CeedInt vsize = nelem*ncomp*nnodes;
+    for (CeedInt i = 0; i < vsize; i++)
+      v[i] = (CeedScalar) 0.0;
+  }
+
+  if (tensorbasis && impl->collograd1d) {
+    // The collocated gradient acts on the interpolated values, so the
+    //   interpolation is shared by both outputs
+    CeedInt P1d, Q1d;
+    ierr = CeedBasisGetNumNodes1D(basis, &P1d); CeedChk(ierr);
+    ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q1d); CeedChk(ierr);
+    const CeedScalar *interp1d;
+    ierr = CeedBasisGetInterp1D(basis, &interp1d); CeedChk(ierr);
+    const CeedInt maxPQ = P1d > Q1d ? P1d : Q1d;
+    CeedScalar tmp[2][nelem*ncomp*Q1d*CeedIntPow(maxPQ, dim-1)];
+    CeedScalar interp[qsize];
+    if (tmode == CEED_NOTRANSPOSE) {
+      // Interpolate to quadrature points
+      CeedInt pre = ncomp*CeedIntPow(P1d, dim-1), post = nelem;
+      for (CeedInt d=0; d<dim; d++) {
+        ierr = CeedTensorContractApply(contract, pre, P1d, post, Q1d, interp1d,
+                                       tmode, 0, d==0?u:tmp[d%2],
+                                       d==dim-1?v:tmp[(d+1)%2]);
+        CeedChk(ierr);
+        pre /= P1d;
+        post *= Q1d;
+      }
+      // Grad at quadrature points
+      pre = ncomp*CeedIntPow(Q1d, dim-1), post = nelem;
+      for (CeedInt d=0; d<dim; d++) {
+        ierr = CeedTensorContractApply(contract, pre, Q1d, post, Q1d,
+                                       impl->collograd1d, tmode, 0, v,
+                                       v + (d+1)*qsize); CeedChk(ierr);
+        pre /= Q1d;
+        post *= Q1d;
+      }
+    } else {
+      // Sum values and transpose grad at quadrature points
+      memcpy(interp, u, qsize*sizeof(u[0]));
+      CeedInt pre = ncomp*CeedIntPow(Q1d, dim-1), post = nelem;
+      for (CeedInt d=0; d<dim; d++) {
+        ierr = CeedTensorContractApply(contract, pre, Q1d, post, Q1d,
+                                       impl->collograd1d, tmode, 1,
+                                       u + (d+1)*qsize, interp); CeedChk(ierr);
+        pre /= Q1d;
+        post *= Q1d;
+      }
+      // Interpolate to nodes
+      pre = ncomp*CeedIntPow(Q1d, dim-1), post = nelem;
+      for (CeedInt d=0; d<dim; d++) {
+        ierr = CeedTensorContractApply(contract, pre, Q1d, post, P1d, interp1d,
+                                       tmode, d==dim-1,
+                                       d==0?interp:tmp[d%2],
+                                       d==dim-1?v:tmp[(d+1)%2]);
+        CeedChk(ierr);
+        pre /= Q1d;
+        post *= P1d;
+      }
+    }
+  } else if (tensorbasis && impl->collointerp) {
+    // Quadrature points collocated with nodes, values are copied
+    CeedInt Q1d;
+    ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q1d); CeedChk(ierr);
+    const CeedScalar *grad1d;
+    ierr = CeedBasisGetGrad1D(basis, &grad1d); CeedChk(ierr);
+    memcpy(v, u, qsize*sizeof(u[0]));
+    CeedInt pre = ncomp*CeedIntPow(Q1d, dim-1), post = nelem;
+    for (CeedInt d=0; d<dim; d++) {
+      ierr = CeedTensorContractApply(contract, pre, Q1d, post, Q1d, grad1d,
+                                     tmode, tmode == CEED_TRANSPOSE,
+                                     tmode == CEED_NOTRANSPOSE
+                                     ? u : u + (d+1)*qsize,
+                                     tmode == CEED_TRANSPOSE
+                                     ? v : v + (d+1)*qsize); CeedChk(ierr);
+      pre /= Q1d;
+      post *= Q1d;
+    }
+  } else {
+    // Interpolation and gradient in turn; in transpose, both add to v
+    ierr = CeedBasisApplyCore_Ref(basis, nelem, tmode, CEED_EVAL_INTERP, u, v);
+    CeedChk(ierr);
+    ierr = CeedBasisApplyCore_Ref(basis, nelem, tmode, CEED_EVAL_GRAD,
+                                  tmode == CEED_NOTRANSPOSE ? u : u + qsize,
+                                  tmode == CEED_NOTRANSPOSE ? v + qsize : v);
+    CeedChk(ierr);
+  }
+
+  ierr = CeedVectorRestoreArrayRead(U, &u); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(V, &v); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Basis Get Memory Usage
+//------------------------------------------------------------------------------
+static int CeedBasisGetMemoryUsage_Ref(CeedBasis basis, size_t *bytes) {
+  int ierr;
+  CeedBasis_Ref *impl;
+  ierr = CeedBasisGetData(basis, &impl); CeedChk(ierr);
+
+  *bytes = 0;
+  if (impl && impl->collograd1d) {
+    CeedInt Q1d;
+    ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q1d); CeedChk(ierr);
+    *bytes += Q1d*Q1d*sizeof(CeedScalar);
+  }
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Basis Destroy Non-Tensor
 //------------------------------------------------------------------------------
@@ -333,6 +676,10 @@ int CeedBasisCreateH1_Ref(CeedElemTopology topo, CeedInt dim,
 
   ierr = CeedSetBackendFunction(ceed, "Basis", basis, "Apply",
                                 CeedBasisApply_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Basis", basis, "ApplyInterpGrad",
+                                CeedBasisApplyInterpGrad_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Basis", basis, "GetMemoryUsage",
+                                CeedBasisGetMemoryUsage_Ref); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Basis", basis, "Destroy",
                                 CeedBasisDestroyNonTensor_Ref); CeedChk(ierr);
 
@@ -392,10 +739,16 @@ int CeedBasisCreateTensorH1_Ref(CeedInt dim, CeedInt P1d,
   ierr = CeedGetParent(ceed, &parent); CeedChk(ierr);
   CeedTensorContract contract;
   ierr = CeedTensorContractCreate(parent, basis, &contract); CeedChk(ierr);
+  ierr = CeedTensorContractAddEvenOdd(contract, impl->collograd1d, Q1d, Q1d);
+  CeedChk(ierr);
   ierr = CeedBasisSetTensorContract(basis, &contract); CeedChk(ierr);
 
   ierr = CeedSetBackendFunction(ceed, "Basis", basis, "Apply",
                                 CeedBasisApply_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Basis", basis, "ApplyInterpGrad",
+                                CeedBasisApplyInterpGrad_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Basis", basis, "GetMemoryUsage",
+                                CeedBasisGetMemoryUsage_Ref); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Basis", basis, "Destroy",
                                 CeedBasisDestroyTensor_Ref); CeedChk(ierr);
   return 0;
@@ -20,10 +20,11 @@
 // Setup Input/Output Fields
 //------------------------------------------------------------------------------
 static int CeedOperatorSetupFields_Ref(CeedQFunction qf, CeedOperator op,
-                                       bool inOrOut,
-                                       CeedVector *fullevecs, CeedVector *evecs,
-                                       CeedVector *qvecs, CeedInt starte,
-                                       CeedInt numfields, CeedInt Q) {
+                                       bool inOrOut, const CeedInt blksize,
+                                       CeedElemRestriction *blkrestr,
+                                       CeedVector *evecs, CeedVector *qvecs,
+                                       CeedInt starte, CeedInt numfields,
+                                       CeedInt Q) {
   CeedInt dim, ierr, size, P;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
@@ -47,22 +48,22 @@ static int CeedOperatorSetupFields_Ref(CeedQFunction qf, CeedOperator op,
     if (emode != CEED_EVAL_WEIGHT) {
       ierr = CeedOperatorFieldGetElemRestriction(opfields[i], &Erestrict);
       CeedChk(ierr);
-      ierr = CeedElemRestrictionCreateVector(Erestrict, NULL,
-                                             &fullevecs[i+starte]);
+      ierr = CeedElemRestrictionGetBlocked(Erestrict, blksize,
+                                           &blkrestr[i+starte]);
       CeedChk(ierr);
     }
 
     switch(emode) {
     case CEED_EVAL_NONE:
       ierr = CeedQFunctionFieldGetSize(qffields[i], &size); CeedChk(ierr);
-      ierr = CeedVectorCreate(ceed, Q*size, &qvecs[i]); CeedChk(ierr);
+      ierr = CeedVectorCreate(ceed, Q*size*blksize, &qvecs[i]); CeedChk(ierr);
       break;
     case CEED_EVAL_INTERP:
       ierr = CeedQFunctionFieldGetSize(qffields[i], &size); CeedChk(ierr);
       ierr = CeedElemRestrictionGetElementSize(Erestrict, &P);
       CeedChk(ierr);
-      ierr = CeedVectorCreate(ceed, P*size, &evecs[i]); CeedChk(ierr);
-      ierr = CeedVectorCreate(ceed, Q*size, &qvecs[i]); CeedChk(ierr);
+      ierr = CeedVectorCreate(ceed, P*size*blksize, &evecs[i]); CeedChk(ierr);
+      ierr = CeedVectorCreate(ceed, Q*size*blksize, &qvecs[i]); CeedChk(ierr);
       break;
     case CEED_EVAL_GRAD:
       ierr = CeedOperatorFieldGetBasis(opfields[i], &basis); CeedChk(ierr);
@@ -70,13 +71,13 @@ static int CeedOperatorSetupFields_Ref(CeedQFunction qf, CeedOperator op,
       ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
       ierr = CeedElemRestrictionGetElementSize(Erestrict, &P);
       CeedChk(ierr);
-      ierr = CeedVectorCreate(ceed, P*size/dim, &evecs[i]); CeedChk(ierr);
-      ierr = CeedVectorCreate(ceed, Q*size, &qvecs[i]); CeedChk(ierr);
+      ierr = CeedVectorCreate(ceed, P*size/dim*blksize, &evecs[i]); CeedChk(ierr);
+      ierr = CeedVectorCreate(ceed, Q*size*blksize, &qvecs[i]); CeedChk(ierr);
       break;
     case CEED_EVAL_WEIGHT: // Only on input fields
       ierr = CeedOperatorFieldGetBasis(opfields[i], &basis); CeedChk(ierr);
-      ierr = CeedVectorCreate(ceed, Q, &qvecs[i]); CeedChk(ierr);
-      ierr = CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT,
+      ierr = CeedVectorCreate(ceed, Q*blksize, &qvecs[i]); CeedChk(ierr);
+      ierr = CeedBasisApply(basis, blksize, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT,
                             CEED_VECTOR_NONE, qvecs[i]); CeedChk(ierr);
       break;
     case CEED_EVAL_DIV:
@@ -88,6 +89,177 @@ static int CeedOperatorSetupFields_Ref(CeedQFunction qf, CeedOperator op,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Setup Combined Interpolation and Gradient Inputs
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupInterpGrad_Ref(CeedOperator op, CeedInt Q,
+    CeedOperator_Ref *impl) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt numinputfields;
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, NULL); CeedChk(ierr);
+  CeedOperatorField *opfields;
+  ierr = CeedOperatorGetFields(op, &opfields, NULL); CeedChk(ierr);
+  CeedQFunctionField *qffields;
+  ierr = CeedQFunctionGetFields(qf, &qffields, NULL); CeedChk(ierr);
+
+  // An INTERP input and a GRAD input with the same vector, restriction, and
+  //   basis are restricted once and evaluated with a single basis action,
+  //   writing both Q-vectors, which are adjacent in one array
+  for (CeedInt i=0; i<numinputfields; i++) {
+    impl->fusedgrad[i] = -1;
+    CeedEvalMode emode;
+    ierr = CeedQFunctionFieldGetEvalMode(qffields[i], &emode); CeedChk(ierr);
+    if (emode != CEED_EVAL_INTERP)
+      continue;
+    CeedVector vec;
+    CeedElemRestriction rstr;
+    CeedBasis basis;
+    ierr = CeedOperatorFieldGetVector(opfields[i], &vec); CeedChk(ierr);
+    ierr = CeedOperatorFieldGetElemRestriction(opfields[i], &rstr);
+    CeedChk(ierr);
+    ierr = CeedOperatorFieldGetBasis(opfields[i], &basis); CeedChk(ierr);
+    for (CeedInt j=0; j<numinputfields; j++) {
+      CeedVector vecj;
+      CeedElemRestriction rstrj;
+      CeedBasis basisj;
+      ierr = CeedQFunctionFieldGetEvalMode(qffields[j], &emode); CeedChk(ierr);
+      if (emode != CEED_EVAL_GRAD || impl->inputfused[j])
+        continue;
+      ierr = CeedOperatorFieldGetVector(opfields[j], &vecj); CeedChk(ierr);
+      ierr = CeedOperatorFieldGetElemRestriction(opfields[j], &rstrj);
+      CeedChk(ierr);
+      ierr = CeedOperatorFieldGetBasis(opfields[j], &basisj); CeedChk(ierr);
+      if (vecj != vec || rstrj != rstr || basisj != basis)
+        continue;
+
+      CeedInt sizei, sizej;
+      ierr = CeedQFunctionFieldGetSize(qffields[i], &sizei); CeedChk(ierr);
+      ierr = CeedQFunctionFieldGetSize(qffields[j], &sizej); CeedChk(ierr);
+      const CeedInt len = Q*impl->blksize*(sizei + sizej);
+      ierr = CeedCalloc(len, &impl->qdatafused[i]); CeedChk(ierr);
+      ierr = CeedVectorCreate(ceed, len, &impl->qvecsfused[i]); CeedChk(ierr);
+      ierr = CeedVectorSetArray(impl->qvecsfused[i], CEED_MEM_HOST,
+                                CEED_USE_POINTER, impl->qdatafused[i]);
+      CeedChk(ierr);
+      ierr = CeedVectorSetArray(impl->qvecsin[i], CEED_MEM_HOST,
+                                CEED_USE_POINTER, impl->qdatafused[i]);
+      CeedChk(ierr);
+      ierr = CeedVectorSetArray(impl->qvecsin[j], CEED_MEM_HOST,
+                                CEED_USE_POINTER,
+                                &impl->qdatafused[i][Q*impl->blksize*sizei]);
+      CeedChk(ierr);
+      impl->fusedgrad[i] = j;
+      impl->inputfused[j] = true;
+      break;
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Setup Shared Input E-vectors
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupSharedInputs_Ref(CeedOperator op,
+    CeedOperator_Ref *impl) {
+  int ierr;
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt numinputfields;
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, NULL); CeedChk(ierr);
+  CeedOperatorField *opfields;
+  ierr = CeedOperatorGetFields(op, &opfields, NULL); CeedChk(ierr);
+  CeedQFunctionField *qffields;
+  ierr = CeedQFunctionGetFields(qf, &qffields, NULL); CeedChk(ierr);
+
+  // INTERP and GRAD inputs with the same vector and restriction, but not
+  //   evaluated together, share the element E-vector of the first of these
+  //   inputs, which is the only one restricted
+  for (CeedInt i=0; i<numinputfields; i++) {
+    impl->inputshared[i] = -1;
+    CeedEvalMode emode;
+    ierr = CeedQFunctionFieldGetEvalMode(qffields[i], &emode); CeedChk(ierr);
+    if ((emode != CEED_EVAL_INTERP && emode != CEED_EVAL_GRAD) ||
+        impl->inputfused[i] || impl->ereduced[i])
+      continue;
+    CeedVector vec;
+    CeedElemRestriction rstr;
+    ierr = CeedOperatorFieldGetVector(opfields[i], &vec); CeedChk(ierr);
+    ierr = CeedOperatorFieldGetElemRestriction(opfields[i], &rstr);
+    CeedChk(ierr);
+    for (CeedInt j=0; j<i; j++) {
+      CeedVector vecj;
+      CeedElemRestriction rstrj;
+      ierr = CeedQFunctionFieldGetEvalMode(qffields[j], &emode); CeedChk(ierr);
+      if ((emode != CEED_EVAL_INTERP && emode != CEED_EVAL_GRAD) ||
+          impl->inputfused[j] || impl->ereduced[j] || impl->inputshared[j] >= 0)
+        continue;
+      ierr = CeedOperatorFieldGetVector(opfields[j], &vecj); CeedChk(ierr);
+      ierr = CeedOperatorFieldGetElemRestriction(opfields[j], &rstrj);
+      CeedChk(ierr);
+      if (vecj != vec || rstrj != rstr)
+        continue;
+
+      ierr = CeedVectorDestroy(&impl->evecsin[i]); CeedChk(ierr);
+      impl->evecsin[i] = impl->evecsin[j];
+      ierr = CeedVectorAddReference(impl->evecsin[j]); CeedChk(ierr);
+      impl->inputshared[i] = j;
+      break;
+    }
+  }
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Check Basis Scratch for a Batch Size
+//------------------------------------------------------------------------------
+static int CeedOperatorCheckBatchSize_Ref(CeedOperator op, CeedInt batchsize) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt numinputfields, numoutputfields;
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  CeedOperatorField *opinputfields, *opoutputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
+  CeedChk(ierr);
+
+  // Tensor bases keep up to three arrays of the size of the batch at the
+  //   quadrature points on the stack during each call
+  for (CeedInt i=0; i<numinputfields + numoutputfields; i++) {
+    CeedOperatorField field = i < numinputfields ? opinputfields[i] :
+                              opoutputfields[i - numinputfields];
+    CeedBasis basis;
+    bool tensorbasis;
+    ierr = CeedOperatorFieldGetBasis(field, &basis); CeedChk(ierr);
+    if (basis == CEED_BASIS_COLLOCATED)
+      continue;
+    ierr = CeedBasisIsTensor(basis, &tensorbasis); CeedChk(ierr);
+    if (!tensorbasis)
+      continue;
+    CeedInt dim, ncomp, P1d, Q1d;
+    ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
+    ierr = CeedBasisGetNumComponents(basis, &ncomp); CeedChk(ierr);
+    ierr = CeedBasisGetNumNodes1D(basis, &P1d); CeedChk(ierr);
+    ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q1d); CeedChk(ierr);
+    const size_t bytes = 3*(size_t)batchsize*ncomp*
+                         CeedIntPow(P1d > Q1d ? P1d : Q1d, dim)*
+                         sizeof(CeedScalar);
+    if (bytes > CEED_REF_BATCH_SCRATCH_MAX)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "Batch size %d needs %zu bytes of basis "
+                       "scratch, more than the limit of %d bytes", batchsize,
+                       bytes, CEED_REF_BATCH_SCRATCH_MAX);
+    // LCOV_EXCL_STOP
+  }
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Setup Operator
 //------------------------------------------------------------------------------/*
@@ -114,32 +286,105 @@ static int CeedOperatorSetup_Ref(CeedOperator op) {
   ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
   CeedChk(ierr);
 
+  // Elements per batch, restricted in the layout of blocked restrictions
+  CeedInt batchsize;
+  ierr = CeedOperatorGetBatchSize(op, &batchsize); CeedChk(ierr);
+  impl->blksize = batchsize > 1 ? batchsize : 1;
+  if (impl->blksize > 1) {
+    ierr = CeedOperatorCheckBatchSize_Ref(op, impl->blksize); CeedChk(ierr);
+  }
+
   // Allocate
+  ierr = CeedCalloc(numinputfields + numoutputfields, &impl->blkrestr);
+  CeedChk(ierr);
   ierr = CeedCalloc(numinputfields + numoutputfields, &impl->evecs);
   CeedChk(ierr);
   ierr = CeedCalloc(numinputfields + numoutputfields, &impl->edata);
   CeedChk(ierr);
 
   ierr = CeedCalloc(16, &impl->inputstate); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->inputinplace); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->inputprecision); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->ereduced); CeedChk(ierr);
   ierr = CeedCalloc(16, &impl->evecsin); CeedChk(ierr);
   ierr = CeedCalloc(16, &impl->evecsout); CeedChk(ierr);
   ierr = CeedCalloc(16, &impl->qvecsin); CeedChk(ierr);
   ierr = CeedCalloc(16, &impl->qvecsout); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->escale); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->fusedgrad); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->inputfused); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->qvecsfused); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->qdatafused); CeedChk(ierr);
+  ierr = CeedCalloc(16, &impl->inputshared); CeedChk(ierr);
 
   impl->numein = numinputfields; impl->numeout = numoutputfields;
 
   // Set up infield and outfield evecs and qvecs
   // Infields
-  ierr = CeedOperatorSetupFields_Ref(qf, op, 0, impl->evecs,
+  ierr = CeedOperatorSetupFields_Ref(qf, op, 0, impl->blksize, impl->blkrestr,
                                      impl->evecsin, impl->qvecsin, 0,
                                      numinputfields, Q);
   CeedChk(ierr);
   // Outfields
-  ierr = CeedOperatorSetupFields_Ref(qf, op, 1, impl->evecs,
+  ierr = CeedOperatorSetupFields_Ref(qf, op, 1, impl->blksize, impl->blkrestr,
                                      impl->evecsout, impl->qvecsout,
                                      numinputfields, numoutputfields, Q);
   CeedChk(ierr);
 
+  // Inputs with backend strides and no basis action are read in place from
+  //   the L-vector, which has the E-vector layout for these restrictions, but
+  //   not the batch layout. Operators on a fallback Ceed may hold restrictions
+  //   from another backend.
+  Ceed ceedparent;
+  ierr = CeedGetOperatorFallbackParentCeed(ceed, &ceedparent); CeedChk(ierr);
+  for (CeedInt i=0; i<numinputfields && !ceedparent && impl->blksize == 1;
+       i++) {
+    CeedEvalMode emode;
+    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+    CeedChk(ierr);
+    if (emode == CEED_EVAL_NONE) {
+      CeedElemRestriction Erestrict;
+      bool strided, backendstrides = false;
+      ierr = CeedOperatorFieldGetElemRestriction(opinputfields[i], &Erestrict);
+      CeedChk(ierr);
+      ierr = CeedElemRestrictionIsStrided(Erestrict, &strided); CeedChk(ierr);
+      if (strided) {
+        ierr = CeedElemRestrictionHasBackendStrides(Erestrict, &backendstrides);
+        CeedChk(ierr);
+      }
+      impl->inputinplace[i] = backendstrides;
+    }
+  }
+
+  // Inputs stored in reduced precision, converted to CeedScalar one element
+  //   or batch at a time in the input basis action
+  for (CeedInt i=0; i<numinputfields; i++) {
+    ierr = CeedOperatorFieldGetPrecision(opinputfields[i],
+                                         &impl->inputprecision[i]);
+    CeedChk(ierr);
+    if (impl->inputprecision[i] != CEED_PRECISION_SCALAR) {
+      CeedInt nblk, elemsize, ncomp;
+      size_t bytes;
+      ierr = CeedElemRestrictionGetNumBlocks(impl->blkrestr[i], &nblk);
+      CeedChk(ierr);
+      ierr = CeedElemRestrictionGetElementSize(impl->blkrestr[i], &elemsize);
+      CeedChk(ierr);
+      ierr = CeedElemRestrictionGetNumComponents(impl->blkrestr[i], &ncomp);
+      CeedChk(ierr);
+      ierr = CeedFieldPrecisionGetSize(impl->inputprecision[i], &bytes);
+      CeedChk(ierr);
+      ierr = CeedMallocArray(nblk*impl->blksize*elemsize*ncomp, bytes,
+                             &impl->ereduced[i]); CeedChk(ierr);
+      impl->inputinplace[i] = false;
+    }
+  }
+
+  // Combined interpolation and gradient inputs
+  ierr = CeedOperatorSetupInterpGrad_Ref(op, Q, impl); CeedChk(ierr);
+
+  // Inputs sharing a vector and restriction
+  ierr = CeedOperatorSetupSharedInputs_Ref(op, impl); CeedChk(ierr);
+
   // Identity QFunctions
   if (impl->identityqf) {
     CeedEvalMode inmode, outmode;
@@ -173,13 +418,13 @@ static inline int CeedOperatorSetupInputs_Ref(CeedInt numinputfields,
   CeedInt ierr;
   CeedEvalMode emode;
   CeedVector vec;
-  CeedElemRestriction Erestrict;
   uint64_t state;
 
   for (CeedInt i=0; i<numinputfields; i++) {
     // Get input vector
     ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
-    if (vec == CEED_VECTOR_ACTIVE) {
+    const bool active = vec == CEED_VECTOR_ACTIVE;
+    if (active) {
       if (skipactive)
         continue;
       else
@@ -189,23 +434,56 @@ static inline int CeedOperatorSetupInputs_Ref(CeedInt numinputfields,
     ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
     CeedChk(ierr);
     // Restrict and Evec
-    if (emode == CEED_EVAL_WEIGHT) { // Skip
-    } else {
+    if (emode == CEED_EVAL_WEIGHT || impl->inputfused[i]) { // Skip
+    } else if (impl->ereduced[i]) {
+      // Convert to the storage precision when the input changes
+      ierr = CeedVectorGetState(vec, &state); CeedChk(ierr);
+      if (state != impl->inputstate[i]) {
+        CeedVector evec;
+        CeedInt len;
+        const CeedScalar *edata;
+        ierr = CeedElemRestrictionCreateVector(impl->blkrestr[i], NULL, &evec);
+        CeedChk(ierr);
+        ierr = CeedElemRestrictionApply(impl->blkrestr[i], CEED_NOTRANSPOSE,
+                                        vec, evec, request); CeedChk(ierr);
+        ierr = CeedVectorGetLength(evec, &len); CeedChk(ierr);
+        ierr = CeedVectorGetArrayRead(evec, CEED_MEM_HOST, &edata); CeedChk(ierr);
+        ierr = CeedFieldPrecisionPack(impl->inputprecision[i], len, edata,
+                                      impl->ereduced[i]); CeedChk(ierr);
+        ierr = CeedVectorRestoreArrayRead(evec, &edata); CeedChk(ierr);
+        ierr = CeedVectorDestroy(&evec); CeedChk(ierr);
+        impl->inputstate[i] = state;
+      }
+    } else if (impl->inputinplace[i]) {
+      // Read L-vector in place
+      ierr = CeedVectorGetArrayRead(vec, CEED_MEM_HOST,
+                                    (const CeedScalar **) &impl->edata[i]);
+      CeedChk(ierr);
+    } else if (!active) {
+      // Full E-vector for passive inputs, restricted when the input changes
+      const CeedInt shared = impl->inputshared[i];
+      if (!impl->evecs[i] && shared >= 0) {
+        impl->evecs[i] = impl->evecs[shared];
+        ierr = CeedVectorAddReference(impl->evecs[shared]); CeedChk(ierr);
+      } else if (!impl->evecs[i]) {
+        ierr = CeedElemRestrictionCreateVector(impl->blkrestr[i], NULL,
+                                               &impl->evecs[i]); CeedChk(ierr);
+      }
       // Restrict
       ierr = CeedVectorGetState(vec, &state); CeedChk(ierr);
-      // Skip restriction if input is unchanged
-      if (state != impl->inputstate[i] || vec == invec) {
-        ierr = CeedOperatorFieldGetElemRestriction(opinputfields[i], &Erestrict);
+      // Skip restriction if input is unchanged or restricted for another input
+      if (shared < 0 && (state != impl->inputstate[i] || vec == invec)) {
+        ierr = CeedElemRestrictionApply(impl->blkrestr[i], CEED_NOTRANSPOSE,
+                                        vec, impl->evecs[i], request);
         CeedChk(ierr);
-        ierr = CeedElemRestrictionApply(Erestrict, CEED_NOTRANSPOSE, vec,
-                                        impl->evecs[i], request); CeedChk(ierr);
         impl->inputstate[i] = state;
       }
       // Get evec
       ierr = CeedVectorGetArrayRead(impl->evecs[i], CEED_MEM_HOST,
                                     (const CeedScalar **) &impl->edata[i]);
       CeedChk(ierr);
-    }
+    } // Otherwise, active inputs are restricted one element or batch at a
+    //   time in the input basis action
   }
   return 0;
 }
@@ -215,20 +493,27 @@ static inline int CeedOperatorSetupInputs_Ref(CeedInt numinputfields,
 //------------------------------------------------------------------------------
 static inline int CeedOperatorInputBasis_Ref(CeedInt e, CeedInt Q,
     CeedQFunctionField *qfinputfields, CeedOperatorField *opinputfields,
-    CeedInt numinputfields, const bool skipactive, CeedOperator_Ref *impl) {
+    CeedInt numinputfields, CeedVector invec, const bool skipactive,
+    CeedOperator_Ref *impl, CeedRequest *request) {
   CeedInt ierr;
   CeedInt dim, elemsize, size;
   CeedElemRestriction Erestrict;
   CeedEvalMode emode;
   CeedBasis basis;
+  CeedVector vec;
 
   for (CeedInt i=0; i<numinputfields; i++) {
-    // Skip active input
-    if (skipactive) {
-      CeedVector vec;
-      ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
-      if (vec == CEED_VECTOR_ACTIVE)
+    // Skip GRAD input evaluated with an INTERP input
+    if (impl->inputfused[i])
+      continue;
+    // Get input vector
+    ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+    if (vec == CEED_VECTOR_ACTIVE) {
+      // Skip active input
+      if (skipactive)
         continue;
+      else
+        vec = invec;
     }
     // Get elemsize, emode, size
     ierr = CeedOperatorFieldGetElemRestriction(opinputfields[i], &Erestrict);
@@ -238,31 +523,65 @@ static inline int CeedOperatorInputBasis_Ref(CeedInt e, CeedInt Q,
     ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
     CeedChk(ierr);
     ierr = CeedQFunctionFieldGetSize(qfinputfields[i], &size); CeedChk(ierr);
+    // Restrict element or batch, unless restricted for another input
+    if (emode != CEED_EVAL_WEIGHT && !impl->edata[i] && !impl->ereduced[i] &&
+        impl->inputshared[i] < 0) {
+      ierr = CeedElemRestrictionApplyBlock(impl->blkrestr[i], e/impl->blksize,
+                                           CEED_NOTRANSPOSE, vec,
+                                           emode == CEED_EVAL_NONE ?
+                                           impl->qvecsin[i] : impl->evecsin[i],
+                                           request); CeedChk(ierr);
+    }
     // Basis action
     switch(emode) {
     case CEED_EVAL_NONE:
-      ierr = CeedVectorSetArray(impl->qvecsin[i], CEED_MEM_HOST,
-                                CEED_USE_POINTER,
-                                &impl->edata[i][e*Q*size]); CeedChk(ierr);
+      if (impl->ereduced[i]) {
+        size_t bytes;
+        CeedScalar *qdata;
+        ierr = CeedFieldPrecisionGetSize(impl->inputprecision[i], &bytes);
+        CeedChk(ierr);
+        ierr = CeedVectorGetArray(impl->qvecsin[i], CEED_MEM_HOST, &qdata);
+        CeedChk(ierr);
+        ierr = CeedFieldPrecisionUnpack(impl->inputprecision[i],
+                                        Q*size*impl->blksize,
+                                        (char *)impl->ereduced[i] +
+                                        e*Q*size*bytes, qdata); CeedChk(ierr);
+        ierr = CeedVectorRestoreArray(impl->qvecsin[i], &qdata); CeedChk(ierr);
+      } else if (impl->edata[i]) {
+        ierr = CeedVectorSetArray(impl->qvecsin[i], CEED_MEM_HOST,
+                                  CEED_USE_POINTER,
+                                  &impl->edata[i][e*Q*size]); CeedChk(ierr);
+      }
       break;
     case CEED_EVAL_INTERP:
       ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis); CeedChk(ierr);
-      ierr = CeedVectorSetArray(impl->evecsin[i], CEED_MEM_HOST,
-                                CEED_USE_POINTER,
-                                &impl->edata[i][e*elemsize*size]);
-      CeedChk(ierr);
-      ierr = CeedBasisApply(basis, 1, CEED_NOTRANSPOSE,
-                            CEED_EVAL_INTERP, impl->evecsin[i],
-                            impl->qvecsin[i]); CeedChk(ierr);
+      if (impl->edata[i]) {
+        ierr = CeedVectorSetArray(impl->evecsin[i], CEED_MEM_HOST,
+                                  CEED_USE_POINTER,
+                                  &impl->edata[i][e*elemsize*size]);
+        CeedChk(ierr);
+      }
+      if (impl->fusedgrad[i] >= 0) {
+        ierr = CeedBasisApply(basis, impl->blksize, CEED_NOTRANSPOSE,
+                              CEED_EVAL_INTERP | CEED_EVAL_GRAD,
+                              impl->evecsin[i], impl->qvecsfused[i]);
+        CeedChk(ierr);
+      } else {
+        ierr = CeedBasisApply(basis, impl->blksize, CEED_NOTRANSPOSE,
+                              CEED_EVAL_INTERP, impl->evecsin[i],
+                              impl->qvecsin[i]); CeedChk(ierr);
+      }
       break;
     case CEED_EVAL_GRAD:
       ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis); CeedChk(ierr);
       ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
-      ierr = CeedVectorSetArray(impl->evecsin[i], CEED_MEM_HOST,
-                                CEED_USE_POINTER,
-                                &impl->edata[i][e*elemsize*size/dim]);
-      CeedChk(ierr);
-      ierr = CeedBasisApply(basis, 1, CEED_NOTRANSPOSE,
+      if (impl->edata[i]) {
+        ierr = CeedVectorSetArray(impl->evecsin[i], CEED_MEM_HOST,
+                                  CEED_USE_POINTER,
+                                  &impl->edata[i][e*elemsize*size/dim]);
+        CeedChk(ierr);
+      }
+      ierr = CeedBasisApply(basis, impl->blksize, CEED_NOTRANSPOSE,
                             CEED_EVAL_GRAD, impl->evecsin[i],
                             impl->qvecsin[i]); CeedChk(ierr);
       break;
@@ -283,28 +602,60 @@ static inline int CeedOperatorInputBasis_Ref(CeedInt e, CeedInt Q,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Output Scaling
+//------------------------------------------------------------------------------
+static inline int CeedOperatorScaleOutput_Ref(CeedInt block,
+    CeedElemRestriction Erestrict, CeedVector evec, const CeedScalar beta,
+    CeedVector scale, CeedVector *escale, CeedRequest *request) {
+  CeedInt ierr;
+  CeedInt len;
+  ierr = CeedVectorGetLength(evec, &len); CeedChk(ierr);
+  if (!*escale) {
+    Ceed ceed;
+    ierr = CeedVectorGetCeed(evec, &ceed); CeedChk(ierr);
+    ierr = CeedVectorCreate(ceed, len, escale); CeedChk(ierr);
+  }
+
+  // Scaling factors for element nodes
+  if (scale != CEED_VECTOR_NONE) {
+    ierr = CeedElemRestrictionApplyBlock(Erestrict, block, CEED_NOTRANSPOSE,
+                                         scale, *escale, request);
+    CeedChk(ierr);
+  } else {
+    ierr = CeedVectorSetValue(*escale, 1.0); CeedChk(ierr);
+  }
+
+  // Scale element output
+  const CeedScalar *ev;
+  CeedScalar *es;
+  ierr = CeedVectorGetArrayRead(evec, CEED_MEM_HOST, &ev); CeedChk(ierr);
+  ierr = CeedVectorGetArray(*escale, CEED_MEM_HOST, &es); CeedChk(ierr);
+  for (CeedInt i=0; i<len; i++)
+    es[i] *= beta*ev[i];
+  ierr = CeedVectorRestoreArray(*escale, &es); CeedChk(ierr);
+  ierr = CeedVectorRestoreArrayRead(evec, &ev); CeedChk(ierr);
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Output Basis Action
 //------------------------------------------------------------------------------
-static inline int CeedOperatorOutputBasis_Ref(CeedInt e, CeedInt Q,
+static inline int CeedOperatorOutputBasis_Ref(CeedInt e,
     CeedQFunctionField *qfoutputfields, CeedOperatorField *opoutputfields,
-    CeedInt numinputfields, CeedInt numoutputfields, CeedOperator op,
-    CeedOperator_Ref *impl) {
+    CeedInt numoutputfields, CeedVector outvec, const bool skipactive,
+    const CeedScalar beta, CeedVector scale, CeedOperator op,
+    CeedOperator_Ref *impl, CeedRequest *request) {
   CeedInt ierr;
-  CeedInt dim, elemsize, size;
   CeedElemRestriction Erestrict;
   CeedEvalMode emode;
   CeedBasis basis;
+  CeedVector vec;
 
   for (CeedInt i=0; i<numoutputfields; i++) {
-    // Get elemsize, emode, size
-    ierr = CeedOperatorFieldGetElemRestriction(opoutputfields[i], &Erestrict);
-    CeedChk(ierr);
-    ierr = CeedElemRestrictionGetElementSize(Erestrict, &elemsize);
-    CeedChk(ierr);
+    // Get emode
     ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
     CeedChk(ierr);
-    ierr = CeedQFunctionFieldGetSize(qfoutputfields[i], &size); CeedChk(ierr);
     // Basis action
     switch(emode) {
     case CEED_EVAL_NONE:
@@ -312,23 +663,14 @@ static inline int CeedOperatorOutputBasis_Ref(CeedInt e, CeedInt Q,
     case CEED_EVAL_INTERP:
       ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis);
       CeedChk(ierr);
-      ierr = CeedVectorSetArray(impl->evecsout[i], CEED_MEM_HOST,
-                                CEED_USE_POINTER,
-                                &impl->edata[i + numinputfields][e*elemsize*size]);
-      CeedChk(ierr);
-      ierr = CeedBasisApply(basis, 1, CEED_TRANSPOSE,
+      ierr = CeedBasisApply(basis, impl->blksize, CEED_TRANSPOSE,
                             CEED_EVAL_INTERP, impl->qvecsout[i],
                             impl->evecsout[i]); CeedChk(ierr);
       break;
     case CEED_EVAL_GRAD:
       ierr = CeedOperatorFieldGetBasis(opoutputfields[i], &basis);
       CeedChk(ierr);
-      ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
-      ierr = CeedVectorSetArray(impl->evecsout[i], CEED_MEM_HOST,
-                                CEED_USE_POINTER,
-                                &impl->edata[i + numinputfields][e*elemsize*size/dim]);
-      CeedChk(ierr);
-      ierr = CeedBasisApply(basis, 1, CEED_TRANSPOSE,
+      ierr = CeedBasisApply(basis, impl->blksize, CEED_TRANSPOSE,
                             CEED_EVAL_GRAD, impl->qvecsout[i],
                             impl->evecsout[i]); CeedChk(ierr);
       break;
@@ -347,6 +689,29 @@ static inline int CeedOperatorOutputBasis_Ref(CeedInt e, CeedInt Q,
       // LCOV_EXCL_STOP
     }
     }
+    // Get output vector
+    ierr = CeedOperatorFieldGetVector(opoutputfields[i], &vec); CeedChk(ierr);
+    if (vec == CEED_VECTOR_ACTIVE) {
+      // Skip active output
+      if (skipactive)
+        continue;
+      else
+        vec = outvec;
+    }
+    // Restrict element or batch
+    Erestrict = impl->blkrestr[i + impl->numein];
+    CeedVector evec = emode == CEED_EVAL_NONE ? impl->qvecsout[i] :
+                      impl->evecsout[i];
+    if (vec == outvec && (scale != CEED_VECTOR_NONE || beta != 1.0)) {
+      ierr = CeedOperatorScaleOutput_Ref(e/impl->blksize, Erestrict, evec,
+                                         beta, scale, &impl->escale[i],
+                                         request);
+      CeedChk(ierr);
+      evec = impl->escale[i];
+    }
+    ierr = CeedElemRestrictionApplyBlock(Erestrict, e/impl->blksize,
+                                         CEED_TRANSPOSE, evec, vec, request);
+    CeedChk(ierr);
   }
   return 0;
 }
@@ -355,23 +720,27 @@ static inline int CeedOperatorOutputBasis_Ref(CeedInt e, CeedInt Q,
 // Restore Input Vectors
 //------------------------------------------------------------------------------
 static inline int CeedOperatorRestoreInputs_Ref(CeedInt numinputfields,
-    CeedQFunctionField *qfinputfields, CeedOperatorField *opinputfields,
-    const bool skipactive, CeedOperator_Ref *impl) {
+    CeedOperatorField *opinputfields, CeedVector invec, const bool skipactive,
+    CeedOperator_Ref *impl) {
   CeedInt ierr;
-  CeedEvalMode emode;
+  CeedVector vec;
 
   for (CeedInt i=0; i<numinputfields; i++) {
-    // Skip active inputs
-    if (skipactive) {
-      CeedVector vec;
-      ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
-      if (vec == CEED_VECTOR_ACTIVE)
+    // Get input vector
+    ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+    if (vec == CEED_VECTOR_ACTIVE) {
+      // Skip active inputs
+      if (skipactive)
         continue;
+      else
+        vec = invec;
     }
     // Restore input
-    ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
-    CeedChk(ierr);
-    if (emode == CEED_EVAL_WEIGHT) { // Skip
+    if (!impl->edata[i]) { // Skip
+    } else if (impl->inputinplace[i]) {
+      ierr = CeedVectorRestoreArrayRead(vec,
+                                        (const CeedScalar **) &impl->edata[i]);
+      CeedChk(ierr);
     } else {
       ierr = CeedVectorRestoreArrayRead(impl->evecs[i],
                                         (const CeedScalar **) &impl->edata[i]);
@@ -382,16 +751,17 @@ static inline int CeedOperatorRestoreInputs_Ref(CeedInt numinputfields,
 }
 
 //------------------------------------------------------------------------------
-// Operator Apply
+// Operator Apply, with active output scaled by beta and pointwise by scale
 //------------------------------------------------------------------------------
-static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector invec,
-                                    CeedVector outvec, CeedRequest *request) {
+static int CeedOperatorApplyAddCore_Ref(CeedOperator op, CeedVector invec,
+    CeedVector outvec, const CeedScalar beta, CeedVector scale,
+    CeedRequest *request) {
   int ierr;
   CeedOperator_Ref *impl;
   ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
   CeedQFunction qf;
   ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
-  CeedInt Q, numelements, numinputfields, numoutputfields, size;
+  CeedInt Q, numelements, numinputfields, numoutputfields;
   ierr = CeedOperatorGetNumQuadraturePoints(op, &Q); CeedChk(ierr);
   ierr = CeedOperatorGetNumElements(op, &numelements); CeedChk(ierr);
   ierr= CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
@@ -402,80 +772,342 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector invec,
   CeedQFunctionField *qfinputfields, *qfoutputfields;
   ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
   CeedChk(ierr);
-  CeedEvalMode emode;
-  CeedVector vec;
-  CeedElemRestriction Erestrict;
 
   // Setup
   ierr = CeedOperatorSetup_Ref(op); CeedChk(ierr);
 
-  // Input Evecs and Restriction
+  // Input Evecs for inputs not restricted by element
   ierr = CeedOperatorSetupInputs_Ref(numinputfields, qfinputfields,
                                      opinputfields, invec, false, impl,
                                      request); CeedChk(ierr);
 
-  // Output Evecs
-  for (CeedInt i=0; i<numoutputfields; i++) {
-    ierr = CeedVectorGetArray(impl->evecs[i+impl->numein], CEED_MEM_HOST,
-                              &impl->edata[i + numinputfields]); CeedChk(ierr);
+  // Loop through elements, or batches of elements
+  const CeedInt blksize = impl->blksize;
+  CeedInt nblks = (numelements/blksize) + !!(numelements%blksize);
+  for (CeedInt e=0; e<nblks*blksize; e+=blksize) {
+    // Input restriction and basis apply
+    ierr = CeedOperatorInputBasis_Ref(e, Q, qfinputfields, opinputfields,
+                                      numinputfields, invec, false, impl,
+                                      request); CeedChk(ierr);
+
+    // Q function
+    if (!impl->identityqf) {
+      ierr = CeedQFunctionApply(qf, Q*blksize, impl->qvecsin, impl->qvecsout);
+      CeedChk(ierr);
+    }
+
+    // Output basis apply and restriction
+    ierr = CeedOperatorOutputBasis_Ref(e, qfoutputfields, opoutputfields,
+                                       numoutputfields, outvec, false, beta,
+                                       scale, op, impl, request); CeedChk(ierr);
+  }
+
+  // Restore input arrays
+  ierr = CeedOperatorRestoreInputs_Ref(numinputfields, opinputfields, invec,
+                                       false, impl); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector invec,
+                                    CeedVector outvec, CeedRequest *request) {
+  int ierr;
+  ierr = CeedOperatorApplyAddCore_Ref(op, invec, outvec, 1.0, CEED_VECTOR_NONE,
+                                      request); CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply with Scaled Output
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyScaledAdd_Ref(CeedOperator op, CeedVector invec,
+    CeedVector outvec, CeedScalar beta, CeedVector scale,
+    CeedRequest *request) {
+  int ierr;
+  ierr = CeedOperatorApplyAddCore_Ref(op, invec, outvec, beta, scale, request);
+  CeedChk(ierr);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Get Active Restriction Shared by All Active Fields
+//------------------------------------------------------------------------------
+static int CeedOperatorGetSharedActiveRestriction_Ref(CeedOperator op,
+    CeedElemRestriction *activerstr) {
+  int ierr;
+  CeedQFunction qf;
+  ierr = CeedOperatorGetQFunction(op, &qf); CeedChk(ierr);
+  CeedInt numinputfields, numoutputfields;
+  ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+  CeedChk(ierr);
+  CeedOperatorField *opinputfields, *opoutputfields;
+  ierr = CeedOperatorGetFields(op, &opinputfields, &opoutputfields);
+  CeedChk(ierr);
+  CeedVector vec;
+  CeedElemRestriction rstr, activein = NULL, activeout = NULL;
+
+  *activerstr = NULL;
+  for (CeedInt i=0; i<numinputfields + numoutputfields; i++) {
+    CeedOperatorField field = i < numinputfields ? opinputfields[i] :
+                              opoutputfields[i - numinputfields];
+    ierr = CeedOperatorFieldGetVector(field, &vec); CeedChk(ierr);
+    if (vec != CEED_VECTOR_ACTIVE)
+      continue;
+    ierr = CeedOperatorFieldGetElemRestriction(field, &rstr); CeedChk(ierr);
+    if ((activein && rstr != activein) || (activeout && rstr != activeout))
+      return 0;
+    if (i < numinputfields)
+      activein = rstr;
+    else
+      activeout = rstr;
+  }
+  if (activein == activeout)
+    *activerstr = activein;
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Apply Sub-operators Sharing an Active Restriction
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddShared_Ref(CeedOperator *subops,
+    CeedInt numsub, CeedElemRestriction rstr, CeedVector invec,
+    CeedVector outvec, CeedRequest *request) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedElemRestrictionGetCeed(rstr, &ceed); CeedChk(ierr);
+  CeedInt numelements, elemsize, ncomp;
+  ierr = CeedElemRestrictionGetNumElements(rstr, &numelements); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(rstr, &elemsize); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(rstr, &ncomp); CeedChk(ierr);
+  CeedEvalMode emode;
+  CeedVector vec, ein, eout;
+  CeedScalar *eindata, *eoutdata;
+  const CeedScalar *subout;
+  CeedBasis basis;
+
+  // Element E-vectors for the shared active input and output
+  ierr = CeedCalloc(elemsize*ncomp, &eindata); CeedChk(ierr);
+  ierr = CeedCalloc(elemsize*ncomp, &eoutdata); CeedChk(ierr);
+  ierr = CeedVectorCreate(ceed, elemsize*ncomp, &ein); CeedChk(ierr);
+  ierr = CeedVectorSetArray(ein, CEED_MEM_HOST, CEED_USE_POINTER, eindata);
+  CeedChk(ierr);
+  ierr = CeedVectorCreate(ceed, elemsize*ncomp, &eout); CeedChk(ierr);
+  ierr = CeedVectorSetArray(eout, CEED_MEM_HOST, CEED_USE_POINTER, eoutdata);
+  CeedChk(ierr);
+
+  // Setup and passive inputs, once for sub-operators added more than once
+  for (CeedInt s=0; s<numsub; s++) {
+    bool repeated = false;
+    for (CeedInt t=0; t<s; t++)
+      repeated = repeated || subops[t] == subops[s];
+    if (repeated)
+      continue;
+    CeedOperator_Ref *impl;
+    ierr = CeedOperatorGetData(subops[s], &impl); CeedChk(ierr);
+    CeedQFunction qf;
+    ierr = CeedOperatorGetQFunction(subops[s], &qf); CeedChk(ierr);
+    CeedInt numinputfields, numoutputfields;
+    ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
+    CeedChk(ierr);
+    CeedOperatorField *opinputfields;
+    ierr = CeedOperatorGetFields(subops[s], &opinputfields, NULL); CeedChk(ierr);
+    CeedQFunctionField *qfinputfields;
+    ierr = CeedQFunctionGetFields(qf, &qfinputfields, NULL); CeedChk(ierr);
+
+    ierr = CeedOperatorSetup_Ref(subops[s]); CeedChk(ierr);
+    ierr = CeedOperatorSetupInputs_Ref(numinputfields, qfinputfields,
+                                       opinputfields, NULL, true, impl,
+                                       request); CeedChk(ierr);
   }
 
   // Loop through elements
   for (CeedInt e=0; e<numelements; e++) {
-    // Output pointers
-    for (CeedInt i=0; i<numoutputfields; i++) {
-      ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+    // Restrict active input once
+    ierr = CeedElemRestrictionApplyBlock(rstr, e, CEED_NOTRANSPOSE, invec, ein,
+                                         request); CeedChk(ierr);
+    for (CeedInt i=0; i<elemsize*ncomp; i++)
+      eoutdata[i] = 0.0;
+
+    for (CeedInt s=0; s<numsub; s++) {
+      CeedOperator_Ref *impl;
+      ierr = CeedOperatorGetData(subops[s], &impl); CeedChk(ierr);
+      CeedQFunction qf;
+      ierr = CeedOperatorGetQFunction(subops[s], &qf); CeedChk(ierr);
+      CeedInt Q, numinputfields, numoutputfields;
+      ierr = CeedOperatorGetNumQuadraturePoints(subops[s], &Q); CeedChk(ierr);
+      ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
       CeedChk(ierr);
-      if (emode == CEED_EVAL_NONE) {
-        ierr = CeedQFunctionFieldGetSize(qfoutputfields[i], &size);
+      CeedOperatorField *opinputfields, *opoutputfields;
+      ierr = CeedOperatorGetFields(subops[s], &opinputfields, &opoutputfields);
+      CeedChk(ierr);
+      CeedQFunctionField *qfinputfields, *qfoutputfields;
+      ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
+      CeedChk(ierr);
+
+      // Passive input restriction and basis apply
+      ierr = CeedOperatorInputBasis_Ref(e, Q, qfinputfields, opinputfields,
+                                        numinputfields, NULL, true, impl,
+                                        request); CeedChk(ierr);
+
+      // Active input basis apply
+      for (CeedInt i=0; i<numinputfields; i++) {
+        ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+        if (vec != CEED_VECTOR_ACTIVE)
+          continue;
+        ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
         CeedChk(ierr);
-        ierr = CeedVectorSetArray(impl->qvecsout[i], CEED_MEM_HOST,
-                                  CEED_USE_POINTER,
-                                  &impl->edata[i + numinputfields][e*Q*size]);
+        if (emode == CEED_EVAL_NONE) {
+          ierr = CeedVectorSetArray(impl->qvecsin[i], CEED_MEM_HOST,
+                                    CEED_USE_POINTER, eindata); CeedChk(ierr);
+        } else {
+          ierr = CeedOperatorFieldGetBasis(opinputfields[i], &basis);
+          CeedChk(ierr);
+          ierr = CeedVectorSetArray(impl->evecsin[i], CEED_MEM_HOST,
+                                    CEED_USE_POINTER, eindata); CeedChk(ierr);
+          if (impl->inputfused[i]) // Evaluated with its INTERP input
+            continue;
+          const bool fused = impl->fusedgrad[i] >= 0;
+          ierr = CeedBasisApply(basis, 1, CEED_NOTRANSPOSE,
+                                fused ? CEED_EVAL_INTERP | CEED_EVAL_GRAD : emode,
+                                impl->evecsin[i], fused ? impl->qvecsfused[i]
+                                : impl->qvecsin[i]); CeedChk(ierr);
+        }
+      }
+
+      // Q function
+      if (!impl->identityqf) {
+        ierr = CeedQFunctionApply(qf, Q, impl->qvecsin, impl->qvecsout);
         CeedChk(ierr);
       }
+
+      // Output basis apply and passive output restriction
+      ierr = CeedOperatorOutputBasis_Ref(e, qfoutputfields, opoutputfields,
+                                         numoutputfields, NULL, true, 1.0,
+                                         CEED_VECTOR_NONE, subops[s], impl,
+                                         request);
+      CeedChk(ierr);
+
+      // Sum active outputs
+      for (CeedInt i=0; i<numoutputfields; i++) {
+        ierr = CeedOperatorFieldGetVector(opoutputfields[i], &vec);
+        CeedChk(ierr);
+        if (vec != CEED_VECTOR_ACTIVE)
+          continue;
+        ierr = CeedQFunctionFieldGetEvalMode(qfoutputfields[i], &emode);
+        CeedChk(ierr);
+        vec = emode == CEED_EVAL_NONE ? impl->qvecsout[i] : impl->evecsout[i];
+        ierr = CeedVectorGetArrayRead(vec, CEED_MEM_HOST, &subout);
+        CeedChk(ierr);
+        for (CeedInt j=0; j<elemsize*ncomp; j++)
+          eoutdata[j] += subout[j];
+        ierr = CeedVectorRestoreArrayRead(vec, &subout); CeedChk(ierr);
+      }
     }
 
-    // Input basis apply
-    ierr = CeedOperatorInputBasis_Ref(e, Q, qfinputfields, opinputfields,
-                                      numinputfields, false, impl);
+    // Restrict active output once
+    ierr = CeedElemRestrictionApplyBlock(rstr, e, CEED_TRANSPOSE, eout, outvec,
+                                         request); CeedChk(ierr);
+  }
+
+  // Restore inputs and un-set active input vectors, which point to eindata
+  for (CeedInt s=0; s<numsub; s++) {
+    bool repeated = false;
+    for (CeedInt t=0; t<s; t++)
+      repeated = repeated || subops[t] == subops[s];
+    if (repeated)
+      continue;
+    CeedOperator_Ref *impl;
+    ierr = CeedOperatorGetData(subops[s], &impl); CeedChk(ierr);
+    CeedQFunction qf;
+    ierr = CeedOperatorGetQFunction(subops[s], &qf); CeedChk(ierr);
+    CeedInt numinputfields, numoutputfields;
+    ierr = CeedQFunctionGetNumArgs(qf, &numinputfields, &numoutputfields);
     CeedChk(ierr);
+    CeedOperatorField *opinputfields;
+    ierr = CeedOperatorGetFields(subops[s], &opinputfields, NULL); CeedChk(ierr);
+    CeedQFunctionField *qfinputfields;
+    ierr = CeedQFunctionGetFields(qf, &qfinputfields, NULL); CeedChk(ierr);
 
-    // Q function
-    if (!impl->identityqf) {
-      ierr = CeedQFunctionApply(qf, Q, impl->qvecsin, impl->qvecsout);
+    ierr = CeedOperatorRestoreInputs_Ref(numinputfields, opinputfields, NULL,
+                                         true, impl); CeedChk(ierr);
+    for (CeedInt i=0; i<numinputfields; i++) {
+      ierr = CeedOperatorFieldGetVector(opinputfields[i], &vec); CeedChk(ierr);
+      if (vec != CEED_VECTOR_ACTIVE)
+        continue;
+      ierr = CeedQFunctionFieldGetEvalMode(qfinputfields[i], &emode);
+      CeedChk(ierr);
+      ierr = CeedVectorTakeArray(emode == CEED_EVAL_NONE ? impl->qvecsin[i] :
+                                 impl->evecsin[i], CEED_MEM_HOST, NULL);
       CeedChk(ierr);
     }
-
-    // Output basis apply
-    ierr = CeedOperatorOutputBasis_Ref(e, Q, qfoutputfields, opoutputfields,
-                                       numinputfields, numoutputfields, op, impl);
-    CeedChk(ierr);
   }
 
-  // Output restriction
-  for (CeedInt i=0; i<numoutputfields; i++) {
-    // Restore evec
-    ierr = CeedVectorRestoreArray(impl->evecs[i+impl->numein],
-                                  &impl->edata[i + numinputfields]);
-    CeedChk(ierr);
-    // Get output vector
-    ierr = CeedOperatorFieldGetVector(opoutputfields[i], &vec); CeedChk(ierr);
-    // Active
-    if (vec == CEED_VECTOR_ACTIVE)
-      vec = outvec;
-    // Restrict
-    ierr = CeedOperatorFieldGetElemRestriction(opoutputfields[i], &Erestrict);
-    CeedChk(ierr);
-    ierr = CeedElemRestrictionApply(Erestrict, CEED_TRANSPOSE,
-                                    impl->evecs[i+impl->numein], vec, request);
-    CeedChk(ierr);
+  // Cleanup
+  ierr = CeedVectorDestroy(&ein); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&eout); CeedChk(ierr);
+  ierr = CeedFree(&eindata); CeedChk(ierr);
+  ierr = CeedFree(&eoutdata); CeedChk(ierr);
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddComposite_Ref(CeedOperator op, CeedVector invec,
+    CeedVector outvec, CeedRequest *request) {
+  int ierr;
+  Ceed ceed, subceed;
+  ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  CeedInt numsub;
+  ierr = CeedOperatorGetNumSub(op, &numsub); CeedChk(ierr);
+  CeedOperator *subops;
+  ierr = CeedOperatorGetSubList(op, &subops); CeedChk(ierr);
+  CeedElemRestriction activerstr[CEED_COMPOSITE_MAX];
+  CeedOperator group[CEED_COMPOSITE_MAX];
+  bool applied[CEED_COMPOSITE_MAX];
+
+  // Sub-operators of this backend sharing one active restriction are grouped,
+  //   unless they are applied in batches. Composites of backends delegating
+  //   to ref, such as opt and blocked, hold sub-operators of the delegating
+  //   backend, which are applied separately.
+  for (CeedInt i=0; i<numsub; i++) {
+    CeedInt batchsize;
+    applied[i] = false;
+    activerstr[i] = NULL;
+    ierr = CeedOperatorGetCeed(subops[i], &subceed); CeedChk(ierr);
+    ierr = CeedOperatorGetBatchSize(subops[i], &batchsize); CeedChk(ierr);
+    if (subceed == ceed && batchsize <= 1 && invec != CEED_VECTOR_NONE &&
+        outvec != CEED_VECTOR_NONE) {
+      ierr = CeedOperatorGetSharedActiveRestriction_Ref(subops[i],
+             &activerstr[i]); CeedChk(ierr);
+    }
   }
 
-  // Restore input arrays
-  ierr = CeedOperatorRestoreInputs_Ref(numinputfields, qfinputfields,
-                                       opinputfields, false, impl);
-  CeedChk(ierr);
+  for (CeedInt i=0; i<numsub; i++) {
+    if (applied[i])
+      continue;
+    CeedInt groupsize = 0;
+    for (CeedInt j=i; j<numsub && activerstr[i]; j++)
+      if (activerstr[j] == activerstr[i])
+        group[groupsize++] = subops[j];
+    if (groupsize > 1) {
+      ierr = CeedOperatorApplyAddShared_Ref(group, groupsize, activerstr[i],
+                                            invec, outvec, request);
+      CeedChk(ierr);
+      for (CeedInt j=i; j<numsub; j++)
+        if (activerstr[j] == activerstr[i])
+          applied[j] = true;
+    } else {
+      ierr = CeedOperatorApplyAdd(subops[i], invec, outvec, request);
+      CeedChk(ierr);
+      applied[i] = true;
+    }
+  }
 
   return 0;
 }
@@ -501,7 +1133,7 @@ static int CeedOperatorLinearAssembleQFunction_Ref(CeedOperator op,
   CeedQFunctionField *qfinputfields, *qfoutputfields;
   ierr = CeedQFunctionGetFields(qf, &qfinputfields, &qfoutputfields);
   CeedChk(ierr);
-  CeedVector vec;
+  CeedVector vec, lvec = NULL;
   CeedInt numactivein = 0, numactiveout = 0;
   CeedVector *activein = NULL;
   CeedScalar *a, *tmp;
@@ -512,6 +1144,8 @@ static int CeedOperatorLinearAssembleQFunction_Ref(CeedOperator op,
 
   // Setup
   ierr = CeedOperatorSetup_Ref(op); CeedChk(ierr);
+  const CeedInt blksize = impl->blksize;
+  CeedInt nblks = (numelements/blksize) + !!(numelements%blksize);
 
   // Check for identity
   if (impl->identityqf)
@@ -521,8 +1155,8 @@ static int CeedOperatorLinearAssembleQFunction_Ref(CeedOperator op,
 
   // Input Evecs and Restriction
   ierr = CeedOperatorSetupInputs_Ref(numinputfields, qfinputfields,
-                                     opinputfields, NULL, true, impl, request);
-  CeedChk(ierr);
+                                     opinputfields, NULL, true, impl,
+                                     request); CeedChk(ierr);
 
   // Count number of active input fields
   for (CeedInt i=0; i<numinputfields; i++) {
@@ -536,10 +1170,10 @@ static int CeedOperatorLinearAssembleQFunction_Ref(CeedOperator op,
       CeedChk(ierr);
       ierr = CeedRealloc(numactivein + size, &activein); CeedChk(ierr);
       for (CeedInt field=0; field<size; field++) {
-        ierr = CeedVectorCreate(ceed, Q, &activein[numactivein+field]);
+        ierr = CeedVectorCreate(ceed, Q*blksize, &activein[numactivein+field]);
         CeedChk(ierr);
         ierr = CeedVectorSetArray(activein[numactivein+field], CEED_MEM_HOST,
-                                  CEED_USE_POINTER, &tmp[field*Q]);
+                                  CEED_USE_POINTER, &tmp[field*Q*blksize]);
         CeedChk(ierr);
       }
       numactivein += size;
@@ -575,14 +1209,20 @@ static int CeedOperatorLinearAssembleQFunction_Ref(CeedOperator op,
   ierr = CeedVectorCreate(ceedparent, numelements*Q*numactivein*numactiveout,
                           assembled); CeedChk(ierr);
   ierr = CeedVectorSetValue(*assembled, 0.0); CeedChk(ierr);
-  ierr = CeedVectorGetArray(*assembled, CEED_MEM_HOST, &a); CeedChk(ierr);
+  // Batches are assembled in the batch layout and restricted after the loop
+  if (blksize > 1) {
+    ierr = CeedVectorCreate(ceed, nblks*blksize*Q*numactivein*numactiveout,
+                            &lvec); CeedChk(ierr);
+  }
+  ierr = CeedVectorGetArray(lvec ? lvec : *assembled, CEED_MEM_HOST, &a);
+  CeedChk(ierr);
 
-  // Loop through elements
-  for (CeedInt e=0; e<numelements; e++) {
+  // Loop through elements, or batches of elements
+  for (CeedInt e=0; e<nblks*blksize; e+=blksize) {
     // Input basis apply
     ierr = CeedOperatorInputBasis_Ref(e, Q, qfinputfields, opinputfields,
-                                      numinputfields, true, impl);
-    CeedChk(ierr);
+                                      numinputfields, NULL, true, impl,
+                                      request); CeedChk(ierr);
 
     // Assemble QFunction
     for (CeedInt in=0; in<numactivein; in++) {
@@ -603,11 +1243,11 @@ static int CeedOperatorLinearAssembleQFunction_Ref(CeedOperator op,
                              CEED_USE_POINTER, a); CeedChk(ierr);
           ierr = CeedQFunctionFieldGetSize(qfoutputfields[out], &size);
           CeedChk(ierr);
-          a += size*Q; // Advance the pointer by the size of the output
+          a += size*Q*blksize; // Advance the pointer by the size of the output
         }
       }
       // Apply QFunction
-      ierr = CeedQFunctionApply(qf, Q, impl->qvecsin, impl->qvecsout);
+      ierr = CeedQFunctionApply(qf, Q*blksize, impl->qvecsin, impl->qvecsout);
       CeedChk(ierr);
     }
   }
@@ -625,12 +1265,22 @@ static int CeedOperatorLinearAssembleQFunction_Ref(CeedOperator op,
   }
 
   // Restore input arrays
-  ierr = CeedOperatorRestoreInputs_Ref(numinputfields, qfinputfields,
-                                       opinputfields, true, impl);
-  CeedChk(ierr);
+  ierr = CeedOperatorRestoreInputs_Ref(numinputfields, opinputfields, NULL,
+                                       true, impl); CeedChk(ierr);
 
   // Restore output
-  ierr = CeedVectorRestoreArray(*assembled, &a); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(lvec ? lvec : *assembled, &a); CeedChk(ierr);
+  if (lvec) {
+    CeedElemRestriction blkrstr;
+    ierr = CeedElemRestrictionCreateBlockedStrided(ceedparent, numelements, Q,
+           blksize, numactivein*numactiveout,
+           numactivein*numactiveout*numelements*Q, strides, &blkrstr);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionApply(blkrstr, CEED_TRANSPOSE, lvec, *assembled,
+                                    request); CeedChk(ierr);
+    ierr = CeedElemRestrictionDestroy(&blkrstr); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&lvec); CeedChk(ierr);
+  }
 
   // Cleanup
   for (CeedInt i=0; i<numactivein; i++) {
@@ -1178,6 +1828,78 @@ int CeedOperatorCreateFDMElementInverse_Ref(CeedOperator op,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Add Memory Usage of a Work Vector
+//------------------------------------------------------------------------------
+static int CeedOperatorAddVectorUsage_Ref(CeedVector vec, size_t *bytes) {
+  int ierr;
+  size_t vecbytes;
+
+  if (!vec) return 0;
+  ierr = CeedVectorGetMemoryUsage(vec, &vecbytes); CeedChk(ierr);
+  *bytes += vecbytes;
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// Operator Get Memory Usage
+//------------------------------------------------------------------------------
+static int CeedOperatorGetMemoryUsage_Ref(CeedOperator op, size_t *usage) {
+  int ierr;
+  CeedOperator_Ref *impl;
+  ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
+
+  // E-vectors shared between inputs are counted once
+  for (CeedInt i=0; i<impl->numein+impl->numeout; i++) {
+    if (i < impl->numein && impl->inputshared[i] >= 0)
+      continue;
+    ierr = CeedOperatorAddVectorUsage_Ref(impl->evecs[i],
+                                          &usage[CEED_MEMORY_EVEC]);
+    CeedChk(ierr);
+  }
+  for (CeedInt i=0; i<impl->numein; i++) {
+    if (impl->inputshared[i] < 0) {
+      ierr = CeedOperatorAddVectorUsage_Ref(impl->evecsin[i],
+                                            &usage[CEED_MEMORY_EVEC]);
+      CeedChk(ierr);
+    }
+    ierr = CeedOperatorAddVectorUsage_Ref(impl->qvecsin[i],
+                                          &usage[CEED_MEMORY_QVEC]);
+    CeedChk(ierr);
+    if (impl->qdatafused[i]) {
+      CeedInt length;
+      ierr = CeedVectorGetLength(impl->qvecsfused[i], &length); CeedChk(ierr);
+      usage[CEED_MEMORY_QVEC] += length*sizeof(CeedScalar);
+    }
+    if (impl->ereduced[i]) {
+      CeedInt nblk, elemsize, ncomp;
+      size_t bytes;
+      ierr = CeedElemRestrictionGetNumBlocks(impl->blkrestr[i], &nblk);
+      CeedChk(ierr);
+      ierr = CeedElemRestrictionGetElementSize(impl->blkrestr[i], &elemsize);
+      CeedChk(ierr);
+      ierr = CeedElemRestrictionGetNumComponents(impl->blkrestr[i], &ncomp);
+      CeedChk(ierr);
+      ierr = CeedFieldPrecisionGetSize(impl->inputprecision[i], &bytes);
+      CeedChk(ierr);
+      usage[CEED_MEMORY_PASSIVE] +=
+        (size_t)nblk*impl->blksize*elemsize*ncomp*bytes;
+    }
+  }
+  for (CeedInt i=0; i<impl->numeout; i++) {
+    ierr = CeedOperatorAddVectorUsage_Ref(impl->evecsout[i],
+                                          &usage[CEED_MEMORY_EVEC]);
+    CeedChk(ierr);
+    ierr = CeedOperatorAddVectorUsage_Ref(impl->escale[i],
+                                          &usage[CEED_MEMORY_EVEC]);
+    CeedChk(ierr);
+    ierr = CeedOperatorAddVectorUsage_Ref(impl->qvecsout[i],
+                                          &usage[CEED_MEMORY_QVEC]);
+    CeedChk(ierr);
+  }
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Operator Destroy
 //------------------------------------------------------------------------------
@@ -1187,25 +1909,42 @@ static int CeedOperatorDestroy_Ref(CeedOperator op) {
   ierr = CeedOperatorGetData(op, &impl); CeedChk(ierr);
 
   for (CeedInt i=0; i<impl->numein+impl->numeout; i++) {
+    ierr = CeedElemRestrictionDestroy(&impl->blkrestr[i]); CeedChk(ierr);
     ierr = CeedVectorDestroy(&impl->evecs[i]); CeedChk(ierr);
   }
+  ierr = CeedFree(&impl->blkrestr); CeedChk(ierr);
   ierr = CeedFree(&impl->evecs); CeedChk(ierr);
   ierr = CeedFree(&impl->edata); CeedChk(ierr);
   ierr = CeedFree(&impl->inputstate); CeedChk(ierr);
+  ierr = CeedFree(&impl->inputinplace); CeedChk(ierr);
+  ierr = CeedFree(&impl->inputprecision); CeedChk(ierr);
 
   for (CeedInt i=0; i<impl->numein; i++) {
     ierr = CeedVectorDestroy(&impl->evecsin[i]); CeedChk(ierr);
     ierr = CeedVectorDestroy(&impl->qvecsin[i]); CeedChk(ierr);
+    ierr = CeedFree(&impl->ereduced[i]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&impl->ereduced); CeedChk(ierr);
+  for (CeedInt i=0; i<impl->numein; i++) {
+    ierr = CeedVectorDestroy(&impl->qvecsfused[i]); CeedChk(ierr);
+    ierr = CeedFree(&impl->qdatafused[i]); CeedChk(ierr);
   }
   ierr = CeedFree(&impl->evecsin); CeedChk(ierr);
   ierr = CeedFree(&impl->qvecsin); CeedChk(ierr);
+  ierr = CeedFree(&impl->fusedgrad); CeedChk(ierr);
+  ierr = CeedFree(&impl->inputfused); CeedChk(ierr);
+  ierr = CeedFree(&impl->qvecsfused); CeedChk(ierr);
+  ierr = CeedFree(&impl->qdatafused); CeedChk(ierr);
+  ierr = CeedFree(&impl->inputshared); CeedChk(ierr);
 
   for (CeedInt i=0; i<impl->numeout; i++) {
     ierr = CeedVectorDestroy(&impl->evecsout[i]); CeedChk(ierr);
     ierr = CeedVectorDestroy(&impl->qvecsout[i]); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&impl->escale[i]); CeedChk(ierr);
   }
   ierr = CeedFree(&impl->evecsout); CeedChk(ierr);
   ierr = CeedFree(&impl->qvecsout); CeedChk(ierr);
+  ierr = CeedFree(&impl->escale); CeedChk(ierr);
 
   ierr = CeedFree(&impl); CeedChk(ierr);
   return 0;
@@ -1238,6 +1977,10 @@ int CeedOperatorCreate_Ref(CeedOperator op) {
   CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd",
                                 CeedOperatorApplyAdd_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyScaledAdd",
+                                CeedOperatorApplyScaledAdd_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "GetMemoryUsage",
+                                CeedOperatorGetMemoryUsage_Ref); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "Destroy",
                                 CeedOperatorDestroy_Ref); CeedChk(ierr);
   return 0;
@@ -1250,6 +1993,9 @@ int CeedCompositeOperatorCreate_Ref(CeedOperator op) {
   int ierr;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddComposite",
+                                CeedOperatorApplyAddComposite_Ref);
+  CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleAddDiagonal",
                                 CeedOperatorLinearAssembleAddDiagonal_Ref);
   CeedChk(ierr);
@@ -297,6 +297,24 @@ static int CeedElemRestrictionGetOffsets_Ref(CeedElemRestriction rstr,
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// ElemRestriction Get Memory Usage
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionGetMemoryUsage_Ref(CeedElemRestriction r,
+    size_t *bytes) {
+  int ierr;
+  CeedElemRestriction_Ref *impl;
+  ierr = CeedElemRestrictionGetData(r, &impl); CeedChk(ierr);
+  CeedInt nblk, blksize, elemsize;
+  ierr = CeedElemRestrictionGetNumBlocks(r, &nblk); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetBlockSize(r, &blksize); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(r, &elemsize); CeedChk(ierr);
+
+  *bytes = impl->offsets_allocated ?
+           (size_t)nblk*blksize*elemsize*sizeof(CeedInt) : 0;
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // ElemRestriction Destroy
 //------------------------------------------------------------------------------
@@ -390,6 +408,9 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mtype, CeedCopyMode cmode,
   ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "GetOffsets",
                                 CeedElemRestrictionGetOffsets_Ref);
   CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "GetMemoryUsage",
+                                CeedElemRestrictionGetMemoryUsage_Ref);
+  CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "ElemRestriction", r, "Destroy",
                                 CeedElemRestrictionDestroy_Ref); CeedChk(ierr);
 
@@ -130,6 +130,20 @@ static int CeedVectorRestoreArrayRead_Ref(CeedVector vec) {
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Vector Get Memory Usage
+//------------------------------------------------------------------------------
+static int CeedVectorGetMemoryUsage_Ref(CeedVector vec, size_t *bytes) {
+  int ierr;
+  CeedVector_Ref *impl;
+  ierr = CeedVectorGetData(vec, &impl); CeedChk(ierr);
+  CeedInt length;
+  ierr = CeedVectorGetLength(vec, &length); CeedChk(ierr);
+
+  *bytes = impl->array_allocated ? length*sizeof(CeedScalar) : 0;
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Vector Destroy
 //------------------------------------------------------------------------------
@@ -164,6 +178,8 @@ int CeedVectorCreate_Ref(CeedInt n, CeedVector vec) {
                                 CeedVectorRestoreArray_Ref); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Vector", vec, "RestoreArrayRead",
                                 CeedVectorRestoreArrayRead_Ref); CeedChk(ierr);
+  ierr = CeedSetBackendFunction(ceed, "Vector", vec, "GetMemoryUsage",
+                                CeedVectorGetMemoryUsage_Ref); CeedChk(ierr);
   ierr = CeedSetBackendFunction(ceed, "Vector", vec, "Destroy",
                                 CeedVectorDestroy_Ref); CeedChk(ierr);
   ierr = CeedCalloc(1,&impl); CeedChk(ierr);
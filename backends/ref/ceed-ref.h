@@ -18,6 +18,9 @@
 #include <string.h>
 #include <math.h>
 
+// Largest stack scratch of a tensor basis call on a batch of elements
+#define CEED_REF_BATCH_SCRATCH_MAX (1 << 21)
+
 typedef struct {
   CeedScalar *collograd1d;
   bool collointerp;
@@ -37,8 +40,6 @@ typedef struct {
 } CeedElemRestriction_Ref;
 
 typedef struct {
-  const CeedScalar **inputs;
-  CeedScalar **outputs;
   bool setupdone;
 } CeedQFunction_Ref;
 
@@ -49,14 +50,25 @@ typedef struct {
 
 typedef struct {
   bool identityqf;
+  CeedInt blksize;       /// Elements per basis and QFunction call
+  CeedElemRestriction *blkrestr; /// Field restrictions in the batch layout
   CeedVector
-  *evecs;   /// E-vectors needed to apply operator (input followed by outputs)
+  *evecs;   /// Full E-vectors of passive inputs, restricted on state change
   CeedScalar **edata;
   uint64_t *inputstate;  /// State counter of inputs
-  CeedVector *evecsin;   /// Input E-vectors needed to apply operator
-  CeedVector *evecsout;  /// Output E-vectors needed to apply operator
+  bool *inputinplace;    /// Inputs read in place from the L-vector
+  CeedFieldPrecision *inputprecision; /// Storage precision of inputs
+  void **ereduced;       /// Full E-vectors of reduced precision inputs
+  CeedVector *evecsin;   /// Input element E-vectors needed to apply operator
+  CeedVector *evecsout;  /// Output element E-vectors needed to apply operator
   CeedVector *qvecsin;   /// Input Q-vectors needed to apply operator
   CeedVector *qvecsout;  /// Output Q-vectors needed to apply operator
+  CeedVector *escale;    /// Scaled output element E-vectors
+  CeedInt *fusedgrad;    /// GRAD input evaluated with each INTERP input, or -1
+  bool *inputfused;      /// GRAD inputs evaluated with an INTERP input
+  CeedVector *qvecsfused;    /// Combined INTERP and GRAD input Q-vectors
+  CeedScalar **qdatafused;   /// Arrays of the combined Q-vectors
+  CeedInt *inputshared;  /// Earlier input sharing each input's E-vectors, or -1
   CeedInt    numein;
   CeedInt    numeout;
 } CeedOperator_Ref;
@@ -89,6 +89,33 @@ static int CeedTensorContractDestroy_Xsmm(CeedTensorContract contract) {
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Tensor Contract Build Kernel
+//------------------------------------------------------------------------------
+static int CeedTensorContractBuildKernel_Xsmm(Ceed ceed,
+    CeedTensorContract_Xsmm *impl, CeedInt B, CeedInt C, CeedInt J,
+    CeedInt tmode, CeedInt add) {
+  const int flags = LIBXSMM_GEMM_FLAGS('N', tmode ? 'T' : 'N');
+  // Add key, kernel pair to hash table
+  CeedHashIJKLMKey key = {B, C, J, tmode, add};
+  int new_item;
+  khint_t k = kh_put(m32, impl->lookup, key, &new_item);
+  if (new_item) {
+    // Build kernel
+    CeedScalar alpha = 1.0, beta = 1.0;
+    if (!add) beta = 0.0;
+    libxsmm_dmmfunction kernel = libxsmm_dmmdispatch(
+                                   C, J, B, NULL, NULL, NULL, &alpha, &beta, &flags, NULL);
+    if (!kernel)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "LIBXSMM kernel failed to build.");
+    // LCOV_EXCL_STOP
+    // Add kernel to hash table
+    kh_value(impl->lookup, k) = kernel;
+  }
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 // Tensor Contract Create
 //------------------------------------------------------------------------------
@@ -115,26 +142,18 @@ int CeedTensorContractCreate_Xsmm(CeedBasis basis,
         for (CeedInt tmode = 0; tmode <= 1; tmode++)
           for (CeedInt grad = 0; grad <=1; grad++)
             for (CeedInt dim = 0; dim < impl->dim; dim++) {
-              const int flags = LIBXSMM_GEMM_FLAGS('N', tmode ? 'T' : 'N');
               CeedInt B = grad ? impl->Q : (tmode ? impl->Q : impl->P),
                       J = grad ? impl->Q : (tmode ? impl->P : impl->Q),
                       C = nelem*CeedIntPow(J, dim);
-              // Add key, kernel pair to hash table
-              CeedHashIJKLMKey key = {B, C, J, tmode, add};
-              int new_item;
-              khint_t k = kh_put(m32, impl->lookup, key, &new_item);
-              if (new_item) {
-                // Build kernel
-                CeedScalar alpha = 1.0, beta = 1.0;
-                if (!add) beta = 0.0;
-                libxsmm_dmmfunction kernel = libxsmm_dmmdispatch(
-                                               C, J, B, NULL, NULL, NULL, &alpha, &beta, &flags, NULL);
-                if (!kernel)
-                  // LCOV_EXCL_START
-                  return CeedError(ceed, 1, "LIBXSMM kernel failed to build.");
-                // LCOV_EXCL_STOP
-                // Add kernel to hash table
-                kh_value(impl->lookup, k) = kernel;
+              ierr = CeedTensorContractBuildKernel_Xsmm(ceed, impl, B, C, J,
+                     tmode, add); CeedChk(ierr);
+              // Kernels for the even and odd parts of symmetric 1D matrices,
+              //   see CeedTensorContractAddEvenOdd()
+              if (B >= 2 && J >= 2) {
+                ierr = CeedTensorContractBuildKernel_Xsmm(ceed, impl, (B+1)/2,
+                       C, (J+1)/2, CEED_NOTRANSPOSE, 0); CeedChk(ierr);
+                ierr = CeedTensorContractBuildKernel_Xsmm(ceed, impl, B/2, C,
+                       (J+1)/2, CEED_NOTRANSPOSE, 0); CeedChk(ierr);
               }
             }
   } else {
@@ -147,27 +166,11 @@ int CeedTensorContractCreate_Xsmm(CeedBasis basis,
         for (CeedInt tmode = 0; tmode <= 1; tmode++) {
           CeedInt gradstride = CeedIntMax(impl->dim-1, 1);
           for (CeedInt grad = 1; grad <= impl->dim; grad+=gradstride) {
-            const int flags = LIBXSMM_GEMM_FLAGS('N', tmode ? 'T' : 'N');
             CeedInt B = tmode ? grad*impl->Q : impl->P,
                     J = tmode ? impl->P : grad*impl->Q,
                     C = nelem;
-            // Add key, kernel pair to hash table
-            CeedHashIJKLMKey key = {B, C, J, tmode, add};
-            int new_item;
-            khint_t k = kh_put(m32, impl->lookup, key, &new_item);
-            if (new_item) {
-              // Build kernel
-              CeedScalar alpha = 1.0, beta = 1.0;
-              if (!add) beta = 0.0;
-              libxsmm_dmmfunction kernel = libxsmm_dmmdispatch(
-                                             C, J, B, NULL, NULL, NULL, &alpha, &beta, &flags, NULL);
-              if (!kernel)
-                // LCOV_EXCL_START
-                return CeedError(ceed, 1, "LIBXSMM kernel failed to build.");
-              // LCOV_EXCL_STOP
-              // Add kernel to hash table
-              kh_value(impl->lookup, k) = kernel;
-            }
+            ierr = CeedTensorContractBuildKernel_Xsmm(ceed, impl, B, C, J,
+                   tmode, add); CeedChk(ierr);
           }
         }
   }
@@ -23,6 +23,7 @@
 #ifndef __CUDACC__
 #  include <math.h>
 #endif
+#include <ceed-math.h>
 
 #ifndef setup_context_struct
 #define setup_context_struct
@@ -144,14 +145,14 @@ static inline int Exact_Advection(CeedInt dim, CeedScalar time,
   switch (dimBubble) {
   //  original sphere
   case 3: {
-    r = sqrt(pow((x - x0[0]), 2) +
-             pow((y - x0[1]), 2) +
-             pow((z - x0[2]), 2));
+    r = CeedSqrt((x - x0[0])*(x - x0[0]) +
+                 (y - x0[1])*(y - x0[1]) +
+                 (z - x0[2])*(z - x0[2]));
   } break;
   // cylinder (needs periodicity to work properly)
   case 2: {
-    r = sqrt(pow((x - x0[0]), 2) +
-             pow((y - x0[1]), 2) );
+    r = CeedSqrt((x - x0[0])*(x - x0[0]) +
+                 (y - x0[1])*(y - x0[1]));
   } break;
   }
 
@@ -341,7 +342,7 @@ CEED_QFUNCTION(Advection)(void *ctx, CeedInt Q,
     CeedScalar uX[3];
     for (CeedInt j=0; j<3;
          j++) uX[j] = dXdx[j][0]*u[0] + dXdx[j][1]*u[1] + dXdx[j][2]*u[2];
-    const CeedScalar TauS = CtauS / sqrt(uX[0]*uX[0] + uX[1]*uX[1] + uX[2]*uX[2]);
+    const CeedScalar TauS = CtauS / CeedSqrt(uX[0]*uX[0] + uX[1]*uX[1] + uX[2]*uX[2]);
     for (CeedInt j=0; j<3; j++)
       dv[j][4][i] -= wdetJ * TauS * strongConv * uX[j];
   } // End Quadrature Point Loop
@@ -467,7 +468,7 @@ CEED_QFUNCTION(IFunction_Advection)(void *ctx, CeedInt Q,
     CeedScalar uX[3];
     for (CeedInt j=0; j<3;
          j++) uX[j] = dXdx[j][0]*u[0] + dXdx[j][1]*u[1] + dXdx[j][2]*u[2];
-    const CeedScalar TauS = CtauS / sqrt(uX[0]*uX[0] + uX[1]*uX[1] + uX[2]*uX[2]);
+    const CeedScalar TauS = CtauS / CeedSqrt(uX[0]*uX[0] + uX[1]*uX[1] + uX[2]*uX[2]);
 
     for (CeedInt j=0; j<3; j++)
       switch (context->stabilization) {
@@ -27,6 +27,7 @@
 #ifndef __CUDACC__
 #  include <math.h>
 #endif
+#include <ceed-math.h>
 
 #ifndef M_PI
 #define M_PI    3.14159265358979323846
@@ -145,13 +146,13 @@ static inline int Exact_DC(CeedInt dim, CeedScalar time, const CeedScalar X[],
   for (CeedInt i=0; i<3; i++)
     rr[i] -= dc_axis[i] *
              (dc_axis[0]*rr[0] + dc_axis[1]*rr[1] + dc_axis[2]*rr[2]);
-  const CeedScalar r = sqrt(rr[0]*rr[0] + rr[1]*rr[1] + rr[2]*rr[2]);
+  const CeedScalar r = CeedSqrt(rr[0]*rr[0] + rr[1]*rr[1] + rr[2]*rr[2]);
   const CeedScalar deltatheta = r <= rc ? thetaC*(1. + cos(M_PI*r/rc))/2. : 0.;
-  const CeedScalar theta = theta0*exp(N*N*z/g) + deltatheta;
+  const CeedScalar theta = theta0*CeedExp(N*N*z/g) + deltatheta;
   // -- Exner pressure, hydrostatic balance
-  const CeedScalar Pi = 1. + g*g*(exp(-N*N*z/g) - 1.) / (cp*theta0*N*N);
+  const CeedScalar Pi = 1. + g*g*(CeedExp(-N*N*z/g) - 1.) / (cp*theta0*N*N);
   // -- Density
-  const CeedScalar rho = P0 * pow(Pi, cv/Rd) / (Rd*theta);
+  const CeedScalar rho = P0 * CeedPow(Pi, cv/Rd) / (Rd*theta);
 
   // Initial Conditions
   q[0] = rho;
@@ -455,7 +456,7 @@ CEED_QFUNCTION(DC)(void *ctx, CeedInt Q,
     const CeedScalar uiujgij = uX[0]*uX[0] + uX[1]*uX[1] + uX[2]*uX[2];
     const CeedScalar Cc   = 1.;
     const CeedScalar Ce   = 1.;
-    const CeedScalar f1   = rho * sqrt(uiujgij);
+    const CeedScalar f1   = rho * CeedSqrt(uiujgij);
     const CeedScalar TauC = (Cc * f1) /
                             (8 * (dXdxdXdxT[0][0] + dXdxdXdxT[1][1] + dXdxdXdxT[2][2]));
     const CeedScalar TauM = 1. / (f1>1. ? f1 : 1.);
@@ -722,7 +723,7 @@ CEED_QFUNCTION(IFunction_DC)(void *ctx, CeedInt Q,
     const CeedScalar uiujgij = uX[0]*uX[0] + uX[1]*uX[1] + uX[2]*uX[2];
     const CeedScalar Cc   = 1.;
     const CeedScalar Ce   = 1.;
-    const CeedScalar f1   = rho * sqrt(uiujgij);
+    const CeedScalar f1   = rho * CeedSqrt(uiujgij);
     const CeedScalar TauC = (Cc * f1) /
                             (8 * (dXdxdXdxT[0][0] + dXdxdXdxT[1][1] + dXdxdXdxT[2][2]));
     const CeedScalar TauM = 1. / (f1>1. ? f1 : 1.);
@@ -225,7 +225,7 @@ struct User_ {
   Mat interpviz;
   Ceed ceed;
   Units units;
-  CeedVector qceed, qdotceed, gceed;
+  CeedVector qceed, qdotceed, gceed, mceed;
   CeedOperator op_rhs_vol, op_rhs, op_ifunction_vol, op_ifunction;
   Vec M;
   char outputfolder[PETSC_MAX_PATH_LEN];
@@ -556,9 +556,10 @@ static PetscErrorCode RHS_NS(TS ts, PetscReal t, Vec Q, Vec G, void *userData) {
   CeedVectorSetArray(user->qceed, CEED_MEM_HOST, CEED_USE_POINTER, q);
   CeedVectorSetArray(user->gceed, CEED_MEM_HOST, CEED_USE_POINTER, g);
 
-  // Apply CEED operator
-  CeedOperatorApply(user->op_rhs, user->qceed, user->gceed,
-                    CEED_REQUEST_IMMEDIATE);
+  // Apply CEED operator and the inverse of the lumped mass matrix
+  //   The scaling commutes with the sum over processes in DMLocalToGlobal()
+  CeedOperatorApplyScaled(user->op_rhs, user->qceed, user->gceed, user->mceed,
+                          CEED_REQUEST_IMMEDIATE);
 
   // Restore vectors
   ierr = VecRestoreArrayRead(Qloc, (const PetscScalar **)&q); CHKERRQ(ierr);
@@ -567,10 +568,6 @@ static PetscErrorCode RHS_NS(TS ts, PetscReal t, Vec Q, Vec G, void *userData) {
   ierr = VecZeroEntries(G); CHKERRQ(ierr);
   ierr = DMLocalToGlobal(user->dm, Gloc, ADD_VALUES, G); CHKERRQ(ierr);
 
-  // Inverse of the lumped mass matrix
-  ierr = VecPointwiseMult(G, G, user->M); // M is Minv
-  CHKERRQ(ierr);
-
   ierr = DMRestoreLocalVector(user->dm, &Qloc); CHKERRQ(ierr);
   ierr = DMRestoreLocalVector(user->dm, &Gloc); CHKERRQ(ierr);
   PetscFunctionReturn(0);
@@ -1593,6 +1590,22 @@ int main(int argc, char **argv) {
   ierr = ComputeLumpedMassMatrix(ceed, dm, restrictq, basisq, restrictqdi, qdata,
                                  user->M); CHKERRQ(ierr);
 
+  // Local inverse lumped mass matrix, used to scale the RHS operator output;
+  //   copied, as the local PETSc vector is only borrowed here
+  CeedElemRestrictionCreateVector(restrictq, &user->mceed, NULL);
+  {
+    Vec Mloc;
+    const PetscScalar *m;
+    ierr = DMGetLocalVector(dm, &Mloc); CHKERRQ(ierr);
+    ierr = VecZeroEntries(Mloc); CHKERRQ(ierr);
+    ierr = DMGlobalToLocal(dm, user->M, INSERT_VALUES, Mloc); CHKERRQ(ierr);
+    ierr = VecGetArrayRead(Mloc, &m); CHKERRQ(ierr);
+    CeedVectorSetArray(user->mceed, CEED_MEM_HOST, CEED_COPY_VALUES,
+                       (PetscScalar *)m);
+    ierr = VecRestoreArrayRead(Mloc, &m); CHKERRQ(ierr);
+    ierr = DMRestoreLocalVector(dm, &Mloc); CHKERRQ(ierr);
+  }
+
   ierr = ICs_FixMultiplicity(op_ics, xcorners, q0ceed, dm, Qloc, Q, restrictq,
                              ctxSetup, 0.0); CHKERRQ(ierr);
   if (1) { // Record boundary values from initial condition and override DMPlexInsertBoundaryValues()
@@ -1755,6 +1768,7 @@ int main(int argc, char **argv) {
   CeedVectorDestroy(&user->qceed);
   CeedVectorDestroy(&user->qdotceed);
   CeedVectorDestroy(&user->gceed);
+  CeedVectorDestroy(&user->mceed);
   CeedVectorDestroy(&xcorners);
   CeedBasisDestroy(&basisq);
   CeedBasisDestroy(&basisx);
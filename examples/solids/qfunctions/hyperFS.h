@@ -23,6 +23,7 @@
 #ifndef __CUDACC__
 #  include <math.h>
 #endif
+#include <ceed-math.h>
 
 #ifndef PHYSICS_STRUCT
 #define PHYSICS_STRUCT
@@ -33,39 +34,6 @@ struct Physics_private {
 };
 #endif
 
-// -----------------------------------------------------------------------------
-// Series approximation of log1p()
-//  log1p() is not vectorized in libc
-//
-//  The series expansion is accurate to 1e-7 in the range sqrt(2)/2 < J < sqrt(2),
-//  with machine precision accuracy near J=1.  The initialization extends this range
-//  to 0.35 ~= sqrt(2)/4 < J < sqrt(2)*2 ~= 2.83, which should be sufficient for
-//  applications of the Neo-Hookean model.
-// -----------------------------------------------------------------------------
-static inline CeedScalar log1p_series_shifted(CeedScalar x) {
-  const CeedScalar left = sqrt(2.)/2 - 1, right = sqrt(2.) - 1;
-  CeedScalar sum = 0;
-  if (1) { // Disable if the smaller range sqrt(2) < J < sqrt(2) is sufficient
-    if (x < left) { // Replace if with while for arbitrary range (may hurt vectorization)
-      sum -= log(2.) / 2;
-      x = 1 + 2 * x;
-    } else if (right < x) {
-      sum += log(2.) / 2;
-      x = (x - 1) / 2;
-    }
-  }
-  CeedScalar y = x / (2. + x);
-  const CeedScalar y2 = y*y;
-  sum += y;
-  y *= y2;
-  sum += y / 3;
-  y *= y2;
-  sum += y / 5;
-  y *= y2;
-  sum += y / 7;
-  return 2 * sum;
-};
-
 // -----------------------------------------------------------------------------
 // Compute det C - 1
 // -----------------------------------------------------------------------------
@@ -131,7 +99,7 @@ static inline int commonFS(const CeedScalar lambda, const CeedScalar mu,
   // *INDENT-ON*
 
   // Compute the Second Piola-Kirchhoff (S)
-  (*llnj) = lambda*log1p_series_shifted(*detC_m1)/2.;
+  (*llnj) = lambda*CeedLog1p(*detC_m1)/2.;
   for (CeedInt m = 0; m < 6; m++) {
     Swork[m] = (*llnj)*Cinvwork[m];
     for (CeedInt n = 0; n < 3; n++)
@@ -544,7 +512,7 @@ CEED_QFUNCTION(HyperFSEnergy)(void *ctx, CeedInt Q, const CeedScalar *const *in,
     const CeedScalar detC_m1 = computeDetCM1(E2work);
 
     // Strain energy Phi(E) for compressible Neo-Hookean
-    CeedScalar logj = log1p_series_shifted(detC_m1)/2.;
+    CeedScalar logj = CeedLog1p(detC_m1)/2.;
     energy[i] = (lambda*logj*logj/2. - mu*logj +
                  mu*(E2[0][0] + E2[1][1] + E2[2][2])/2.) * wdetJ;
 
@@ -640,7 +608,7 @@ CEED_QFUNCTION(HyperFSDiagnostic)(void *ctx, CeedInt Q,
 
     // Pressure
     const CeedScalar detC_m1 = computeDetCM1(E2work);
-    CeedScalar logj = log1p_series_shifted(detC_m1)/2.;
+    CeedScalar logj = CeedLog1p(detC_m1)/2.;
     diagnostic[3][i] = -lambda*logj;
 
     // Stress tensor invariants
@@ -23,6 +23,7 @@
 #ifndef __CUDACC__
 #  include <math.h>
 #endif
+#include <ceed-math.h>
 
 #ifndef PHYSICS_STRUCT
 #define PHYSICS_STRUCT
@@ -33,27 +34,6 @@ struct Physics_private {
 };
 #endif
 
-// -----------------------------------------------------------------------------
-// Series approximation of log1p()
-//  log1p() is not vectorized in libc
-//
-//  The series expansion is accurate to 1e-7 in the range sqrt(2)/2 < J < sqrt(2),
-//  with machine precision accuracy near J=1.
-// -----------------------------------------------------------------------------
-static inline CeedScalar log1p_series(CeedScalar x) {
-  CeedScalar sum = 0;
-  CeedScalar y = x / (2. + x);
-  const CeedScalar y2 = y*y;
-  sum += y;
-  y *= y2;
-  sum += y / 3;
-  y *= y2;
-  sum += y / 5;
-  y *= y2;
-  sum += y / 7;
-  return 2 * sum;
-};
-
 // -----------------------------------------------------------------------------
 // Residual evaluation for hyperelasticity, small strain
 // -----------------------------------------------------------------------------
@@ -154,7 +134,7 @@ CEED_QFUNCTION(HyperSSF)(void *ctx, CeedInt Q, const CeedScalar *const *in,
     // Above Voigt Notation is placed in a 3x3 matrix:
     // Volumetric strain
     const CeedScalar strain_vol = e[0][0] + e[1][1] + e[2][2];
-    const CeedScalar llv = log1p_series(strain_vol);
+    const CeedScalar llv = CeedLog1p(strain_vol);
     const CeedScalar sigma00 = lambda*llv + TwoMu*e[0][0],
                      sigma11 = lambda*llv + TwoMu*e[1][1],
                      sigma22 = lambda*llv + TwoMu*e[2][2],
@@ -403,7 +383,7 @@ CEED_QFUNCTION(HyperSSEnergy)(void *ctx, CeedInt Q, const CeedScalar *const *in,
 
     // Strain Energy
     const CeedScalar strain_vol = e[0][0] + e[1][1] + e[2][2];
-    const CeedScalar llv = log1p_series(strain_vol);
+    const CeedScalar llv = CeedLog1p(strain_vol);
     energy[i] = (lambda*(1 + strain_vol)*(llv - 1) + strain_vol*mu +
                  (e[0][1]*e[0][1]+e[0][2]*e[0][2]+e[1][2]*e[1][2])*2*mu)*wdetJ;
 
@@ -501,7 +481,7 @@ CEED_QFUNCTION(HyperSSDiagnostic)(void *ctx, CeedInt Q,
 
     // Pressure
     const CeedScalar strain_vol = e[0][0] + e[1][1] + e[2][2];
-    const CeedScalar llv = log1p_series(strain_vol);
+    const CeedScalar llv = CeedLog1p(strain_vol);
     diagnostic[3][i] = -lambda*llv;
 
     // Stress tensor invariants
@@ -27,6 +27,7 @@
 #define CEED_MAX_RESOURCE_LEN 1024
 #define CEED_ALIGN 64
 #define CEED_COMPOSITE_MAX 16
+#define CEED_TENSOR_EVENODD_MAX 4
 #define CEED_EPSILON 1E-16
 
 /// CEED_DEBUG_COLOR default value, forward CeedDebug* declarations & macros
@@ -58,6 +59,7 @@ CEED_INTERN int CeedFree(void *p);
 #define CeedMalloc(n, p) CeedMallocArray((n), sizeof(**(p)), p)
 #define CeedCalloc(n, p) CeedCallocArray((n), sizeof(**(p)), p)
 #define CeedRealloc(n, p) CeedReallocArray((n), sizeof(**(p)), p)
+CEED_INTERN int CeedUntrackArray(const void *ptr);
 
 /// Handle for object describing CeedQFunction fields
 /// @ingroup CeedQFunctionBackend
@@ -116,6 +118,8 @@ CEED_EXTERN int CeedElemRestrictionGetData(CeedElemRestriction rstr,
     void *data);
 CEED_EXTERN int CeedElemRestrictionSetData(CeedElemRestriction rstr,
     void *data);
+CEED_EXTERN int CeedElemRestrictionGetBlocked(CeedElemRestriction rstr,
+    CeedInt blksize, CeedElemRestriction *blkrstr);
 
 CEED_EXTERN int CeedBasisGetCollocatedGrad(CeedBasis basis,
     CeedScalar *colograd1d);
@@ -124,6 +128,10 @@ CEED_EXTERN int CeedHouseholderApplyQ(CeedScalar *A, const CeedScalar *Q,
                                       CeedInt k, CeedInt row, CeedInt col);
 CEED_EXTERN int CeedBasisGetCeed(CeedBasis basis, Ceed *ceed);
 CEED_EXTERN int CeedBasisIsTensor(CeedBasis basis, bool *istensor);
+CEED_EXTERN int CeedBasisIsCollapsed(CeedBasis basis, bool *iscollapsed);
+CEED_EXTERN int CeedBasisGetCollapsedData(CeedBasis basis, CeedInt *P1d,
+    CeedInt *Q1d, const CeedScalar **qref1d, const CeedScalar **interp,
+    const CeedScalar **deriv);
 CEED_EXTERN int CeedBasisGetData(CeedBasis basis, void *data);
 CEED_EXTERN int CeedBasisSetData(CeedBasis basis, void *data);
 
@@ -134,6 +142,8 @@ CEED_EXTERN int CeedBasisGetTensorContract(CeedBasis basis,
     CeedTensorContract *contract);
 CEED_EXTERN int CeedBasisSetTensorContract(CeedBasis basis,
     CeedTensorContract *contract);
+CEED_EXTERN int CeedBasisGetFlopsEstimate(CeedBasis basis,
+    CeedTransposeMode tmode, CeedEvalMode emode, size_t *flops);
 CEED_EXTERN int CeedTensorContractCreate(Ceed ceed, CeedBasis basis,
     CeedTensorContract *contract);
 CEED_EXTERN int CeedTensorContractApply(CeedTensorContract contract, CeedInt A,
@@ -149,6 +159,8 @@ CEED_EXTERN int CeedTensorContractGetData(CeedTensorContract contract,
     void *data);
 CEED_EXTERN int CeedTensorContractSetData(CeedTensorContract contract,
     void *data);
+CEED_EXTERN int CeedTensorContractAddEvenOdd(CeedTensorContract contract,
+    const CeedScalar *t, CeedInt J, CeedInt B);
 CEED_EXTERN int CeedTensorContractDestroy(CeedTensorContract *contract);
 
 CEED_EXTERN int CeedQFunctionRegister(const char *, const char *, CeedInt,
@@ -168,6 +180,8 @@ CEED_EXTERN int CeedQFunctionGetContext(CeedQFunction qf,
 CEED_EXTERN int CeedQFunctionGetInnerContext(CeedQFunction qf,
     CeedQFunctionContext *ctx);
 CEED_EXTERN int CeedQFunctionIsIdentity(CeedQFunction qf, bool *isidentity);
+CEED_EXTERN int CeedQFunctionGetUserFlopsEstimate(CeedQFunction qf,
+    size_t *flops);
 CEED_EXTERN int CeedQFunctionGetData(CeedQFunction qf, void *data);
 CEED_EXTERN int CeedQFunctionSetData(CeedQFunction qf, void *data);
 CEED_EXTERN int CeedQFunctionGetFields(CeedQFunction qf,
@@ -196,6 +210,8 @@ CEED_EXTERN int CeedOperatorGetNumElements(CeedOperator op, CeedInt *numelem);
 CEED_EXTERN int CeedOperatorGetNumQuadraturePoints(CeedOperator op,
     CeedInt *numqpts);
 CEED_EXTERN int CeedOperatorGetNumArgs(CeedOperator op, CeedInt *numargs);
+CEED_EXTERN int CeedOperatorGetBatchSize(CeedOperator op, CeedInt *batchsize);
+CEED_EXTERN int CeedOperatorGetName(CeedOperator op, const char **name);
 CEED_EXTERN int CeedOperatorIsSetupDone(CeedOperator op, bool *issetupdone);
 CEED_EXTERN int CeedOperatorGetQFunction(CeedOperator op, CeedQFunction *qf);
 CEED_EXTERN int CeedOperatorIsComposite(CeedOperator op, bool *iscomposite);
@@ -215,9 +231,22 @@ CEED_EXTERN int CeedOperatorFieldGetBasis(CeedOperatorField opfield,
     CeedBasis *basis);
 CEED_EXTERN int CeedOperatorFieldGetVector(CeedOperatorField opfield,
     CeedVector *vec);
+CEED_EXTERN int CeedOperatorFieldGetPrecision(CeedOperatorField opfield,
+    CeedFieldPrecision *precision);
+CEED_EXTERN int CeedFieldPrecisionGetSize(CeedFieldPrecision precision,
+    size_t *size);
+CEED_EXTERN int CeedFieldPrecisionPack(CeedFieldPrecision precision,
+                                       CeedInt n, const CeedScalar *in,
+                                       void *out);
+CEED_EXTERN int CeedFieldPrecisionUnpack(CeedFieldPrecision precision,
+    CeedInt n, const void *in, CeedScalar *out);
 
 CEED_INTERN int CeedMatrixMultiply(Ceed ceed, const CeedScalar *matA,
                                    const CeedScalar *matB, CeedScalar *matC,
                                    CeedInt m, CeedInt n, CeedInt kk);
+CEED_INTERN int CeedOperatorMultigridLevelCreateFused(CeedOperator opFine,
+    CeedVector PMultFine, CeedElemRestriction rstrCoarse, CeedBasis basisCoarse,
+    CeedOperator *opCoarse, CeedOperator *opProlong, CeedOperator *opRestrict,
+    CeedVector *multInv);
 
 #endif
@@ -78,6 +78,68 @@
     @ingroup CeedOperator
 */
 
+// Atomic update of reference counts, access states, and reader counts, which
+//   may be shared between operators applied from different threads; evaluates
+//   to the updated value
+// Atomic compare and exchange of shared pointers; sets x to v if x equals old,
+//   otherwise stores the current value of x in old, and evaluates to success
+#if defined(__GNUC__) || defined(__clang__)
+#  define CeedAtomicAdd(x, v) __atomic_add_fetch(&(x), (v), __ATOMIC_ACQ_REL)
+#  define CeedAtomicCompareExchange(x, old, v) \
+     __atomic_compare_exchange_n(&(x), &(old), (v), false, __ATOMIC_ACQ_REL, \
+                                 __ATOMIC_ACQUIRE)
+#else
+#  define CeedAtomicAdd(x, v) ((x) += (v))
+#  define CeedAtomicCompareExchange(x, old, v) \
+     ((x) == (old) ? ((x) = (v), true) : ((old) = (x), false))
+#endif
+
+// Spin lock guarding short updates of lists and tables shared between threads
+#if defined(__GNUC__) || defined(__clang__)
+#  define CeedLockAcquire(x) \
+     while (__atomic_test_and_set(&(x), __ATOMIC_ACQUIRE)) {}
+#  define CeedLockRelease(x) __atomic_clear(&(x), __ATOMIC_RELEASE)
+#else
+#  define CeedLockAcquire(x)
+#  define CeedLockRelease(x)
+#endif
+
+// Categories of trace spans; restriction, basis, and QFunction calls are the
+//   stages of an operator application
+typedef enum {
+  CEED_TRACE_RESTRICTION = 0,
+  CEED_TRACE_BASIS = 1,
+  CEED_TRACE_QFUNCTION = 2,
+  CEED_TRACE_OPERATOR = 3,
+  CEED_TRACE_ASSEMBLY = 4,
+} CeedTraceCategory;
+
+// Hardware counters sampled with perf_event_open on Linux
+typedef enum {
+  CEED_COUNTER_CYCLES = 0,
+  CEED_COUNTER_INSTRUCTIONS = 1,
+  CEED_COUNTER_L1D_LOADS = 2,
+  CEED_COUNTER_L1D_LOAD_MISSES = 3,
+  CEED_COUNTER_LLC_REFERENCES = 4,
+  CEED_COUNTER_LLC_MISSES = 5,
+  CEED_NUM_COUNTERS = 6,
+} CeedCounter;
+
+// Time and counters at the start of a trace span
+typedef struct {
+  double time;                           /// Time in seconds, or 0 if disabled
+  uint64_t counters[CEED_NUM_COUNTERS];
+  CeedOperator op, prevop;               /// Operator applied in the span
+} CeedTraceSample;
+
+// Totals of the operator applications or stages of one CeedOperator
+typedef struct {
+  CeedInt calls;
+  double time;
+  double flops;                          /// Estimated flops
+  uint64_t counters[CEED_NUM_COUNTERS];
+} CeedStageStats;
+
 // Lookup table field for backend functions
 typedef struct {
   const char *fname;
@@ -123,6 +185,9 @@ struct Ceed_private {
   bool isDeterministic;
   void *data;
   bool debug;
+  bool traced; /// Registered with the trace file named by CEED_TRACE
+  CeedBasis basiscache; /// Tensor bases shared by CeedBasisCreateTensorH1()
+  bool basiscachelock; /// Lock of basiscache and the references taken from it
   char errmsg[CEED_MAX_RESOURCE_LEN];
   foffset *foffsets;
 };
@@ -139,6 +204,9 @@ struct CeedVector_private {
   int (*RestoreArrayRead)(CeedVector);
   int (*Norm)(CeedVector, CeedNormType, CeedScalar *);
   int (*Reciprocal)(CeedVector);
+  int (*Scale)(CeedVector, CeedScalar);
+  int (*PointwiseMult)(CeedVector, CeedVector, CeedVector);
+  int (*GetMemoryUsage)(CeedVector, size_t *);
   int (*Destroy)(CeedVector);
   int refcount;
   CeedInt length;
@@ -154,6 +222,7 @@ struct CeedElemRestriction_private {
   int (*ApplyBlock)(CeedElemRestriction, CeedInt, CeedTransposeMode, CeedVector,
                     CeedVector, CeedRequest *);
   int (*GetOffsets)(CeedElemRestriction, CeedMemType, const CeedInt **);
+  int (*GetMemoryUsage)(CeedElemRestriction, size_t *);
   int (*Destroy)(CeedElemRestriction);
   int refcount;
   CeedInt nelem;            /* number of elements */
@@ -167,6 +236,8 @@ struct CeedElemRestriction_private {
   CeedInt *strides;         /* strides between [nodes, components, elements] */
   CeedInt layout[3];        /* E-vector layout [nodes, components, elements] */
   uint64_t numreaders;      /* number of instances of offset read only access */
+  CeedElemRestriction blocked; /* shared blocked copy, see
+                                    CeedElemRestrictionGetBlocked() */
   void *data;               /* place for the backend to store any data */
 };
 
@@ -174,6 +245,9 @@ struct CeedBasis_private {
   Ceed ceed;
   int (*Apply)(CeedBasis, CeedInt, CeedTransposeMode, CeedEvalMode,
                CeedVector, CeedVector);
+  int (*ApplyInterpGrad)(CeedBasis, CeedInt, CeedTransposeMode, CeedVector,
+                         CeedVector);
+  int (*GetMemoryUsage)(CeedBasis, size_t *);
   int (*Destroy)(CeedBasis);
   int refcount;
   bool tensorbasis;      /* flag for tensor basis */
@@ -201,10 +275,35 @@ struct CeedBasis_private {
   CeedScalar
   *grad1d;    /* row-major matrix of shape [Q1d, P1d] matrix expressing
                    derivatives of nodal basis functions at quadrature points */
+  bool cached;           /* flag for basis shared through Ceed basiscache */
+  bool lagrange;         /* flag for basis from
+                              CeedBasisCreateTensorH1Lagrange() */
+  CeedQuadMode qmode;    /* quadrature of a Lagrange basis */
+  CeedBasis cachenext;   /* next basis shared through Ceed basiscache */
+  bool collapsed;        /* flag for collapsed coordinate simplex basis */
+  CeedScalar
+  *collapsedqref1d; /* array of length Q1d holding the quadrature points in
+                         each collapsed coordinate on [0, 1] */
+  CeedScalar
+  *collapsedinterp[3]; /* row-major matrices of shape [Q1d, ncols] holding the
+                            factors of the basis functions in each collapsed
+                            coordinate, with ncols = P1d, number of (p,q)
+                            mode pairs, and number of modes */
+  CeedScalar
+  *collapsedderiv[3];  /* derivatives of the factors in collapsedinterp */
   CeedTensorContract contract; /* tensor contraction object */
   void *data;                  /* place for the backend to store any data */
 };
 
+// Even-odd decomposition of a 1D basis matrix for tensor contractions
+typedef struct {
+  const CeedScalar *t; /* matrix, identified by address */
+  CeedInt J, B;        /* number of rows and columns of t */
+  CeedInt parity;      /* 1 if t is centrosymmetric, -1 if skew-centrosymmetric */
+  CeedScalar *even[2]; /* even parts, for CEED_NOTRANSPOSE and CEED_TRANSPOSE */
+  CeedScalar *odd[2];  /* odd parts, for CEED_NOTRANSPOSE and CEED_TRANSPOSE */
+} CeedTensorContractEvenOdd;
+
 struct CeedTensorContract_private {
   Ceed ceed;
   int (*Apply)(CeedTensorContract, CeedInt, CeedInt, CeedInt, CeedInt,
@@ -212,6 +311,11 @@ struct CeedTensorContract_private {
                const CeedScalar *restrict, CeedScalar *restrict);
   int (*Destroy)(CeedTensorContract);
   int refcount;
+  CeedInt numevenodd;                  /* number of decomposed matrices */
+  CeedTensorContractEvenOdd evenodd[CEED_TENSOR_EVENODD_MAX];
+  CeedScalar *evenoddwork;             /* folded input and output scratch */
+  CeedInt evenoddworksize;             /* allocated length of evenoddwork */
+  bool evenoddworkbusy;                /* evenoddwork is in use */
   void *data;
 };
 
@@ -238,6 +342,7 @@ struct CeedQFunction_private {
   const char *qfname;
   bool identity;
   bool fortranstatus;
+  size_t userflops;    /* estimated flops per quadrature point, or 0 */
   CeedQFunctionContext ctx; /* user context for function */
   void *data;          /* place for the backend to store any data */
 };
@@ -250,6 +355,7 @@ struct CeedQFunctionContext_private {
   int (*RestoreData)(CeedQFunctionContext);
   int (*Destroy)(CeedQFunctionContext);
   uint64_t state;
+  uint64_t numreaders;
   size_t ctxsize;
   void *data;
 };
@@ -283,6 +389,7 @@ struct CeedOperatorField_private {
   CeedVector vec;                /* State vector for passive fields or
                                       CEED_VECTOR_NONE for no vector */
   const char *fieldname;         /* matching QFunction field name */
+  CeedFieldPrecision precision;  /* storage precision of passive inputs */
 };
 
 struct CeedOperator_private {
@@ -303,14 +410,20 @@ struct CeedOperator_private {
   int (*ApplyComposite)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyAdd)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyAddComposite)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
+  int (*ApplyScaledAdd)(CeedOperator, CeedVector, CeedVector, CeedScalar,
+                        CeedVector, CeedRequest *);
   int (*ApplyJacobian)(CeedOperator, CeedVector, CeedVector, CeedVector,
                        CeedVector, CeedRequest *);
+  int (*GetMemoryUsage)(CeedOperator, size_t *);
   int (*Destroy)(CeedOperator);
   CeedOperatorField *inputfields;
   CeedOperatorField *outputfields;
   CeedInt numelements; /// Number of elements
   CeedInt numqpoints;  /// Number of quadrature points over all elements
   CeedInt nfields;     /// Number of fields that have been set
+  CeedInt batchsize;   /// Elements per batch requested, or 0 for the default
+  char *name;          /// Name for views and traces, or NULL
+  CeedStageStats *stagestats; /// Per stage totals, with CEED_PERF_COUNTERS
   CeedQFunction qf;
   CeedQFunction dqf;
   CeedQFunction dqfT;
@@ -319,7 +432,48 @@ struct CeedOperator_private {
   bool hasrestriction;
   CeedOperator *suboperators;
   CeedInt numsub;
+  CeedOperatorStrategy strategy; /// Requested apply strategy
+  bool strategyset;        /// Apply strategy has been resolved
+  bool useassembled;       /// Resolved strategy is assembled CSR
+  CeedInt csrnrows;        /// Number of rows in assembled CSR matrix
+  CeedInt csrncols;        /// Number of columns in assembled CSR matrix
+  CeedInt *csrrowptr;      /// Row pointers of assembled CSR matrix
+  CeedInt *csrcolind;      /// Column indices of assembled CSR matrix
+  CeedScalar *csrvals;     /// Values of assembled CSR matrix
+  uint64_t *csrinputstate; /// Passive input states at CSR assembly
+  uint64_t csrctxstate;    /// QFunction context state at CSR assembly
+  double probetime[2];     /// Matrix-free and CSR probe times, in seconds
+  CeedVector scaledwork;   /// Work vector for scaled apply without backend
   void *data;
 };
 
+struct CeedMultigrid_private {
+  Ceed ceed;
+  int refcount;
+  CeedInt numlevels;        /// Number of levels, including the fine grid
+  CeedOperator *ops;        /// Operator on each level, finest first
+  CeedOperator *opprolong;  /// Prolongation from level i+1 to level i
+  CeedOperator *oprestrict; /// Restriction from level i to level i+1
+  CeedVector *multinv;      /// Inverse multiplicity of level i L-vector
+  CeedVector *work;         /// Scaled level i L-vector for restriction
+};
+
+// Trace event timeline, enabled by the environment variable CEED_TRACE, and
+//   per stage totals of operators, enabled by CEED_PERF_COUNTERS
+CEED_INTERN int CeedTraceInit(Ceed ceed);
+CEED_INTERN int CeedTraceFinalize(void);
+CEED_INTERN void CeedTraceStart(CeedOperator op, CeedTraceSample *start);
+CEED_INTERN void CeedTraceAbort(const CeedTraceSample *start);
+CEED_INTERN int CeedTraceSpan(Ceed ceed, CeedTraceCategory category,
+                              const char *name, const CeedTraceSample *start,
+                              double flops, const char *label,
+                              const char *format, ...);
+CEED_INTERN int CeedTraceViewStats(const CeedStageStats *stats,
+                                   const char *indent, FILE *stream);
+
+// Error check inside a span started by CeedTraceStart(), which is ended
+//   without an event when returning the error
+#define CeedTraceChk(ierr, start) \
+  do { if (ierr) { CeedTraceAbort(start); return (ierr); } } while (0)
+
 #endif
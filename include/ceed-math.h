@@ -0,0 +1,211 @@
+/// Copyright (c) 2017, Lawrence Livermore National Security, LLC. Produced at
+/// the Lawrence Livermore National Laboratory. LLNL-CODE-734707. All Rights
+/// reserved. See files LICENSE and NOTICE for details.
+///
+/// This file is part of CEED, a collection of benchmarks, miniapps, software
+/// libraries and APIs for efficient high-order finite element and spectral
+/// element discretizations for exascale applications. For more information and
+/// source code availability see http://github.com/ceed.
+///
+/// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+/// a collaborative effort of two U.S. Department of Energy organizations (Office
+/// of Science and the National Nuclear Security Administration) responsible for
+/// the planning and preparation of a capable exascale ecosystem, including
+/// software, applications, hardware, advanced system engineering and early
+/// testbed platforms, in support of the nation's exascale computing imperative.
+
+/// @file
+/// Header-only math functions for User QFunctions
+///
+/// The libm versions of exp(), log(), pow(), and sqrt() set errno and branch on
+///   special values, which prevents compilers from vectorizing CeedPragmaSIMD
+///   loops that call them. The functions in this header are branch-free and
+///   inline, so these loops vectorize on CPU compilers. They assume finite
+///   arguments in the domain of the function; out of range arguments return
+///   unspecified values instead of setting errno. Relative errors are below
+///   1e-15, except for CeedPow(), whose error grows with |y log(x)|.
+///
+/// On code generation backends, where the QFunction is compiled for the device,
+///   these functions forward to the device math library.
+#ifndef _ceed_math_h
+#define _ceed_math_h
+
+#if defined(__CUDACC__) || defined(__HIPCC__)
+
+static inline CeedScalar CeedExp(CeedScalar x) { return exp(x); }
+static inline CeedScalar CeedLog(CeedScalar x) { return log(x); }
+static inline CeedScalar CeedLog1p(CeedScalar x) { return log1p(x); }
+static inline CeedScalar CeedPow(CeedScalar x, CeedScalar y) { return pow(x, y); }
+static inline CeedScalar CeedSqrt(CeedScalar x) { return sqrt(x); }
+
+#else
+
+#include <ceed.h>
+#include <string.h>
+
+/**
+  @brief Reinterpret the bits of a CeedScalar as an integer
+
+  @param[in] x  Value to reinterpret
+
+  @return IEEE-754 binary representation of x
+
+  @ref Utility
+**/
+static inline uint64_t CeedMathAsBits(CeedScalar x) {
+  uint64_t bits;
+  memcpy(&bits, &x, sizeof(bits));
+  return bits;
+}
+
+/**
+  @brief Reinterpret an integer as the bits of a CeedScalar
+
+  @param[in] bits  IEEE-754 binary representation
+
+  @return Value represented by bits
+
+  @ref Utility
+**/
+static inline CeedScalar CeedMathFromBits(uint64_t bits) {
+  CeedScalar x;
+  memcpy(&x, &bits, sizeof(x));
+  return x;
+}
+
+/**
+  @brief Branch-free exponential function
+
+  The argument is reduced to x = n log(2) + r with |r| <= log(2)/2, exp(r) is
+    evaluated with a Taylor polynomial, and 2^n is formed directly in the
+    exponent bits. Arguments are clamped to [-708, 709].
+
+  @param[in] x  Exponent
+
+  @return exp(x)
+
+  @ref Utility
+**/
+static inline CeedScalar CeedExp(CeedScalar x) {
+  // 1.5*2^52; adding it rounds to the nearest integer in the low bits
+  const CeedScalar shift = 6755399441055744.0;
+  x = x < -708.0 ? -708.0 : x;
+  x = x > 709.0 ? 709.0 : x;
+  const CeedScalar t = x*1.4426950408889634 + shift;
+  const CeedScalar n = t - shift;
+  const CeedScalar r = (x - n*6.93147180369123816490e-01)
+                       - n*1.90821492927058770002e-10;
+  CeedScalar p = 1.6059043836821613e-10;  // 1/13!
+  p = p*r + 2.0876756987868100e-09;       // 1/12!
+  p = p*r + 2.5052108385441720e-08;
+  p = p*r + 2.7557319223985893e-07;
+  p = p*r + 2.7557319223985888e-06;
+  p = p*r + 2.4801587301587302e-05;
+  p = p*r + 1.9841269841269841e-04;
+  p = p*r + 1.3888888888888889e-03;
+  p = p*r + 8.3333333333333332e-03;
+  p = p*r + 4.1666666666666664e-02;
+  p = p*r + 1.6666666666666666e-01;
+  p = p*r + 0.5;
+  p = p*r + 1.0;
+  p = p*r + 1.0;
+  const uint64_t k = CeedMathAsBits(t) - CeedMathAsBits(shift);
+  return p*CeedMathFromBits((k + 1023) << 52);
+}
+
+/**
+  @brief Branch-free natural logarithm
+
+  The argument is split as x = m 2^e with sqrt(2)/2 <= m < sqrt(2), and log(m)
+    is evaluated as 2 atanh((m - 1)/(m + 1)) with an odd series. Requires a
+    positive, normal argument.
+
+  @param[in] x  Argument
+
+  @return log(x)
+
+  @ref Utility
+**/
+static inline CeedScalar CeedLog(CeedScalar x) {
+  const uint64_t bits = CeedMathAsBits(x);
+  // Biased exponent as a CeedScalar, without integer conversion
+  CeedScalar e = CeedMathFromBits((bits >> 52) | 0x4330000000000000ULL)
+                 - 4503599627370496.0 - 1023.0;
+  CeedScalar m = CeedMathFromBits((bits & 0x000FFFFFFFFFFFFFULL) |
+                                  0x3FF0000000000000ULL);
+  const int big = m > 1.4142135623730951;
+  m = big ? 0.5*m : m;
+  e = big ? e + 1.0 : e;
+  const CeedScalar s = (m - 1.0)/(m + 1.0), s2 = s*s;
+  CeedScalar p = 1./19;
+  p = p*s2 + 1./17;
+  p = p*s2 + 1./15;
+  p = p*s2 + 1./13;
+  p = p*s2 + 1./11;
+  p = p*s2 + 1./9;
+  p = p*s2 + 1./7;
+  p = p*s2 + 1./5;
+  p = p*s2 + 1./3;
+  const CeedScalar logm = 2.0*s + 2.0*s*s2*p;
+  return e*6.93147180369123816490e-01 + (logm + e*1.90821492927058770002e-10);
+}
+
+/**
+  @brief Branch-free log(1 + x), accurate for small |x|
+
+  The rounding error of 1 + x is corrected to first order. Requires x > -1.
+
+  @param[in] x  Argument
+
+  @return log(1 + x)
+
+  @ref Utility
+**/
+static inline CeedScalar CeedLog1p(CeedScalar x) {
+  const CeedScalar u = 1.0 + x;
+  return CeedLog(u) - ((u - 1.0) - x)/u;
+}
+
+/**
+  @brief Branch-free power function, computed as exp(y log(x))
+
+  Requires x > 0. For integer powers, prefer explicit products.
+
+  @param[in] x  Base
+  @param[in] y  Exponent
+
+  @return x^y
+
+  @ref Utility
+**/
+static inline CeedScalar CeedPow(CeedScalar x, CeedScalar y) {
+  return CeedExp(y*CeedLog(x));
+}
+
+/**
+  @brief Branch-free square root
+
+  An initial inverse square root estimate from the exponent bits is refined
+    with Newton iterations, followed by one Newton correction of the square
+    root. Requires x >= 0.
+
+  @param[in] x  Argument
+
+  @return sqrt(x)
+
+  @ref Utility
+**/
+static inline CeedScalar CeedSqrt(CeedScalar x) {
+  const CeedScalar h = 0.5*x;
+  CeedScalar y = CeedMathFromBits(0x5FE6EB50C7B537A9ULL -
+                                  (CeedMathAsBits(x) >> 1));
+  y = y*(1.5 - h*y*y);
+  y = y*(1.5 - h*y*y);
+  y = y*(1.5 - h*y*y);
+  const CeedScalar s = x*y;
+  return s + 0.5*y*(x - s*s);
+}
+
+#endif
+
+#endif
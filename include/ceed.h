@@ -149,11 +149,16 @@ typedef struct CeedQFunctionContext_private *CeedQFunctionContext;
 ///   acting on the vector \f$u\f$.
 /// @ingroup CeedOperatorUser
 typedef struct CeedOperator_private *CeedOperator;
+/// Handle for a p-multigrid hierarchy of CeedOperators and grid transfers
+/// @ingroup CeedOperatorUser
+typedef struct CeedMultigrid_private *CeedMultigrid;
 
 CEED_EXTERN int CeedInit(const char *resource, Ceed *ceed);
 CEED_EXTERN int CeedGetResource(Ceed ceed, const char **resource);
 CEED_EXTERN int CeedIsDeterministic(Ceed ceed, bool *isDeterministic);
 CEED_EXTERN int CeedView(Ceed ceed, FILE *stream);
+CEED_EXTERN int CeedSetMemoryTracking(bool enable);
+CEED_EXTERN int CeedGetMemoryUsage(size_t *current, size_t *peak);
 CEED_EXTERN int CeedDestroy(Ceed *ceed);
 
 CEED_EXTERN int CeedErrorImpl(Ceed, const char *, int, const char *, int,
@@ -255,7 +260,11 @@ CEED_EXTERN int CeedVectorRestoreArrayRead(CeedVector vec,
 CEED_EXTERN int CeedVectorNorm(CeedVector vec, CeedNormType type,
                                CeedScalar *norm);
 CEED_EXTERN int CeedVectorReciprocal(CeedVector vec);
+CEED_EXTERN int CeedVectorScale(CeedVector x, CeedScalar alpha);
+CEED_EXTERN int CeedVectorPointwiseMult(CeedVector w, CeedVector x,
+                                        CeedVector y);
 CEED_EXTERN int CeedVectorView(CeedVector vec, const char *fpfmt, FILE *stream);
+CEED_EXTERN int CeedVectorGetMemoryUsage(CeedVector vec, size_t *bytes);
 CEED_EXTERN int CeedVectorGetLength(CeedVector vec, CeedInt *length);
 CEED_EXTERN int CeedVectorDestroy(CeedVector *vec);
 
@@ -345,6 +354,8 @@ CEED_EXTERN int CeedElemRestrictionGetBlockSize(CeedElemRestriction rstr,
 CEED_EXTERN int CeedElemRestrictionGetMultiplicity(CeedElemRestriction rstr,
     CeedVector mult);
 CEED_EXTERN int CeedElemRestrictionView(CeedElemRestriction rstr, FILE *stream);
+CEED_EXTERN int CeedElemRestrictionGetMemoryUsage(CeedElemRestriction rstr,
+    size_t *bytes);
 CEED_EXTERN int CeedElemRestrictionDestroy(CeedElemRestriction *rstr);
 
 // The formalism here is that we have the structure
@@ -424,7 +435,11 @@ CEED_EXTERN int CeedBasisCreateH1(Ceed ceed, CeedElemTopology topo,
                                   const CeedScalar *grad,
                                   const CeedScalar *qref,
                                   const CeedScalar *qweight, CeedBasis *basis);
+CEED_EXTERN int CeedBasisCreateSimplexCollapsed(Ceed ceed,
+    CeedElemTopology topo, CeedInt ncomp, CeedInt P1d, CeedInt Q1d,
+    CeedBasis *basis);
 CEED_EXTERN int CeedBasisView(CeedBasis basis, FILE *stream);
+CEED_EXTERN int CeedBasisGetMemoryUsage(CeedBasis basis, size_t *bytes);
 CEED_EXTERN int CeedBasisApply(CeedBasis basis, CeedInt nelem,
                                CeedTransposeMode tmode,
                                CeedEvalMode emode, CeedVector u, CeedVector v);
@@ -495,6 +510,8 @@ CEED_EXTERN int CeedQFunctionAddOutput(CeedQFunction qf, const char *fieldname,
                                        CeedInt size, CeedEvalMode emode);
 CEED_EXTERN int CeedQFunctionSetContext(CeedQFunction qf,
                                         CeedQFunctionContext ctx);
+CEED_EXTERN int CeedQFunctionSetUserFlopsEstimate(CeedQFunction qf,
+    size_t flops);
 CEED_EXTERN int CeedQFunctionView(CeedQFunction qf, FILE *stream);
 CEED_EXTERN int CeedQFunctionApply(CeedQFunction qf, CeedInt Q,
                                    CeedVector *u, CeedVector *v);
@@ -509,10 +526,69 @@ CEED_EXTERN int CeedQFunctionContextGetData(CeedQFunctionContext ctx,
     void *data);
 CEED_EXTERN int CeedQFunctionContextRestoreData(CeedQFunctionContext ctx,
     void *data);
+CEED_EXTERN int CeedQFunctionContextGetDataRead(CeedQFunctionContext ctx,
+    CeedMemType mtype, void *data);
+CEED_EXTERN int CeedQFunctionContextRestoreDataRead(CeedQFunctionContext ctx,
+    void *data);
 CEED_EXTERN int CeedQFunctionContextView(CeedQFunctionContext ctx,
     FILE *stream);
 CEED_EXTERN int CeedQFunctionContextDestroy(CeedQFunctionContext *ctx);
 
+/// Strategy used by CeedOperatorApply() and CeedOperatorApplyAdd()
+/// @ingroup CeedOperator
+typedef enum {
+  /// Apply the operator matrix-free through the backend (default)
+  CEED_STRATEGY_MATRIX_FREE = 0,
+  /// Assemble the local operator as a CSR matrix and apply it with SpMV
+  CEED_STRATEGY_ASSEMBLED = 1,
+  /// Select between matrix-free and assembled from a cost estimate and a
+  /// timing probe at the first apply
+  CEED_STRATEGY_AUTO = 2,
+} CeedOperatorStrategy;
+
+CEED_EXTERN const char *const CeedOperatorStrategies[];
+
+/// Storage precision of passive CeedOperator input fields
+/// @ingroup CeedOperator
+typedef enum {
+  /// Store values as CeedScalar (default)
+  CEED_PRECISION_SCALAR = 0,
+  /// Store values in IEEE single precision
+  CEED_PRECISION_FP32 = 1,
+  /// Store values in bfloat16, with the exponent range of single precision
+  /// and 8 significant bits
+  CEED_PRECISION_BF16 = 2,
+} CeedFieldPrecision;
+
+CEED_EXTERN const char *const CeedFieldPrecisions[];
+
+/// Categories of memory held by a CeedOperator, see
+///   CeedOperatorGetMemoryUsage()
+/// @ingroup CeedOperator
+typedef enum {
+  /// Element restriction offsets, including blocked copies made by backends
+  CEED_MEMORY_OFFSETS = 0,
+  /// Basis matrices and quadrature rules
+  CEED_MEMORY_BASIS = 1,
+  /// Passive input vectors, such as quadrature data, and reduced precision
+  /// copies made by backends
+  CEED_MEMORY_PASSIVE = 2,
+  /// Backend E-vector work arrays
+  CEED_MEMORY_EVEC = 3,
+  /// Backend Q-vector work arrays
+  CEED_MEMORY_QVEC = 4,
+  /// L-vector work arrays
+  CEED_MEMORY_LVEC = 5,
+  /// Assembled CSR matrix, see CeedOperatorSetStrategy()
+  CEED_MEMORY_ASSEMBLED = 6,
+  /// Work arrays of the fallback operator on another backend
+  CEED_MEMORY_FALLBACK = 7,
+  /// Sum of all categories
+  CEED_MEMORY_TOTAL = 8,
+} CeedMemoryCategory;
+
+CEED_EXTERN const char *const CeedMemoryCategories[];
+
 CEED_EXTERN int CeedOperatorCreate(Ceed ceed, CeedQFunction qf,
                                    CeedQFunction dqf, CeedQFunction dqfT,
                                    CeedOperator *op);
@@ -545,13 +621,47 @@ CEED_EXTERN int CeedOperatorMultigridLevelCreateH1(CeedOperator opFine,
     CeedOperator *opProlong, CeedOperator *opRestrict);
 CEED_EXTERN int CeedOperatorCreateFDMElementInverse(CeedOperator op,
     CeedOperator *fdminv, CeedRequest *request);
+CEED_EXTERN int CeedOperatorSetStrategy(CeedOperator op,
+    CeedOperatorStrategy strategy);
+CEED_EXTERN int CeedOperatorSetFieldPrecision(CeedOperator op,
+    const char *fieldname, CeedFieldPrecision precision);
+CEED_EXTERN int CeedOperatorSetBatchSize(CeedOperator op, CeedInt batchsize);
+CEED_EXTERN int CeedOperatorSetName(CeedOperator op, const char *name);
 CEED_EXTERN int CeedOperatorView(CeedOperator op, FILE *stream);
+CEED_EXTERN int CeedOperatorGetMemoryUsage(CeedOperator op,
+    CeedMemoryCategory category, size_t *bytes);
+CEED_EXTERN int CeedOperatorViewMemoryUsage(CeedOperator op, FILE *stream);
+CEED_EXTERN int CeedOperatorGetFlopsEstimate(CeedOperator op, size_t *flops);
+CEED_EXTERN int CeedOperatorGetBytesEstimate(CeedOperator op, size_t *bytes);
+CEED_EXTERN int CeedOperatorViewPerformance(CeedOperator op, FILE *stream);
 CEED_EXTERN int CeedOperatorApply(CeedOperator op, CeedVector in,
                                   CeedVector out, CeedRequest *request);
 CEED_EXTERN int CeedOperatorApplyAdd(CeedOperator op, CeedVector in,
                                      CeedVector out, CeedRequest *request);
+CEED_EXTERN int CeedOperatorApplyScaled(CeedOperator op, CeedVector in,
+                                        CeedVector out, CeedVector scale,
+                                        CeedRequest *request);
+CEED_EXTERN int CeedOperatorApplyScaledAdd(CeedOperator op, CeedVector in,
+    CeedVector out, CeedScalar alpha, CeedScalar beta, CeedVector scale,
+    CeedRequest *request);
 CEED_EXTERN int CeedOperatorDestroy(CeedOperator *op);
 
+CEED_EXTERN int CeedMultigridCreate(CeedOperator opFine, CeedInt numlevels,
+                                    CeedVector *PMult,
+                                    CeedElemRestriction *rstrCoarse,
+                                    CeedBasis *basisCoarse, CeedMultigrid *mg);
+CEED_EXTERN int CeedMultigridGetNumLevels(CeedMultigrid mg,
+    CeedInt *numlevels);
+CEED_EXTERN int CeedMultigridGetOperator(CeedMultigrid mg, CeedInt level,
+    CeedOperator *op);
+CEED_EXTERN int CeedMultigridProlong(CeedMultigrid mg, CeedInt level,
+                                     CeedVector uc, CeedVector uf,
+                                     CeedRequest *request);
+CEED_EXTERN int CeedMultigridRestrict(CeedMultigrid mg, CeedInt level,
+                                      CeedVector uf, CeedVector uc,
+                                      CeedRequest *request);
+CEED_EXTERN int CeedMultigridDestroy(CeedMultigrid *mg);
+
 /**
   @brief Return integer power
 
@@ -0,0 +1,152 @@
+/// Copyright (c) 2017, Lawrence Livermore National Security, LLC. Produced at
+/// the Lawrence Livermore National Laboratory. LLNL-CODE-734707. All Rights
+/// reserved. See files LICENSE and NOTICE for details.
+///
+/// This file is part of CEED, a collection of benchmarks, miniapps, software
+/// libraries and APIs for efficient high-order finite element and spectral
+/// element discretizations for exascale applications. For more information and
+/// source code availability see http://github.com/ceed.
+///
+/// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+/// a collaborative effort of two U.S. Department of Energy organizations (Office
+/// of Science and the National Nuclear Security Administration) responsible for
+/// the planning and preparation of a capable exascale ecosystem, including
+/// software, applications, hardware, advanced system engineering and early
+/// testbed platforms, in support of the nation's exascale computing imperative.
+
+/// @file
+/// C++ interface for User QFunctions with compile-time specialization
+///
+/// A User QFunction receives the number of quadrature points Q at runtime, so
+///   the compiler cannot fix the component stride of its inputs and outputs.
+///   With this header, a QFunction is written as a class template over Q with
+///   typed field views, and ceed::QFunction<> dispatches each call to a
+///   specialization for one of a list of compile-time values of Q, or to the
+///   runtime fallback. The blocked CPU backends call QFunctions with
+///   Q = (points per element)*ceed::BlockSize, so listing that value lets the
+///   quadrature point loop on those backends run over a compile-time range.
+///
+/// @code
+///   struct Mass {
+///     template <CeedInt QC>
+///     static int Apply(void *ctx, CeedInt Q, const CeedScalar *const *in,
+///                      CeedScalar *const *out) {
+///       const ceed::Field<const CeedScalar, 1, QC> qd(in[0], Q), u(in[1], Q);
+///       const ceed::Field<CeedScalar, 1, QC> v(out[0], Q);
+///       const CeedInt npts = v.Size();
+///       CeedPragmaSIMD
+///       for (CeedInt i=0; i<npts; i++)
+///         v(0, i) = qd(0, i) * u(0, i);
+///       return 0;
+///     }
+///   };
+///   CeedQFunctionCreateInterior(ceed, 1, ceed::QFunction<Mass, 8, 8*ceed::BlockSize>,
+///                               __FILE__ ":Mass", &qf);
+/// @endcode
+///
+/// These QFunctions are compiled with the application and are not supported
+///   by the code generation backends, which compile QFunction source at runtime.
+#ifndef _ceed_hpp
+#define _ceed_hpp
+
+#include <ceed.h>
+
+namespace ceed {
+
+/// Value of the Q template parameter for a runtime number of quadrature points
+constexpr CeedInt QDynamic = 0;
+
+/// Number of elements processed together by the blocked CPU backends
+constexpr CeedInt BlockSize = 8;
+
+/**
+  @brief Typed view of a QFunction input or output field
+
+  A field holds NCOMP components, each stored contiguously for all quadrature
+    points. For QC != QDynamic, the number of points and the component stride
+    are compile-time constants.
+
+  @tparam T      CeedScalar for outputs, const CeedScalar for inputs
+  @tparam NCOMP  Number of components, including any dimension factors
+  @tparam QC     Number of quadrature points, or QDynamic
+
+  @ref User
+**/
+template <typename T, CeedInt NCOMP, CeedInt QC = QDynamic>
+class Field {
+ public:
+  /// Wrap the array for one QFunction field, with Q the runtime point count
+  Field(T *data, CeedInt Q) : data_(data), Q_(QC == QDynamic ? Q : QC) {}
+
+  /// Number of quadrature points
+  CeedInt Size() const { return QC == QDynamic ? Q_ : QC; }
+
+  /// Number of components
+  static constexpr CeedInt NumComponents() { return NCOMP; }
+
+  /// Value of component comp at quadrature point i
+  T &operator()(CeedInt comp, CeedInt i) const {
+    return data_[i + comp*Size()];
+  }
+
+  /// Copy all components at quadrature point i into v
+  template <typename U>
+  void Load(CeedInt i, U (&v)[NCOMP]) const {
+    for (CeedInt j=0; j<NCOMP; j++)
+      v[j] = (*this)(j, i);
+  }
+
+  /// Copy v into all components at quadrature point i
+  template <typename U>
+  void Store(CeedInt i, const U (&v)[NCOMP]) const {
+    for (CeedInt j=0; j<NCOMP; j++)
+      (*this)(j, i) = v[j];
+  }
+
+ private:
+  T *const data_;
+  const CeedInt Q_;
+};
+
+namespace detail {
+
+// Runtime fallback, no specialization matched
+template <typename Impl>
+inline int Dispatch(void *ctx, CeedInt Q, const CeedScalar *const *in,
+                    CeedScalar *const *out) {
+  return Impl::template Apply<QDynamic>(ctx, Q, in, out);
+}
+
+template <typename Impl, CeedInt QC, CeedInt... QS>
+inline int Dispatch(void *ctx, CeedInt Q, const CeedScalar *const *in,
+                    CeedScalar *const *out) {
+  static_assert(QC > 0, "Specialized quadrature point counts must be positive");
+  return Q == QC ? Impl::template Apply<QC>(ctx, Q, in, out)
+         : Dispatch<Impl, QS...>(ctx, Q, in, out);
+}
+
+} // namespace detail
+
+/**
+  @brief User QFunction calling the specialization of Impl::Apply<> for Q
+
+  Impl must provide a static member function template
+    `template <CeedInt QC> int Apply(void *ctx, CeedInt Q,
+    const CeedScalar *const *in, CeedScalar *const *out)`.
+    Each call is dispatched to Apply<QC> with QC equal to Q if Q is in the
+    list QS, and to Apply<QDynamic> otherwise.
+
+  @tparam Impl  Class providing the Apply<> template
+  @tparam QS    Quadrature point counts to specialize for
+
+  @ref User
+**/
+template <typename Impl, CeedInt... QS>
+int QFunction(void *ctx, const CeedInt Q, const CeedScalar *const *in,
+              CeedScalar *const *out) {
+  return detail::Dispatch<Impl, QS...>(ctx, Q, in, out);
+}
+
+} // namespace ceed
+
+#endif
@@ -166,4 +166,17 @@
       integer ceed_qfunction_none
       parameter(ceed_qfunction_none       = -9)
 
+!-----------------------------------------------------------------------
+! CeedOperatorStrategy
+!-----------------------------------------------------------------------
+
+      integer ceed_strategy_matrix_free
+      parameter(ceed_strategy_matrix_free = 0)
+
+      integer ceed_strategy_assembled
+      parameter(ceed_strategy_assembled   = 1)
+
+      integer ceed_strategy_auto
+      parameter(ceed_strategy_auto        = 2)
+
 ! -*- fortran-mode -*-
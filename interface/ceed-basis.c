@@ -175,6 +175,273 @@ static int CeedScalarView(const char *name, const char *fpformat, CeedInt m,
   return 0;
 }
 
+/**
+  @brief Evaluate a Jacobi polynomial and its derivative
+
+  @param n        Degree of the polynomial
+  @param alpha    Jacobi parameter alpha
+  @param x        Point in [-1, 1] at which to evaluate
+  @param[out] p   Value of P_n^(alpha,0)(x)
+  @param[out] dp  Derivative of P_n^(alpha,0) at x
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedJacobiPolynomial(CeedInt n, CeedScalar alpha, CeedScalar x,
+                                CeedScalar *p, CeedScalar *dp) {
+  // Three term recurrence for P_k^(a,b), with the derivative of P_n^(a,0)
+  //   given by (n+a+1)/2 P_{n-1}^(a+1,1)
+  for (CeedInt l=0; l<2; l++) {
+    const CeedInt k = n - l;
+    const CeedScalar a = alpha + l, b = l;
+    CeedScalar p0 = 1, p1 = 0;
+    if (k > 0)
+      p1 = ((a - b) + (a + b + 2)*x)/2;
+    for (CeedInt j=2; j<=k; j++) {
+      const CeedScalar c = 2*j + a + b;
+      const CeedScalar p2 = ((c - 1)*((a*a - b*b) + c*(c - 2)*x)*p1 -
+                             2*(j + a - 1)*(j + b - 1)*c*p0) /
+                            (2*j*(j + a + b)*(c - 2));
+      p0 = p1; p1 = p2;
+    }
+    const CeedScalar pk = k > 0 ? p1 : (k == 0 ? 1 : 0);
+    if (l == 0)
+      *p = pk;
+    else
+      *dp = (n + alpha + 1)/2*pk;
+  }
+  return 0;
+}
+
+/**
+  @brief Evaluate one factor of a collapsed coordinate simplex basis
+
+  Computes (1-x)^k P_n^(alpha,0)(2x-1) and its derivative for x in [0, 1].
+
+  @param k        Power of the collapse factor (1-x)
+  @param alpha    Jacobi parameter alpha
+  @param n        Degree of the Jacobi polynomial
+  @param x        Collapsed coordinate in [0, 1]
+  @param[out] f   Value of the factor
+  @param[out] df  Derivative of the factor with respect to x
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedCollapsedFactor(CeedInt k, CeedScalar alpha, CeedInt n,
+                               CeedScalar x, CeedScalar *f, CeedScalar *df) {
+  int ierr;
+  CeedScalar p, dp;
+  ierr = CeedJacobiPolynomial(n, alpha, 2*x - 1, &p, &dp); CeedChk(ierr);
+  const CeedScalar w = pow(1 - x, k);
+  *f = w*p;
+  *df = 2*w*dp - (k > 0 ? k*pow(1 - x, k - 1)*p : 0);
+  return 0;
+}
+
+/**
+  @brief Allocate a non tensor-product CeedBasis and copy its matrices
+
+  @param ceed        A Ceed object where the CeedBasis will be created
+  @param topo        Topology of element
+  @param ncomp       Number of field components
+  @param P           Total number of nodes
+  @param Q           Total number of quadrature points
+  @param interp      Row-major (Q * P) interpolation matrix
+  @param grad        Row-major (Q * dim * P) gradient matrix
+  @param qref        Array of length Q*dim holding the quadrature points
+  @param qweight     Array of length Q holding the quadrature weights
+  @param[out] basis  Address of the variable where the CeedBasis will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedBasisInitH1(Ceed ceed, CeedElemTopology topo, CeedInt ncomp,
+                           CeedInt P, CeedInt Q, const CeedScalar *interp,
+                           const CeedScalar *grad, const CeedScalar *qref,
+                           const CeedScalar *qweight, CeedBasis *basis) {
+  int ierr;
+  CeedInt dim = 0;
+
+  ierr = CeedCalloc(1,basis); CeedChk(ierr);
+
+  ierr = CeedBasisGetTopologyDimension(topo, &dim); CeedChk(ierr);
+
+  (*basis)->ceed = ceed;
+  CeedAtomicAdd(ceed->refcount, 1);
+  (*basis)->refcount = 1;
+  (*basis)->tensorbasis = 0;
+  (*basis)->dim = dim;
+  (*basis)->topo = topo;
+  (*basis)->ncomp = ncomp;
+  (*basis)->P = P;
+  (*basis)->Q = Q;
+  ierr = CeedMalloc(Q*dim,&(*basis)->qref1d); CeedChk(ierr);
+  ierr = CeedMalloc(Q,&(*basis)->qweight1d); CeedChk(ierr);
+  memcpy((*basis)->qref1d, qref, Q*dim*sizeof(qref[0]));
+  memcpy((*basis)->qweight1d, qweight, Q*sizeof(qweight[0]));
+  ierr = CeedMalloc(Q*P, &(*basis)->interp); CeedChk(ierr);
+  ierr = CeedMalloc(dim*Q*P, &(*basis)->grad); CeedChk(ierr);
+  memcpy((*basis)->interp, interp, Q*P*sizeof(interp[0]));
+  memcpy((*basis)->grad, grad, dim*Q*P*sizeof(grad[0]));
+  return 0;
+}
+
+/**
+  @brief Apply basis interpolation and gradient with separate backend calls
+
+  Used by CeedBasisApply() for \ref CEED_EVAL_INTERP | \ref CEED_EVAL_GRAD
+    when the backend does not provide a combined evaluation.
+
+  @param basis   CeedBasis to evaluate
+  @param nelem   The number of elements to apply the basis evaluation to
+  @param tmode   \ref CEED_NOTRANSPOSE or \ref CEED_TRANSPOSE
+  @param[in] u   Input CeedVector
+  @param[out] v  Output CeedVector
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedBasisApplyInterpGradSplit(CeedBasis basis, CeedInt nelem,
+    CeedTransposeMode tmode, CeedVector u, CeedVector v) {
+  int ierr;
+  const CeedInt qsize = nelem*basis->ncomp*basis->Q,
+                nsize = nelem*basis->ncomp*basis->P;
+  CeedVector qinterp, qgrad;
+  const CeedScalar *uarray, *qarray;
+  CeedScalar *varray;
+
+  ierr = CeedVectorCreate(basis->ceed, qsize, &qinterp); CeedChk(ierr);
+  ierr = CeedVectorCreate(basis->ceed, basis->dim*qsize, &qgrad);
+  CeedChk(ierr);
+  if (tmode == CEED_NOTRANSPOSE) {
+    ierr = basis->Apply(basis, nelem, tmode, CEED_EVAL_INTERP, u, qinterp);
+    CeedChk(ierr);
+    ierr = basis->Apply(basis, nelem, tmode, CEED_EVAL_GRAD, u, qgrad);
+    CeedChk(ierr);
+    ierr = CeedVectorGetArray(v, CEED_MEM_HOST, &varray); CeedChk(ierr);
+    ierr = CeedVectorGetArrayRead(qinterp, CEED_MEM_HOST, &qarray);
+    CeedChk(ierr);
+    memcpy(varray, qarray, qsize*sizeof(qarray[0]));
+    ierr = CeedVectorRestoreArrayRead(qinterp, &qarray); CeedChk(ierr);
+    ierr = CeedVectorGetArrayRead(qgrad, CEED_MEM_HOST, &qarray); CeedChk(ierr);
+    memcpy(&varray[qsize], qarray, basis->dim*qsize*sizeof(qarray[0]));
+    ierr = CeedVectorRestoreArrayRead(qgrad, &qarray); CeedChk(ierr);
+    ierr = CeedVectorRestoreArray(v, &varray); CeedChk(ierr);
+  } else {
+    CeedVector egrad;
+    ierr = CeedVectorGetArrayRead(u, CEED_MEM_HOST, &uarray); CeedChk(ierr);
+    ierr = CeedVectorSetArray(qinterp, CEED_MEM_HOST, CEED_COPY_VALUES,
+                              (CeedScalar *)uarray); CeedChk(ierr);
+    ierr = CeedVectorSetArray(qgrad, CEED_MEM_HOST, CEED_COPY_VALUES,
+                              (CeedScalar *)&uarray[qsize]); CeedChk(ierr);
+    ierr = CeedVectorRestoreArrayRead(u, &uarray); CeedChk(ierr);
+    ierr = CeedVectorCreate(basis->ceed, nsize, &egrad); CeedChk(ierr);
+    ierr = basis->Apply(basis, nelem, tmode, CEED_EVAL_INTERP, qinterp, v);
+    CeedChk(ierr);
+    ierr = basis->Apply(basis, nelem, tmode, CEED_EVAL_GRAD, qgrad, egrad);
+    CeedChk(ierr);
+    ierr = CeedVectorGetArray(v, CEED_MEM_HOST, &varray); CeedChk(ierr);
+    ierr = CeedVectorGetArrayRead(egrad, CEED_MEM_HOST, &qarray); CeedChk(ierr);
+    for (CeedInt i=0; i<nsize; i++)
+      varray[i] += qarray[i];
+    ierr = CeedVectorRestoreArrayRead(egrad, &qarray); CeedChk(ierr);
+    ierr = CeedVectorRestoreArray(v, &varray); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&egrad); CeedChk(ierr);
+  }
+  ierr = CeedVectorDestroy(&qinterp); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&qgrad); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Get the Ceed that creates tensor product bases for a Ceed, following
+           the object delegates used by CeedBasisCreateTensorH1()
+
+  @param ceed             Ceed
+  @param[out] tensorceed  Variable to store the Ceed creating the bases
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedBasisGetTensorCeed(Ceed ceed, Ceed *tensorceed) {
+  int ierr;
+
+  *tensorceed = ceed;
+  while (!(*tensorceed)->BasisCreateTensorH1) {
+    Ceed delegate;
+    ierr = CeedGetObjectDelegate(*tensorceed, &delegate, "Basis");
+    CeedChk(ierr);
+    if (!delegate)
+      break;
+    *tensorceed = delegate;
+  }
+  return 0;
+}
+
+/**
+  @brief Find a tensor product basis of a Ceed to share by reference
+
+  Bases created by CeedBasisCreateTensorH1() are shared while referenced, so
+    operators and multigrid levels using identical bases share the 1D
+    matrices, the quadrature, and backend data such as collocated gradients
+    and compiled contraction kernels. Bases match by dimension, number of
+    components, and 1D sizes, and then by the values of the 1D matrices and
+    quadrature, or by the quadrature mode of CeedBasisCreateTensorH1Lagrange()
+    if @a interp1d is NULL.
+
+  @param ceed        Ceed creating the bases, see CeedBasisGetTensorCeed()
+  @param dim         Topological dimension
+  @param ncomp       Number of field components
+  @param P1d         Number of nodes in one dimension
+  @param Q1d         Number of quadrature points in one dimension
+  @param qmode       Quadrature mode of a Lagrange basis
+  @param interp1d    Row-major (Q1d * P1d) interpolation matrix, or NULL
+  @param grad1d      Row-major (Q1d * P1d) gradient matrix
+  @param qref1d      Array of length Q1d holding the quadrature points
+  @param qweight1d   Array of length Q1d holding the quadrature weights
+  @param[out] basis  Variable to store a new reference to the basis found, or
+                       NULL
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedBasisFindTensorH1(Ceed ceed, CeedInt dim, CeedInt ncomp,
+                                 CeedInt P1d, CeedInt Q1d, CeedQuadMode qmode,
+                                 const CeedScalar *interp1d,
+                                 const CeedScalar *grad1d,
+                                 const CeedScalar *qref1d,
+                                 const CeedScalar *qweight1d,
+                                 CeedBasis *basis) {
+  const size_t matbytes = Q1d*P1d*sizeof(CeedScalar),
+               qbytes = Q1d*sizeof(CeedScalar);
+
+  *basis = NULL;
+  CeedLockAcquire(ceed->basiscachelock);
+  for (CeedBasis b=ceed->basiscache; b; b=b->cachenext) {
+    if (b->dim != dim || b->ncomp != ncomp || b->P1d != P1d || b->Q1d != Q1d)
+      continue;
+    bool match = interp1d ? !memcmp(b->interp1d, interp1d, matbytes) &&
+                 !memcmp(b->grad1d, grad1d, matbytes) &&
+                 !memcmp(b->qref1d, qref1d, qbytes) &&
+                 !memcmp(b->qweight1d, qweight1d, qbytes) :
+                 b->lagrange && b->qmode == qmode;
+    if (match) {
+      CeedAtomicAdd(b->refcount, 1);
+      *basis = b;
+      break;
+    }
+  }
+  CeedLockRelease(ceed->basiscachelock);
+  return 0;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -262,6 +529,61 @@ int CeedBasisIsTensor(CeedBasis basis, bool *istensor) {
   return 0;
 }
 
+/**
+  @brief Get collapsed coordinate status for given CeedBasis
+
+  @param basis             CeedBasis
+  @param[out] iscollapsed  Variable to store collapsed coordinate status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedBasisIsCollapsed(CeedBasis basis, bool *iscollapsed) {
+  *iscollapsed = basis->collapsed;
+  return 0;
+}
+
+/**
+  @brief Get the factor tables of a collapsed coordinate CeedBasis
+
+  For each collapsed coordinate d < dim, interp[d] and deriv[d] are row-major
+    matrices of shape [Q1d, ncols] with ncols = P1d for d = 0, the number of
+    (p,q) mode pairs P1d*(P1d+1)/2 for d = 1 of a tetrahedron, and the number
+    of modes for the last coordinate. Modes are ordered by p, then q, then r.
+    See CeedBasisCreateSimplexCollapsed().
+
+  @param basis        CeedBasis
+  @param[out] P1d     Variable to store the number of modes in one coordinate
+  @param[out] Q1d     Variable to store the number of points in one coordinate
+  @param[out] qref1d  Variable to store the collapsed quadrature points on [0, 1]
+  @param[out] interp  Array of dim variables to store the factor tables
+  @param[out] deriv   Array of dim variables to store the factor derivatives
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedBasisGetCollapsedData(CeedBasis basis, CeedInt *P1d, CeedInt *Q1d,
+                              const CeedScalar **qref1d,
+                              const CeedScalar **interp,
+                              const CeedScalar **deriv) {
+  if (!basis->collapsed)
+    // LCOV_EXCL_START
+    return CeedError(basis->ceed, 1, "CeedBasis is not a collapsed coordinate "
+                     "basis");
+  // LCOV_EXCL_STOP
+
+  *P1d = basis->P1d;
+  *Q1d = basis->Q1d;
+  *qref1d = basis->collapsedqref1d;
+  for (CeedInt d=0; d<basis->dim; d++) {
+    interp[d] = basis->collapsedinterp[d];
+    deriv[d] = basis->collapsedderiv[d];
+  }
+  return 0;
+}
+
 /**
   @brief Get backend data of a CeedBasis
 
@@ -337,6 +659,55 @@ int CeedBasisSetTensorContract(CeedBasis basis, CeedTensorContract *contract) {
   return 0;
 }
 
+/**
+  @brief Estimate the floating point operations of CeedBasisApply() for one
+           element
+
+  Tensor product bases count the 1D contractions of sum factorization, with
+    one full set of contractions per gradient direction; other bases count a
+    dense matrix-vector product.
+
+  @param basis       CeedBasis
+  @param tmode       CEED_NOTRANSPOSE or CEED_TRANSPOSE
+  @param emode       CeedEvalMode, possibly CEED_EVAL_INTERP | CEED_EVAL_GRAD
+  @param[out] flops  Variable to store the estimated flops per element
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedBasisGetFlopsEstimate(CeedBasis basis, CeedTransposeMode tmode,
+                              CeedEvalMode emode, size_t *flops) {
+  const CeedInt dim = basis->dim, ncomp = basis->ncomp;
+  size_t interp = 0;
+
+  if (basis->tensorbasis) {
+    // Contraction d maps ncomp Q^d P^(dim-d) values to ncomp Q^(d+1)
+    //   P^(dim-d-1) values, with P and Q exchanged for the transpose
+    const size_t P = tmode == CEED_TRANSPOSE ? basis->Q1d : basis->P1d,
+                 Q = tmode == CEED_TRANSPOSE ? basis->P1d : basis->Q1d;
+    for (CeedInt d=0; d<dim; d++) {
+      size_t contract = 2*ncomp*Q;
+      for (CeedInt i=0; i<d; i++)
+        contract *= Q;
+      for (CeedInt i=d; i<dim; i++)
+        contract *= P;
+      interp += contract;
+    }
+  } else {
+    interp = 2*(size_t)ncomp*basis->P*basis->Q;
+  }
+
+  *flops = 0;
+  if (emode & CEED_EVAL_INTERP)
+    *flops += interp;
+  if (emode & CEED_EVAL_GRAD)
+    *flops += dim*interp;
+  if (emode == CEED_EVAL_WEIGHT)
+    *flops = basis->Q;
+  return 0;
+}
+
 /**
   @brief Return a reference implementation of matrix multiplication C = A B.
            Note, this is a reference implementation for CPU CeedScalar pointers
@@ -378,6 +749,12 @@ int CeedMatrixMultiply(Ceed ceed, const CeedScalar *matA,
 /**
   @brief Create a tensor-product basis for H^1 discretizations
 
+  A basis with the same sizes, matrices, and quadrature that is still
+    referenced on the same Ceed is returned as a new reference instead, so
+    identical calls may return the same handle. The handle shares the
+    matrices and backend data with its other holders, each of which destroys
+    its own reference; CeedBasisCreateH1() always creates a distinct basis.
+
   @param ceed        A Ceed object where the CeedBasis will be created
   @param dim         Topological dimension
   @param ncomp       Number of field components (1 for scalar fields)
@@ -426,9 +803,17 @@ int CeedBasisCreateTensorH1(Ceed ceed, CeedInt dim, CeedInt ncomp, CeedInt P1d,
                                    qweight1d, basis); CeedChk(ierr);
     return 0;
   }
+
+  // Share a basis with the same data
+  ierr = CeedBasisFindTensorH1(ceed, dim, ncomp, P1d, Q1d, CEED_GAUSS,
+                               interp1d, grad1d, qref1d, qweight1d, basis);
+  CeedChk(ierr);
+  if (*basis)
+    return 0;
+
   ierr = CeedCalloc(1,basis); CeedChk(ierr);
   (*basis)->ceed = ceed;
-  ceed->refcount++;
+  CeedAtomicAdd(ceed->refcount, 1);
   (*basis)->refcount = 1;
   (*basis)->tensorbasis = 1;
   (*basis)->dim = dim;
@@ -448,12 +833,22 @@ int CeedBasisCreateTensorH1(Ceed ceed, CeedInt dim, CeedInt ncomp, CeedInt P1d,
   memcpy((*basis)->grad1d, grad1d, Q1d*P1d*sizeof(grad1d[0]));
   ierr = ceed->BasisCreateTensorH1(dim, P1d, Q1d, interp1d, grad1d, qref1d,
                                    qweight1d, *basis); CeedChk(ierr);
+  (*basis)->cached = true;
+  CeedLockAcquire(ceed->basiscachelock);
+  (*basis)->cachenext = ceed->basiscache;
+  ceed->basiscache = *basis;
+  CeedLockRelease(ceed->basiscachelock);
   return 0;
 }
 
 /**
   @brief Create a tensor-product Lagrange basis
 
+  A Lagrange basis with the same sizes and quadrature mode that is still
+    referenced on the same Ceed is returned as a new reference, without
+    computing the quadrature and matrices again, so identical calls may return
+    the same handle; see CeedBasisCreateTensorH1().
+
   @param ceed        A Ceed object where the CeedBasis will be created
   @param dim         Topological dimension of element
   @param ncomp       Number of field components (1 for scalar fields)
@@ -481,6 +876,15 @@ int CeedBasisCreateTensorH1Lagrange(Ceed ceed, CeedInt dim, CeedInt ncomp,
     return CeedError(ceed, 1, "Basis dimension must be a positive value");
   // LCOV_EXCL_STOP
 
+  // Share a basis with the same sizes and quadrature, without recomputing the
+  //   quadrature and matrices
+  Ceed tensorceed;
+  ierr = CeedBasisGetTensorCeed(ceed, &tensorceed); CeedChk(ierr);
+  ierr = CeedBasisFindTensorH1(tensorceed, dim, ncomp, P, Q, qmode, NULL, NULL,
+                               NULL, NULL, basis); CeedChk(ierr);
+  if (*basis)
+    return 0;
+
   ierr = CeedCalloc(P*Q, &interp1d); CeedChk(ierr);
   ierr = CeedCalloc(P*Q, &grad1d); CeedChk(ierr);
   ierr = CeedCalloc(P, &nodes); CeedChk(ierr);
@@ -522,6 +926,10 @@ int CeedBasisCreateTensorH1Lagrange(Ceed ceed, CeedInt dim, CeedInt ncomp,
   //  // Pass to CeedBasisCreateTensorH1
   ierr = CeedBasisCreateTensorH1(ceed, dim, ncomp, P, Q, interp1d, grad1d, qref1d,
                                  qweight1d, basis); CeedChk(ierr);
+  CeedLockAcquire((*basis)->ceed->basiscachelock);
+  (*basis)->lagrange = true;
+  (*basis)->qmode = qmode;
+  CeedLockRelease((*basis)->ceed->basiscachelock);
   ierr = CeedFree(&interp1d); CeedChk(ierr);
   ierr = CeedFree(&grad1d); CeedChk(ierr);
   ierr = CeedFree(&nodes); CeedChk(ierr);
@@ -575,29 +983,182 @@ int CeedBasisCreateH1(Ceed ceed, CeedElemTopology topo, CeedInt ncomp,
     return 0;
   }
 
-  ierr = CeedCalloc(1,basis); CeedChk(ierr);
+  ierr = CeedBasisInitH1(ceed, topo, ncomp, P, Q, interp, grad, qref, qweight,
+                         basis); CeedChk(ierr);
+  ierr = CeedBasisGetTopologyDimension(topo, &dim); CeedChk(ierr);
+  ierr = ceed->BasisCreateH1(topo, dim, P, Q, interp, grad, qref,
+                             qweight, *basis); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Create a collapsed coordinate basis for discretizations on simplices
+
+  The basis functions are the orthonormal Dubiner polynomials of total degree
+    P1d-1 on the reference triangle with vertices (0,0), (1,0), (0,1) or the
+    reference tetrahedron with vertices (0,0,0), (1,0,0), (0,1,0), (0,0,1).
+    Each basis function is a product of one factor per collapsed coordinate,
+    x = s(1-t)(1-r), y = t(1-r), z = r with s, t, r in [0, 1], so backends may
+    apply the basis with sum factorization in O(P1d^(dim+1)) operations per
+    element instead of the O(P1d^(2 dim)) of the dense matrices.
+
+  The quadrature points are the tensor product of Q1d Gauss points in each
+    collapsed coordinate, with the Jacobian of the collapse included in the
+    weights. The rule integrates polynomials of total degree 2*Q1d-dim exactly.
+
+  The nodes of this basis are modal coefficients rather than point values, so
+    continuity is not imposed between elements. This basis is intended for
+    discontinuous fields and element-wise projections. The dense interpolation
+    and gradient matrices are also stored, so CeedBasisGetInterp() and
+    CeedBasisGetGrad() may be used as for CeedBasisCreateH1().
+
+  @param ceed        A Ceed object where the CeedBasis will be created
+  @param topo        Topology of element, \ref CEED_TRIANGLE or \ref CEED_TET
+  @param ncomp       Number of field components (1 for scalar fields)
+  @param P1d         Number of modes in each collapsed coordinate, one more
+                       than the polynomial degree
+  @param Q1d         Number of quadrature points in each collapsed coordinate
+  @param[out] basis  Address of the variable where the newly created
+                       CeedBasis will be stored.
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedBasisCreateSimplexCollapsed(Ceed ceed, CeedElemTopology topo,
+                                    CeedInt ncomp, CeedInt P1d, CeedInt Q1d,
+                                    CeedBasis *basis) {
+  int ierr;
+  CeedInt dim = 0;
+
+  if (!ceed->BasisCreateH1) {
+    Ceed delegate;
+    ierr = CeedGetObjectDelegate(ceed, &delegate, "Basis"); CeedChk(ierr);
+
+    if (!delegate)
+      // LCOV_EXCL_START
+      return CeedError(ceed, 1, "Backend does not support BasisCreateH1");
+    // LCOV_EXCL_STOP
+
+    ierr = CeedBasisCreateSimplexCollapsed(delegate, topo, ncomp, P1d, Q1d,
+                                           basis); CeedChk(ierr);
+    return 0;
+  }
+
+  if (topo != CEED_TRIANGLE && topo != CEED_TET)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Collapsed coordinate bases require "
+                     "CEED_TRIANGLE or CEED_TET topology");
+  // LCOV_EXCL_STOP
+  if (P1d < 1 || Q1d < 1)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Collapsed coordinate bases require at least "
+                     "one mode and one quadrature point");
+  // LCOV_EXCL_STOP
 
   ierr = CeedBasisGetTopologyDimension(topo, &dim); CeedChk(ierr);
+  const CeedInt npairs = P1d*(P1d+1)/2;
+  const CeedInt P = dim == 2 ? npairs : npairs*(P1d+2)/3;
+  const CeedInt Q = dim == 2 ? Q1d*Q1d : Q1d*Q1d*Q1d;
+  // Columns of the factor tables; the last factor is indexed by mode
+  const CeedInt ncols[3] = {P1d, dim == 2 ? P : npairs, P};
+
+  // Gauss quadrature on [0, 1]
+  CeedScalar *x1d, *w1d;
+  ierr = CeedMalloc(Q1d, &x1d); CeedChk(ierr);
+  ierr = CeedMalloc(Q1d, &w1d); CeedChk(ierr);
+  ierr = CeedGaussQuadrature(Q1d, x1d, w1d); CeedChk(ierr);
+  for (CeedInt i=0; i<Q1d; i++) {
+    x1d[i] = (x1d[i] + 1)/2;
+    w1d[i] /= 2;
+  }
 
-  (*basis)->ceed = ceed;
-  ceed->refcount++;
-  (*basis)->refcount = 1;
-  (*basis)->tensorbasis = 0;
-  (*basis)->dim = dim;
-  (*basis)->topo = topo;
-  (*basis)->ncomp = ncomp;
-  (*basis)->P = P;
-  (*basis)->Q = Q;
-  ierr = CeedMalloc(Q*dim,&(*basis)->qref1d); CeedChk(ierr);
-  ierr = CeedMalloc(Q,&(*basis)->qweight1d); CeedChk(ierr);
-  memcpy((*basis)->qref1d, qref, Q*dim*sizeof(qref[0]));
-  memcpy((*basis)->qweight1d, qweight, Q*sizeof(qweight[0]));
-  ierr = CeedMalloc(Q*P, &(*basis)->interp); CeedChk(ierr);
-  ierr = CeedMalloc(dim*Q*P, &(*basis)->grad); CeedChk(ierr);
-  memcpy((*basis)->interp, interp, Q*P*sizeof(interp[0]));
-  memcpy((*basis)->grad, grad, dim*Q*P*sizeof(grad[0]));
+  // Factor tables, with the normalization in the last factor
+  CeedScalar *tab[3] = {NULL, NULL, NULL}, *dtab[3] = {NULL, NULL, NULL};
+  for (CeedInt d=0; d<dim; d++) {
+    ierr = CeedMalloc(Q1d*ncols[d], &tab[d]); CeedChk(ierr);
+    ierr = CeedMalloc(Q1d*ncols[d], &dtab[d]); CeedChk(ierr);
+  }
+  for (CeedInt i=0; i<Q1d; i++) {
+    const CeedScalar x = x1d[i];
+    for (CeedInt p=0; p<P1d; p++) {
+      ierr = CeedCollapsedFactor(0, 0, p, x, &tab[0][i*ncols[0]+p],
+                                 &dtab[0][i*ncols[0]+p]); CeedChk(ierr);
+    }
+    for (CeedInt p=0, pq=0, m=0; p<P1d; p++)
+      for (CeedInt q=0; q<P1d-p; q++, pq++) {
+        CeedScalar scale = dim == 2 ? sqrt(2.*(2*p+1)*(p+q+1)) : 1;
+        ierr = CeedCollapsedFactor(p, 2*p+1, q, x, &tab[1][i*ncols[1]+pq],
+                                   &dtab[1][i*ncols[1]+pq]); CeedChk(ierr);
+        tab[1][i*ncols[1]+pq] *= scale;
+        dtab[1][i*ncols[1]+pq] *= scale;
+        if (dim == 3)
+          for (CeedInt r=0; r<P1d-p-q; r++, m++) {
+            scale = sqrt(2.*(2*p+1)*(p+q+1)*(2*(p+q+r)+3));
+            ierr = CeedCollapsedFactor(p+q, 2*(p+q)+2, r, x, &tab[2][i*P+m],
+                                       &dtab[2][i*P+m]); CeedChk(ierr);
+            tab[2][i*P+m] *= scale;
+            dtab[2][i*P+m] *= scale;
+          }
+      }
+  }
+
+  // Quadrature points and dense matrices
+  CeedScalar *qref, *qweight, *interp, *grad;
+  ierr = CeedMalloc(dim*Q, &qref); CeedChk(ierr);
+  ierr = CeedMalloc(Q, &qweight); CeedChk(ierr);
+  ierr = CeedMalloc(Q*P, &interp); CeedChk(ierr);
+  ierr = CeedMalloc(dim*Q*P, &grad); CeedChk(ierr);
+  for (CeedInt k=0; k<(dim == 3 ? Q1d : 1); k++)
+    for (CeedInt j=0; j<Q1d; j++)
+      for (CeedInt i=0; i<Q1d; i++) {
+        const CeedInt pt = i + Q1d*(j + Q1d*k);
+        const CeedScalar s = x1d[i], t = x1d[j], r = dim == 3 ? x1d[k] : 0;
+        qref[0*Q+pt] = s*(1-t)*(1-r);
+        qref[1*Q+pt] = t*(1-r);
+        qweight[pt] = w1d[i]*w1d[j]*(1-t);
+        if (dim == 3) {
+          qref[2*Q+pt] = r;
+          qweight[pt] *= w1d[k]*(1-r)*(1-r);
+        }
+        for (CeedInt p=0, pq=0, m=0; p<P1d; p++)
+          for (CeedInt q=0; q<P1d-p; q++, pq++)
+            for (CeedInt l=0; l<(dim == 3 ? P1d-p-q : 1); l++, m++) {
+              const CeedScalar a = tab[0][i*ncols[0]+p],
+                               da = dtab[0][i*ncols[0]+p],
+                               b = tab[1][j*ncols[1]+pq],
+                               db = dtab[1][j*ncols[1]+pq],
+                               c = dim == 3 ? tab[2][k*P+m] : 1,
+                               dc = dim == 3 ? dtab[2][k*P+m] : 0;
+              // Chain rule for the collapsed coordinates
+              const CeedScalar ds = da*b*c/((1-t)*(1-r)), dt = a*db*c/(1-r),
+                               dr = a*b*dc;
+              interp[pt*P+m] = a*b*c;
+              grad[(0*Q+pt)*P+m] = ds;
+              grad[(1*Q+pt)*P+m] = s*ds + dt;
+              if (dim == 3)
+                grad[(2*Q+pt)*P+m] = s*ds + t*dt + dr;
+            }
+      }
+
+  ierr = CeedBasisInitH1(ceed, topo, ncomp, P, Q, interp, grad, qref, qweight,
+                         basis); CeedChk(ierr);
+  (*basis)->collapsed = true;
+  (*basis)->P1d = P1d;
+  (*basis)->Q1d = Q1d;
+  (*basis)->collapsedqref1d = x1d;
+  for (CeedInt d=0; d<dim; d++) {
+    (*basis)->collapsedinterp[d] = tab[d];
+    (*basis)->collapsedderiv[d] = dtab[d];
+  }
   ierr = ceed->BasisCreateH1(topo, dim, P, Q, interp, grad, qref,
                              qweight, *basis); CeedChk(ierr);
+
+  ierr = CeedFree(&w1d); CeedChk(ierr);
+  ierr = CeedFree(&qref); CeedChk(ierr);
+  ierr = CeedFree(&qweight); CeedChk(ierr);
+  ierr = CeedFree(&interp); CeedChk(ierr);
+  ierr = CeedFree(&grad); CeedChk(ierr);
   return 0;
 }
 
@@ -641,6 +1202,59 @@ int CeedBasisView(CeedBasis basis, FILE *stream) {
   return 0;
 }
 
+/**
+  @brief Get the number of bytes of memory held by a CeedBasis
+
+  This includes the basis matrices and quadrature rule, tensor contraction
+    data, and any data the backend reports, such as collocated gradients.
+
+  @param basis        CeedBasis
+  @param[out] bytes   Variable to store the number of bytes
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedBasisGetMemoryUsage(CeedBasis basis, size_t *bytes) {
+  int ierr;
+  const CeedInt dim = basis->dim, P = basis->P, Q = basis->Q;
+  const CeedInt P1d = basis->P1d, Q1d = basis->Q1d;
+  size_t n = 0;
+
+  // Matrices and quadrature rule
+  if (basis->tensorbasis)
+    n += 2*Q1d + 2*Q1d*P1d;
+  else
+    n += (dim + 1)*Q;
+  if (basis->interp) n += Q*P;
+  if (basis->grad) n += dim*Q*P;
+
+  // Factors of collapsed coordinate bases
+  if (basis->collapsed) {
+    const CeedInt npairs = P1d*(P1d+1)/2;
+    const CeedInt ncols[3] = {P1d, dim == 2 ? P : npairs, P};
+    n += Q1d;
+    for (CeedInt d=0; d<dim; d++)
+      n += 2*Q1d*ncols[d];
+  }
+
+  // Even-odd decomposition of 1D matrices
+  if (basis->contract) {
+    for (CeedInt i=0; i<basis->contract->numevenodd; i++) {
+      const CeedTensorContractEvenOdd *eo = &basis->contract->evenodd[i];
+      n += ((eo->J+1)/2)*eo->B + ((eo->B+1)/2)*eo->J;
+    }
+  }
+  *bytes = n*sizeof(CeedScalar);
+
+  if (basis->GetMemoryUsage) {
+    size_t backendbytes;
+    ierr = basis->GetMemoryUsage(basis, &backendbytes); CeedChk(ierr);
+    *bytes += backendbytes;
+  }
+  return 0;
+}
+
 /**
   @brief Apply basis evaluation from nodes to quadrature points or vice versa
 
@@ -654,6 +1268,9 @@ int CeedBasisView(CeedBasis basis, FILE *stream) {
   @param emode   \ref CEED_EVAL_NONE to use values directly,
                    \ref CEED_EVAL_INTERP to use interpolated values,
                    \ref CEED_EVAL_GRAD to use gradients,
+                   \ref CEED_EVAL_INTERP | \ref CEED_EVAL_GRAD to use
+                   interpolated values followed by gradients, computed in
+                   a single pass on backends that support it,
                    \ref CEED_EVAL_WEIGHT to use quadrature weights.
   @param[in] u   Input CeedVector
   @param[out] v  Output CeedVector
@@ -685,7 +1302,30 @@ int CeedBasisApply(CeedBasis basis, CeedInt nelem, CeedTransposeMode tmode,
     return CeedError(basis->ceed, 1, "Length of input/output vectors "
                      "incompatible with basis dimensions");
 
-  ierr = basis->Apply(basis, nelem, tmode, emode, u, v); CeedChk(ierr);
+  CeedTraceSample start;
+  CeedTraceStart(NULL, &start);
+  bool interpgrad = emode == (CEED_EVAL_INTERP | CEED_EVAL_GRAD);
+  if (!interpgrad) {
+    ierr = basis->Apply(basis, nelem, tmode, emode, u, v); CeedChk(ierr);
+  } else if (basis->ApplyInterpGrad) {
+    ierr = basis->ApplyInterpGrad(basis, nelem, tmode, u, v); CeedChk(ierr);
+  } else {
+    ierr = CeedBasisApplyInterpGradSplit(basis, nelem, tmode, u, v);
+    CeedChk(ierr);
+  }
+  size_t flops = 0;
+  if (start.time) {
+    ierr = CeedBasisGetFlopsEstimate(basis, tmode, emode, &flops);
+    CeedChk(ierr);
+  }
+  ierr = CeedTraceSpan(basis->ceed, CEED_TRACE_BASIS, __func__, &start,
+                       (double)nelem*flops, NULL,
+                       "\"elements\": %d, \"tmode\": \"%s\", "
+                       "\"emode\": \"%s\", \"nodes\": %d, \"qpoints\": %d, "
+                       "\"components\": %d", nelem, CeedTransposeModes[tmode],
+                       interpgrad ? "interpolation and gradient" :
+                       CeedEvalModes[emode], nnodes, nqpt, basis->ncomp);
+  CeedChk(ierr);
   return 0;
 }
 
@@ -850,11 +1490,12 @@ int CeedBasisGetInterp(CeedBasis basis, const CeedScalar **interp) {
   if (!basis->interp && basis->tensorbasis) {
     // Allocate
     int ierr;
-    ierr = CeedMalloc(basis->Q*basis->P, &basis->interp); CeedChk(ierr);
+    CeedScalar *full, *cached = NULL;
+    ierr = CeedMalloc(basis->Q*basis->P, &full); CeedChk(ierr);
 
     // Initialize
     for (CeedInt i=0; i<basis->Q*basis->P; i++)
-      basis->interp[i] = 1.0;
+      full[i] = 1.0;
 
     // Calculate
     for (CeedInt d=0; d<basis->dim; d++)
@@ -862,8 +1503,13 @@ int CeedBasisGetInterp(CeedBasis basis, const CeedScalar **interp) {
         for (CeedInt node=0; node<basis->P; node++) {
           CeedInt p = (node / CeedIntPow(basis->P1d, d)) % basis->P1d;
           CeedInt q = (qpt / CeedIntPow(basis->Q1d, d)) % basis->Q1d;
-          basis->interp[qpt*(basis->P)+node] *= basis->interp1d[q*basis->P1d+p];
+          full[qpt*(basis->P)+node] *= basis->interp1d[q*basis->P1d+p];
         }
+
+    // Store, unless another thread sharing the basis got there first
+    if (!CeedAtomicCompareExchange(basis->interp, cached, full)) {
+      ierr = CeedFree(&full); CeedChk(ierr);
+    }
   }
 
   *interp = basis->interp;
@@ -906,12 +1552,12 @@ int CeedBasisGetGrad(CeedBasis basis, const CeedScalar **grad) {
   if (!basis->grad && basis->tensorbasis) {
     // Allocate
     int ierr;
-    ierr = CeedMalloc(basis->dim*basis->Q*basis->P, &basis->grad);
-    CeedChk(ierr);
+    CeedScalar *full, *cached = NULL;
+    ierr = CeedMalloc(basis->dim*basis->Q*basis->P, &full); CeedChk(ierr);
 
     // Initialize
     for (CeedInt i=0; i<basis->dim*basis->Q*basis->P; i++)
-      basis->grad[i] = 1.0;
+      full[i] = 1.0;
 
     // Calculate
     for (CeedInt d=0; d<basis->dim; d++)
@@ -921,12 +1567,17 @@ int CeedBasisGetGrad(CeedBasis basis, const CeedScalar **grad) {
             CeedInt p = (node / CeedIntPow(basis->P1d, d)) % basis->P1d;
             CeedInt q = (qpt / CeedIntPow(basis->Q1d, d)) % basis->Q1d;
             if (i == d)
-              basis->grad[(i*basis->Q+qpt)*(basis->P)+node] *=
+              full[(i*basis->Q+qpt)*(basis->P)+node] *=
                 basis->grad1d[q*basis->P1d+p];
             else
-              basis->grad[(i*basis->Q+qpt)*(basis->P)+node] *=
+              full[(i*basis->Q+qpt)*(basis->P)+node] *=
                 basis->interp1d[q*basis->P1d+p];
           }
+
+    // Store, unless another thread sharing the basis got there first
+    if (!CeedAtomicCompareExchange(basis->grad, cached, full)) {
+      ierr = CeedFree(&full); CeedChk(ierr);
+    }
   }
 
   *grad = basis->grad;
@@ -967,7 +1618,24 @@ int CeedBasisGetGrad1D(CeedBasis basis, const CeedScalar **grad1d) {
 int CeedBasisDestroy(CeedBasis *basis) {
   int ierr;
 
-  if (!*basis || --(*basis)->refcount > 0) return 0;
+  if (!*basis) return 0;
+  if ((*basis)->cached) {
+    // Release the last reference and stop sharing the basis under the lock, so
+    //   no reference is taken from the cache meanwhile
+    Ceed ceed = (*basis)->ceed;
+    CeedLockAcquire(ceed->basiscachelock);
+    bool last = CeedAtomicAdd((*basis)->refcount, -1) == 0;
+    if (last) {
+      CeedBasis *b = &ceed->basiscache;
+      while (*b != *basis)
+        b = &(*b)->cachenext;
+      *b = (*basis)->cachenext;
+    }
+    CeedLockRelease(ceed->basiscachelock);
+    if (!last) return 0;
+  } else if (CeedAtomicAdd((*basis)->refcount, -1) > 0) {
+    return 0;
+  }
   if ((*basis)->Destroy) {
     ierr = (*basis)->Destroy(*basis); CeedChk(ierr);
   }
@@ -977,6 +1645,11 @@ int CeedBasisDestroy(CeedBasis *basis) {
   ierr = CeedFree(&(*basis)->grad1d); CeedChk(ierr);
   ierr = CeedFree(&(*basis)->qref1d); CeedChk(ierr);
   ierr = CeedFree(&(*basis)->qweight1d); CeedChk(ierr);
+  ierr = CeedFree(&(*basis)->collapsedqref1d); CeedChk(ierr);
+  for (CeedInt d=0; d<3; d++) {
+    ierr = CeedFree(&(*basis)->collapsedinterp[d]); CeedChk(ierr);
+    ierr = CeedFree(&(*basis)->collapsedderiv[d]); CeedChk(ierr);
+  }
   ierr = CeedDestroy(&(*basis)->ceed); CeedChk(ierr);
   ierr = CeedFree(basis); CeedChk(ierr);
   return 0;
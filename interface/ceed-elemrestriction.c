@@ -125,7 +125,7 @@ int CeedElemRestrictionGetOffsets(CeedElemRestriction rstr, CeedMemType mtype,
   // LCOV_EXCL_STOP
 
   ierr = rstr->GetOffsets(rstr, mtype, offsets); CeedChk(ierr);
-  rstr->numreaders++;
+  CeedAtomicAdd(rstr->numreaders, 1);
   return 0;
 }
 
@@ -142,7 +142,7 @@ int CeedElemRestrictionGetOffsets(CeedElemRestriction rstr, CeedMemType mtype,
 int CeedElemRestrictionRestoreOffsets(CeedElemRestriction rstr,
                                       const CeedInt **offsets) {
   *offsets = NULL;
-  rstr->numreaders--;
+  CeedAtomicAdd(rstr->numreaders, -1);
   return 0;
 }
 
@@ -263,6 +263,69 @@ int CeedElemRestrictionSetData(CeedElemRestriction rstr, void *data) {
   return 0;
 }
 
+/**
+  @brief Get a blocked CeedElemRestriction with the same offsets or strides
+
+  The permuted and padded copy is created on first use and cached on @a rstr,
+    so that all fields and operators sharing @a rstr also share one copy of the
+    blocked offsets. If @a rstr already has block size @a blksize, it is
+    returned itself. The caller owns a reference to @a blkrstr and must destroy
+    it with CeedElemRestrictionDestroy().
+
+  @param rstr            CeedElemRestriction
+  @param blksize         Number of elements in a block
+  @param[out] blkrstr    Variable to store blocked CeedElemRestriction
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetBlocked(CeedElemRestriction rstr, CeedInt blksize,
+                                  CeedElemRestriction *blkrstr) {
+  int ierr;
+  CeedElemRestriction cached = NULL;
+
+  // Reuse the restriction itself or its cached copy
+  if (rstr->blksize == blksize) {
+    CeedAtomicAdd(rstr->refcount, 1);
+    *blkrstr = rstr;
+    return 0;
+  }
+  if (rstr->blocked && rstr->blocked->blksize == blksize) {
+    CeedAtomicAdd(rstr->blocked->refcount, 1);
+    *blkrstr = rstr->blocked;
+    return 0;
+  }
+
+  // Create blocked copy
+  if (rstr->strides) {
+    ierr = CeedElemRestrictionCreateBlockedStrided(rstr->ceed, rstr->nelem,
+           rstr->elemsize, blksize, rstr->ncomp, rstr->lsize, rstr->strides,
+           blkrstr); CeedChk(ierr);
+  } else {
+    const CeedInt *offsets;
+    ierr = CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionCreateBlocked(rstr->ceed, rstr->nelem,
+                                            rstr->elemsize, blksize,
+                                            rstr->ncomp, rstr->compstride,
+                                            rstr->lsize, CEED_MEM_HOST,
+                                            CEED_COPY_VALUES, offsets, blkrstr);
+    CeedChk(ierr);
+    ierr = CeedElemRestrictionRestoreOffsets(rstr, &offsets); CeedChk(ierr);
+  }
+
+  // Cache copy, unless another block size or another thread got there first
+  if (CeedAtomicCompareExchange(rstr->blocked, cached, *blkrstr)) {
+    CeedAtomicAdd((*blkrstr)->refcount, 1);
+  } else if (cached->blksize == blksize) {
+    ierr = CeedElemRestrictionDestroy(blkrstr); CeedChk(ierr);
+    CeedAtomicAdd(cached->refcount, 1);
+    *blkrstr = cached;
+  }
+  return 0;
+}
+
 /// @}
 
 /// @cond DOXYGEN_SKIP
@@ -335,7 +398,7 @@ int CeedElemRestrictionCreate(Ceed ceed, CeedInt nelem, CeedInt elemsize,
 
   ierr = CeedCalloc(1, rstr); CeedChk(ierr);
   (*rstr)->ceed = ceed;
-  ceed->refcount++;
+  CeedAtomicAdd(ceed->refcount, 1);
   (*rstr)->refcount = 1;
   (*rstr)->nelem = nelem;
   (*rstr)->elemsize = elemsize;
@@ -396,7 +459,7 @@ int CeedElemRestrictionCreateStrided(Ceed ceed, CeedInt nelem, CeedInt elemsize,
 
   ierr = CeedCalloc(1, rstr); CeedChk(ierr);
   (*rstr)->ceed = ceed;
-  ceed->refcount++;
+  CeedAtomicAdd(ceed->refcount, 1);
   (*rstr)->refcount = 1;
   (*rstr)->nelem = nelem;
   (*rstr)->elemsize = elemsize;
@@ -481,7 +544,7 @@ int CeedElemRestrictionCreateBlocked(Ceed ceed, CeedInt nelem, CeedInt elemsize,
   CeedChk(ierr);
 
   (*rstr)->ceed = ceed;
-  ceed->refcount++;
+  CeedAtomicAdd(ceed->refcount, 1);
   (*rstr)->refcount = 1;
   (*rstr)->nelem = nelem;
   (*rstr)->elemsize = elemsize;
@@ -550,7 +613,7 @@ int CeedElemRestrictionCreateBlockedStrided(Ceed ceed, CeedInt nelem,
   ierr = CeedCalloc(1, rstr); CeedChk(ierr);
 
   (*rstr)->ceed = ceed;
-  ceed->refcount++;
+  CeedAtomicAdd(ceed->refcount, 1);
   (*rstr)->refcount = 1;
   (*rstr)->nelem = nelem;
   (*rstr)->elemsize = elemsize;
@@ -631,7 +694,16 @@ int CeedElemRestrictionApply(CeedElemRestriction rstr, CeedTransposeMode tmode,
     return CeedError(rstr->ceed, 2, "Output vector size %d not compatible with "
                      "element restriction (%d, %d)", ru->length, m, n);
   // LCOV_EXCL_STOP
+  CeedTraceSample start;
+  CeedTraceStart(NULL, &start);
   ierr = rstr->Apply(rstr, tmode, u, ru, request); CeedChk(ierr);
+  ierr = CeedTraceSpan(rstr->ceed, CEED_TRACE_RESTRICTION, __func__, &start,
+                       tmode == CEED_TRANSPOSE ? (double)rstr->nelem*
+                       rstr->elemsize*rstr->ncomp : 0, NULL,
+                       "\"elements\": %d, \"tmode\": \"%s\", "
+                       "\"nodes\": %d, \"components\": %d", rstr->nelem,
+                       CeedTransposeModes[tmode], rstr->elemsize, rstr->ncomp);
+  CeedChk(ierr);
 
   return 0;
 }
@@ -683,8 +755,18 @@ int CeedElemRestrictionApplyBlock(CeedElemRestriction rstr, CeedInt block,
                      "total elements %d", block, rstr->blksize*block,
                      rstr->nelem);
   // LCOV_EXCL_STOP
+  CeedTraceSample start;
+  CeedTraceStart(NULL, &start);
   ierr = rstr->ApplyBlock(rstr, block, tmode, u, ru, request);
   CeedChk(ierr);
+  ierr = CeedTraceSpan(rstr->ceed, CEED_TRACE_RESTRICTION, __func__, &start,
+                       tmode == CEED_TRANSPOSE ? (double)rstr->blksize*
+                       rstr->elemsize*rstr->ncomp : 0, NULL,
+                       "\"elements\": %d, \"block\": %d, \"tmode\": \"%s\", "
+                       "\"nodes\": %d, \"components\": %d", rstr->blksize,
+                       block, CeedTransposeModes[tmode], rstr->elemsize,
+                       rstr->ncomp);
+  CeedChk(ierr);
 
   return 0;
 }
@@ -857,6 +939,40 @@ int CeedElemRestrictionView(CeedElemRestriction rstr, FILE *stream) {
   return 0;
 }
 
+/**
+  @brief Get the number of bytes of memory held by a CeedElemRestriction
+
+  Offsets provided with @ref CEED_USE_POINTER are not counted. Backends that do
+    not report their usage are assumed to hold one copy of the offsets, or none
+    for strided restrictions. The blocked copy shared by operators, see
+    CeedElemRestrictionGetBlocked(), is included.
+
+  @param rstr         CeedElemRestriction
+  @param[out] bytes   Variable to store the number of bytes
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedElemRestrictionGetMemoryUsage(CeedElemRestriction rstr,
+                                      size_t *bytes) {
+  int ierr;
+
+  if (rstr->GetMemoryUsage) {
+    ierr = rstr->GetMemoryUsage(rstr, bytes); CeedChk(ierr);
+  } else {
+    *bytes = rstr->strides ? 0 : (size_t)rstr->nblk * rstr->blksize *
+             rstr->elemsize * sizeof(CeedInt);
+  }
+  if (rstr->blocked) {
+    size_t blkbytes;
+    ierr = CeedElemRestrictionGetMemoryUsage(rstr->blocked, &blkbytes);
+    CeedChk(ierr);
+    *bytes += blkbytes;
+  }
+  return 0;
+}
+
 /**
   @brief Destroy a CeedElemRestriction
 
@@ -869,13 +985,14 @@ int CeedElemRestrictionView(CeedElemRestriction rstr, FILE *stream) {
 int CeedElemRestrictionDestroy(CeedElemRestriction *rstr) {
   int ierr;
 
-  if (!*rstr || --(*rstr)->refcount > 0) return 0;
+  if (!*rstr || CeedAtomicAdd((*rstr)->refcount, -1) > 0) return 0;
   if ((*rstr)->numreaders)
     return CeedError((*rstr)->ceed, 1, "Cannot destroy CeedElemRestriction, "
                      "a process has read access to the offset data");
   if ((*rstr)->Destroy) {
     ierr = (*rstr)->Destroy(*rstr); CeedChk(ierr);
   }
+  ierr = CeedElemRestrictionDestroy(&(*rstr)->blocked); CeedChk(ierr);
   ierr = CeedFree(&(*rstr)->strides); CeedChk(ierr);
   ierr = CeedDestroy(&(*rstr)->ceed); CeedChk(ierr);
   ierr = CeedFree(rstr); CeedChk(ierr);
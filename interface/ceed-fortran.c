@@ -731,7 +731,7 @@ static int CeedQFunctionFortranStub(void *ctx, int nq,
   //         single source files, so only Host backends need to
   //         use this Fortran stub.
   if (innerctx) {
-    ierr = CeedQFunctionContextGetData(innerctx, CEED_MEM_HOST, &ctx_);
+    ierr = CeedQFunctionContextGetDataRead(innerctx, CEED_MEM_HOST, &ctx_);
     CeedChk(ierr);
   }
 
@@ -741,7 +741,7 @@ static int CeedQFunctionFortranStub(void *ctx, int nq,
           v[10],v[11],v[12],v[13],v[14],v[15],&ierr);
 
   if (innerctx) {
-    ierr = CeedQFunctionContextRestoreData(innerctx, (void *)&ctx_);
+    ierr = CeedQFunctionContextRestoreDataRead(innerctx, (void *)&ctx_);
     CeedChk(ierr);
   }
 
@@ -1224,6 +1224,13 @@ void fCeedOperatorMultigridLevelCreateH1(int *opFine, int *pMultFine,
   CeedOperator_n += 3;
 }
 
+#define fCeedOperatorSetStrategy \
+    FORTRAN_NAME(ceedoperatorsetstrategy,CEEDOPERATORSETSTRATEGY)
+void fCeedOperatorSetStrategy(int *op, int *strategy, int *err) {
+  *err = CeedOperatorSetStrategy(CeedOperator_dict[*op],
+                                 (CeedOperatorStrategy)*strategy);
+}
+
 #define fCeedOperatorView \
     FORTRAN_NAME(ceedoperatorview,CEEDOPERATORVIEW)
 void fCeedOperatorView(int *op, int *err) {
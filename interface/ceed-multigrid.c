@@ -0,0 +1,231 @@
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC. Produced at
+// the Lawrence Livermore National Laboratory. LLNL-CODE-734707. All Rights
+// reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <ceed-impl.h>
+#include <ceed-backend.h>
+
+/// @file
+/// Implementation of CeedMultigrid interfaces
+
+/// ----------------------------------------------------------------------------
+/// CeedMultigrid Public API
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedOperatorUser
+/// @{
+
+/**
+  @brief Create a p-multigrid hierarchy for a CeedOperator
+
+  Level 0 is the fine grid operator opFine, and level i+1 is created from
+    level i with the coarse grid restriction rstrCoarse[i] and basis
+    basisCoarse[i], as in CeedOperatorMultigridLevelCreate(). Composite
+    operators are coarsened by coarsening each sub-operator; all sub-operators
+    must share the active restriction and basis.
+
+  The grid transfer operators apply the coarse to fine interpolation basis
+    directly between E-vectors. The multiplicity scaling is applied to the
+    fine grid L-vector by CeedMultigridProlong() and CeedMultigridRestrict().
+
+  @param opFine           Fine grid operator
+  @param numlevels        Number of levels in the hierarchy, including opFine
+  @param PMult            Array of numlevels-1 L-vector multiplicities in
+                            parallel gather/scatter, for levels 0 to
+                            numlevels-2
+  @param rstrCoarse       Array of numlevels-1 restrictions for levels 1 to
+                            numlevels-1
+  @param basisCoarse      Array of numlevels-1 active vector bases for levels 1
+                            to numlevels-1
+  @param[out] mg          Address of the variable where the newly created
+                            CeedMultigrid will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedMultigridCreate(CeedOperator opFine, CeedInt numlevels,
+                        CeedVector *PMult, CeedElemRestriction *rstrCoarse,
+                        CeedBasis *basisCoarse, CeedMultigrid *mg) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(opFine, &ceed); CeedChk(ierr);
+
+  if (numlevels < 1)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "CeedMultigrid must have at least one level");
+  // LCOV_EXCL_STOP
+
+  ierr = CeedCalloc(1, mg); CeedChk(ierr);
+  (*mg)->ceed = ceed;
+  CeedAtomicAdd(ceed->refcount, 1);
+  (*mg)->refcount = 1;
+  (*mg)->numlevels = numlevels;
+  ierr = CeedCalloc(numlevels, &(*mg)->ops); CeedChk(ierr);
+  ierr = CeedCalloc(numlevels, &(*mg)->opprolong); CeedChk(ierr);
+  ierr = CeedCalloc(numlevels, &(*mg)->oprestrict); CeedChk(ierr);
+  ierr = CeedCalloc(numlevels, &(*mg)->multinv); CeedChk(ierr);
+  ierr = CeedCalloc(numlevels, &(*mg)->work); CeedChk(ierr);
+
+  (*mg)->ops[0] = opFine;
+  CeedAtomicAdd(opFine->refcount, 1);
+  for (CeedInt i=0; i<numlevels-1; i++) {
+    ierr = CeedOperatorMultigridLevelCreateFused((*mg)->ops[i], PMult[i],
+           rstrCoarse[i], basisCoarse[i], &(*mg)->ops[i+1],
+           &(*mg)->opprolong[i], &(*mg)->oprestrict[i], &(*mg)->multinv[i]);
+    CeedChk(ierr);
+    CeedInt length;
+    ierr = CeedVectorGetLength((*mg)->multinv[i], &length); CeedChk(ierr);
+    ierr = CeedVectorCreate(ceed, length, &(*mg)->work[i]); CeedChk(ierr);
+  }
+
+  return 0;
+}
+
+/**
+  @brief Get the number of levels of a CeedMultigrid
+
+  @param mg              CeedMultigrid
+  @param[out] numlevels  Variable to store number of levels
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedMultigridGetNumLevels(CeedMultigrid mg, CeedInt *numlevels) {
+  *numlevels = mg->numlevels;
+  return 0;
+}
+
+/**
+  @brief Get the operator on one level of a CeedMultigrid
+
+  The operator is owned by the CeedMultigrid and must not be destroyed by the
+    caller.
+
+  @param mg       CeedMultigrid
+  @param level    Level, with 0 the finest
+  @param[out] op  Variable to store the operator
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedMultigridGetOperator(CeedMultigrid mg, CeedInt level,
+                             CeedOperator *op) {
+  if (level < 0 || level >= mg->numlevels)
+    // LCOV_EXCL_START
+    return CeedError(mg->ceed, 1, "Level %d out of range for CeedMultigrid "
+                     "with %d levels", level, mg->numlevels);
+  // LCOV_EXCL_STOP
+
+  *op = mg->ops[level];
+  return 0;
+}
+
+/**
+  @brief Prolong a vector from level+1 to level of a CeedMultigrid
+
+  @param mg       CeedMultigrid
+  @param level    Fine level of the transfer
+  @param uc       Input CeedVector on level+1
+  @param[out] uf  Output CeedVector on level
+  @param request  Address of CeedRequest for non-blocking completion, else
+                    @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedMultigridProlong(CeedMultigrid mg, CeedInt level, CeedVector uc,
+                         CeedVector uf, CeedRequest *request) {
+  int ierr;
+
+  if (level < 0 || level >= mg->numlevels - 1)
+    // LCOV_EXCL_START
+    return CeedError(mg->ceed, 1, "No grid transfer from level %d for "
+                     "CeedMultigrid with %d levels", level, mg->numlevels);
+  // LCOV_EXCL_STOP
+
+  ierr = CeedOperatorApply(mg->opprolong[level], uc, uf, request);
+  CeedChk(ierr);
+  ierr = CeedVectorPointwiseMult(uf, uf, mg->multinv[level]); CeedChk(ierr);
+
+  return 0;
+}
+
+/**
+  @brief Restrict a vector from level to level+1 of a CeedMultigrid
+
+  @param mg       CeedMultigrid
+  @param level    Fine level of the transfer
+  @param uf       Input CeedVector on level
+  @param[out] uc  Output CeedVector on level+1
+  @param request  Address of CeedRequest for non-blocking completion, else
+                    @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedMultigridRestrict(CeedMultigrid mg, CeedInt level, CeedVector uf,
+                          CeedVector uc, CeedRequest *request) {
+  int ierr;
+
+  if (level < 0 || level >= mg->numlevels - 1)
+    // LCOV_EXCL_START
+    return CeedError(mg->ceed, 1, "No grid transfer from level %d for "
+                     "CeedMultigrid with %d levels", level, mg->numlevels);
+  // LCOV_EXCL_STOP
+
+  ierr = CeedVectorPointwiseMult(mg->work[level], uf, mg->multinv[level]);
+  CeedChk(ierr);
+  ierr = CeedOperatorApply(mg->oprestrict[level], mg->work[level], uc,
+                           request); CeedChk(ierr);
+
+  return 0;
+}
+
+/**
+  @brief Destroy a CeedMultigrid
+
+  @param mg  CeedMultigrid to destroy
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedMultigridDestroy(CeedMultigrid *mg) {
+  int ierr;
+
+  if (!*mg || CeedAtomicAdd((*mg)->refcount, -1) > 0) return 0;
+  for (CeedInt i=0; i<(*mg)->numlevels; i++) {
+    ierr = CeedOperatorDestroy(&(*mg)->ops[i]); CeedChk(ierr);
+    ierr = CeedOperatorDestroy(&(*mg)->opprolong[i]); CeedChk(ierr);
+    ierr = CeedOperatorDestroy(&(*mg)->oprestrict[i]); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&(*mg)->multinv[i]); CeedChk(ierr);
+    ierr = CeedVectorDestroy(&(*mg)->work[i]); CeedChk(ierr);
+  }
+  ierr = CeedFree(&(*mg)->ops); CeedChk(ierr);
+  ierr = CeedFree(&(*mg)->opprolong); CeedChk(ierr);
+  ierr = CeedFree(&(*mg)->oprestrict); CeedChk(ierr);
+  ierr = CeedFree(&(*mg)->multinv); CeedChk(ierr);
+  ierr = CeedFree(&(*mg)->work); CeedChk(ierr);
+  ierr = CeedDestroy(&(*mg)->ceed); CeedChk(ierr);
+  ierr = CeedFree(mg); CeedChk(ierr);
+
+  return 0;
+}
+
+/// @}
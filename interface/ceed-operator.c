@@ -14,10 +14,17 @@
 // software, applications, hardware, advanced system engineering and early
 // testbed platforms, in support of the nation's exascale computing imperative.
 
+#define _POSIX_C_SOURCE 200112
 #include <ceed-impl.h>
 #include <ceed-backend.h>
 #include <string.h>
 #include <math.h>
+#include <time.h>
+
+/// Assumed machine balance, in flops per byte, for apply strategy estimates
+#define CEED_STRATEGY_FLOPS_PER_BYTE 8.0
+/// Estimated cost ratio beyond which CEED_STRATEGY_AUTO skips the timing probe
+#define CEED_STRATEGY_PROBE_RATIO 4.0
 
 /// @file
 /// Implementation of CeedOperator interfaces
@@ -102,6 +109,10 @@ static int CeedOperatorCheckReady(Ceed ceed, CeedOperator op) {
       // LCOV_EXCL_START
       return CeedError(ceed, 1, "No suboperators set");
     // LCOV_EXCL_STOP
+    for (CeedInt i=0; i<op->numsub; i++) {
+      int ierr = CeedOperatorCheckReady(ceed, op->suboperators[i]);
+      CeedChk(ierr);
+    }
   } else {
     if (op->nfields == 0)
       // LCOV_EXCL_START
@@ -124,6 +135,28 @@ static int CeedOperatorCheckReady(Ceed ceed, CeedOperator op) {
   return 0;
 }
 
+/**
+  @brief Write a trace event for a CeedOperator call started by
+           CeedTraceStart()
+
+  @param[in] op        CeedOperator
+  @param[in] category  Category of the call, CEED_TRACE_OPERATOR or
+                         CEED_TRACE_ASSEMBLY
+  @param[in] name      Name of the interface function
+  @param[in] start     Start of the call
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorTrace(CeedOperator op, CeedTraceCategory category,
+                             const char *name, const CeedTraceSample *start) {
+  return CeedTraceSpan(op->ceed, category, name, start, 0, op->name,
+                       "\"elements\": %d, \"qpoints\": %d, "
+                       "\"suboperators\": %d", op->numelements,
+                       op->numqpoints, op->numsub);
+}
+
 /**
   @brief View a field of a CeedOperator
 
@@ -157,6 +190,80 @@ static int CeedOperatorFieldView(CeedOperatorField field,
   else if (field->vec == CEED_VECTOR_NONE)
     fprintf(stream, "%s      No vector\n", pre);
 
+  if (field->precision != CEED_PRECISION_SCALAR)
+    fprintf(stream, "%s      Storage precision: %s\n", pre,
+            CeedFieldPrecisions[field->precision]);
+
+  return 0;
+}
+
+/**
+  @brief Estimate the flops and bytes of memory traffic of one application of
+           a single CeedOperator
+
+  Flops count basis contractions, as in CeedBasisGetFlopsEstimate(), sums of
+    transpose restrictions, and the QFunction flops per quadrature point set
+    by CeedQFunctionSetUserFlopsEstimate(). Bytes count the L-vector values
+    gathered by input restrictions, read and written by output restrictions,
+    their offsets, and the QFunction input and output values. Quadrature
+    weights are computed once at setup and not counted.
+
+  @param[in] op      CeedOperator
+  @param[out] flops  Variable to store the estimated flops
+  @param[out] bytes  Variable to store the estimated bytes
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorGetEstimates(CeedOperator op, size_t *flops,
+                                    size_t *bytes) {
+  int ierr;
+  CeedQFunction qf = op->qf;
+  const size_t nelem = op->numelements, nqpts = op->numqpoints;
+
+  *flops = nelem*nqpts*qf->userflops;
+  *bytes = 0;
+  for (CeedInt out=0; out<2; out++) {
+    CeedInt numfields = out ? qf->numoutputfields : qf->numinputfields;
+    CeedOperatorField *opfields = out ? op->outputfields : op->inputfields;
+    CeedQFunctionField *qffields = out ? qf->outputfields : qf->inputfields;
+    for (CeedInt i=0; i<numfields; i++) {
+      CeedEvalMode emode = qffields[i]->emode;
+      CeedElemRestriction rstr = opfields[i]->Erestrict;
+      CeedBasis basis = opfields[i]->basis;
+
+      // QFunction values
+      *bytes += nelem*nqpts*qffields[i]->size*sizeof(CeedScalar);
+      if (emode == CEED_EVAL_WEIGHT)
+        continue;
+
+      // Basis contractions
+      if (basis != CEED_BASIS_COLLOCATED && emode != CEED_EVAL_NONE) {
+        size_t basisflops;
+        ierr = CeedBasisGetFlopsEstimate(basis, out ? CEED_TRANSPOSE :
+                                         CEED_NOTRANSPOSE, emode, &basisflops);
+        CeedChk(ierr);
+        *flops += nelem*basisflops;
+      }
+
+      // Restriction values and offsets
+      if (rstr != CEED_ELEMRESTRICTION_NONE) {
+        bool strided;
+        size_t valuesize;
+        const size_t nodes = (size_t)rstr->nelem*rstr->elemsize;
+        ierr = CeedElemRestrictionIsStrided(rstr, &strided); CeedChk(ierr);
+        ierr = CeedFieldPrecisionGetSize(opfields[i]->precision, &valuesize);
+        CeedChk(ierr);
+        if (out)
+          *flops += nodes*rstr->ncomp;
+        *bytes += (out ? 2 : 1)*nodes*rstr->ncomp*valuesize;
+        if (!strided)
+          *bytes += nodes*sizeof(CeedInt);
+      }
+    }
+  }
+
   return 0;
 }
 
@@ -194,13 +301,37 @@ int CeedOperatorSingleView(CeedOperator op, bool sub, FILE *stream) {
                                  i, sub, 0, stream); CeedChk(ierr);
   }
 
+  if (op->strategy != CEED_STRATEGY_MATRIX_FREE) {
+    fprintf(stream, "%s  Strategy: %s", pre,
+            CeedOperatorStrategies[op->strategy]);
+    if (!op->strategyset)
+      fprintf(stream, ", selected at first apply\n");
+    else if (op->useassembled)
+      fprintf(stream, ", using assembled CSR matrix (%d rows, %d nonzeros)\n",
+              op->csrnrows, op->csrrowptr ? op->csrrowptr[op->csrnrows] : 0);
+    else
+      fprintf(stream, ", using matrix-free apply\n");
+    if (op->probetime[0] > 0.0)
+      fprintf(stream, "%s    Timing probe: matrix-free %.3e s, assembled "
+              "%.3e s\n", pre, op->probetime[0], op->probetime[1]);
+  }
+
+  size_t flops, bytes;
+  ierr = CeedOperatorGetEstimates(op, &flops, &bytes); CeedChk(ierr);
+  fprintf(stream, "%s  Estimated flops per apply: %zu\n", pre, flops);
+  fprintf(stream, "%s  Estimated bytes per apply: %zu\n", pre, bytes);
+
   return 0;
 }
 
 /**
-  @brief Find the active vector basis for a CeedOperator
+  @brief Find the active vector restriction and basis for a CeedOperator
+
+  For a composite CeedOperator, all sub-operators must share the same active
+    restriction and basis.
 
   @param[in] op            CeedOperator to find active basis for
+  @param[out] activeRstr   Restriction for active input vector, or NULL
   @param[out] activeBasis  Basis for active input vector
 
   @return An error code: 0 - success, otherwise - failure
@@ -208,17 +339,39 @@ int CeedOperatorSingleView(CeedOperator op, bool sub, FILE *stream) {
   @ ref Developer
 **/
 static int CeedOperatorGetActiveBasis(CeedOperator op,
+                                      CeedElemRestriction *activeRstr,
                                       CeedBasis *activeBasis) {
+  int ierr;
+  CeedElemRestriction rstr = NULL;
   *activeBasis = NULL;
-  for (int i = 0; i < op->qf->numinputfields; i++)
-    if (op->inputfields[i]->vec == CEED_VECTOR_ACTIVE) {
-      *activeBasis = op->inputfields[i]->basis;
-      break;
+  if (op->composite) {
+    for (CeedInt i=0; i<op->numsub; i++) {
+      CeedElemRestriction subRstr;
+      CeedBasis subBasis;
+      ierr = CeedOperatorGetActiveBasis(op->suboperators[i], &subRstr,
+                                        &subBasis); CeedChk(ierr);
+      if (i && (subRstr != rstr || subBasis != *activeBasis))
+        // LCOV_EXCL_START
+        return CeedError(op->ceed, 1, "Automatic multigrid setup for composite "
+                         "operators requires a shared active restriction and "
+                         "basis");
+      // LCOV_EXCL_STOP
+      rstr = subRstr;
+      *activeBasis = subBasis;
     }
+  } else {
+    for (int i = 0; i < op->qf->numinputfields; i++)
+      if (op->inputfields[i]->vec == CEED_VECTOR_ACTIVE) {
+        rstr = op->inputfields[i]->Erestrict;
+        *activeBasis = op->inputfields[i]->basis;
+        break;
+      }
+  }
+  if (activeRstr)
+    *activeRstr = rstr;
 
   if (!*activeBasis) {
     // LCOV_EXCL_START
-    int ierr;
     Ceed ceed;
     ierr = CeedOperatorGetCeed(op, &ceed); CeedChk(ierr);
     return CeedError(ceed, 1,
@@ -228,49 +381,48 @@ static int CeedOperatorGetActiveBasis(CeedOperator op,
   return 0;
 }
 
-
 /**
-  @brief Common code for creating a multigrid coarse operator and level
-           transfer operators for a CeedOperator
+  @brief Create a coarse grid operator by replacing the active restriction and
+           basis of a CeedOperator
+
+  For a composite CeedOperator, each sub-operator is coarsened.
 
   @param[in] opFine       Fine grid operator
-  @param[in] PMultFine    L-vector multiplicity in parallel gather/scatter
   @param[in] rstrCoarse   Coarse grid restriction
   @param[in] basisCoarse  Coarse grid active vector basis
-  @param[in] basisCtoF    Basis for coarse to fine interpolation
   @param[out] opCoarse    Coarse grid operator
-  @param[out] opProlong   Coarse to fine operator
-  @param[out] opRestrict  Fine to coarse operator
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref Developer
 **/
-static int CeedOperatorMultigridLevel_Core(CeedOperator opFine,
-    CeedVector PMultFine, CeedElemRestriction rstrCoarse, CeedBasis basisCoarse,
-    CeedBasis basisCtoF, CeedOperator *opCoarse, CeedOperator *opProlong,
-    CeedOperator *opRestrict) {
+static int CeedOperatorMultigridCoarsen(CeedOperator opFine,
+                                        CeedElemRestriction rstrCoarse,
+                                        CeedBasis basisCoarse,
+                                        CeedOperator *opCoarse) {
   int ierr;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(opFine, &ceed); CeedChk(ierr);
 
-  // Check for composite operator
-  bool isComposite;
-  ierr = CeedOperatorIsComposite(opFine, &isComposite); CeedChk(ierr);
-  if (isComposite)
-    // LCOV_EXCL_START
-    return CeedError(ceed, 1,
-                     "Automatic multigrid setup for composite operators not supported");
-  // LCOV_EXCL_STOP
+  // Composite operator
+  if (opFine->composite) {
+    ierr = CeedCompositeOperatorCreate(ceed, opCoarse); CeedChk(ierr);
+    for (CeedInt i=0; i<opFine->numsub; i++) {
+      CeedOperator subCoarse;
+      ierr = CeedOperatorMultigridCoarsen(opFine->suboperators[i], rstrCoarse,
+                                          basisCoarse, &subCoarse);
+      CeedChk(ierr);
+      ierr = CeedCompositeOperatorAddSub(*opCoarse, subCoarse); CeedChk(ierr);
+      ierr = CeedOperatorDestroy(&subCoarse); CeedChk(ierr);
+    }
+    return 0;
+  }
 
-  // Coarse Grid
   ierr = CeedOperatorCreate(ceed, opFine->qf, opFine->dqf, opFine->dqfT,
                             opCoarse); CeedChk(ierr);
-  CeedElemRestriction rstrFine = NULL;
   // -- Clone input fields
   for (int i = 0; i < opFine->qf->numinputfields; i++) {
     if (opFine->inputfields[i]->vec == CEED_VECTOR_ACTIVE) {
-      rstrFine = opFine->inputfields[i]->Erestrict;
       ierr = CeedOperatorSetField(*opCoarse, opFine->inputfields[i]->fieldname,
                                   rstrCoarse, basisCoarse, CEED_VECTOR_ACTIVE);
       CeedChk(ierr);
@@ -279,6 +431,8 @@ static int CeedOperatorMultigridLevel_Core(CeedOperator opFine,
                                   opFine->inputfields[i]->Erestrict,
                                   opFine->inputfields[i]->basis,
                                   opFine->inputfields[i]->vec); CeedChk(ierr);
+      (*opCoarse)->inputfields[i]->precision =
+        opFine->inputfields[i]->precision;
     }
   }
   // -- Clone output fields
@@ -294,6 +448,50 @@ static int CeedOperatorMultigridLevel_Core(CeedOperator opFine,
                                   opFine->outputfields[i]->vec); CeedChk(ierr);
     }
   }
+  return 0;
+}
+
+/**
+  @brief Common code for creating a multigrid coarse operator and level
+           transfer operators for a CeedOperator
+
+  If multInv is NULL, the transfer operators include the multiplicity scaling
+    in a QFunction. Otherwise, the transfer operators use an identity
+    QFunction, so backends apply the coarse to fine basis directly between
+    E-vectors, and the inverse multiplicity L-vector is returned. The scaling
+    of E-vector entries by the multiplicity of their L-vector nodes commutes
+    with the transpose restriction, so the caller scales the fine L-vector
+    after prolongation and before restriction.
+
+  @param[in] opFine       Fine grid operator
+  @param[in] PMultFine    L-vector multiplicity in parallel gather/scatter
+  @param[in] rstrCoarse   Coarse grid restriction
+  @param[in] basisCoarse  Coarse grid active vector basis
+  @param[in] basisCtoF    Basis for coarse to fine interpolation
+  @param[out] opCoarse    Coarse grid operator
+  @param[out] opProlong   Coarse to fine operator
+  @param[out] opRestrict  Fine to coarse operator
+  @param[out] multInv     Inverse multiplicity of the fine L-vector, or NULL
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorMultigridLevel_Core(CeedOperator opFine,
+    CeedVector PMultFine, CeedElemRestriction rstrCoarse, CeedBasis basisCoarse,
+    CeedBasis basisCtoF, CeedOperator *opCoarse, CeedOperator *opProlong,
+    CeedOperator *opRestrict, CeedVector *multInv) {
+  int ierr;
+  Ceed ceed;
+  ierr = CeedOperatorGetCeed(opFine, &ceed); CeedChk(ierr);
+
+  // Coarse Grid
+  ierr = CeedOperatorMultigridCoarsen(opFine, rstrCoarse, basisCoarse,
+                                      opCoarse); CeedChk(ierr);
+  CeedElemRestriction rstrFine;
+  CeedBasis basisFine;
+  ierr = CeedOperatorGetActiveBasis(opFine, &rstrFine, &basisFine);
+  CeedChk(ierr);
 
   // Multiplicity vector
   CeedVector multVec, multE;
@@ -308,9 +506,45 @@ static int CeedOperatorMultigridLevel_Core(CeedOperator opFine,
   ierr = CeedVectorDestroy(&multE); CeedChk(ierr);
   ierr = CeedVectorReciprocal(multVec); CeedChk(ierr);
 
-  // Restriction
+  // Identity transfer operators
   CeedInt ncomp;
   ierr = CeedBasisGetNumComponents(basisCoarse, &ncomp); CeedChk(ierr);
+  if (multInv) {
+    // -- Restriction
+    CeedQFunction qfRestrict;
+    ierr = CeedQFunctionCreateIdentity(ceed, ncomp, CEED_EVAL_NONE,
+                                       CEED_EVAL_INTERP, &qfRestrict);
+    CeedChk(ierr);
+    ierr = CeedOperatorCreate(ceed, qfRestrict, CEED_QFUNCTION_NONE,
+                              CEED_QFUNCTION_NONE, opRestrict);
+    CeedChk(ierr);
+    ierr = CeedOperatorSetField(*opRestrict, "input", rstrFine,
+                                CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+    CeedChk(ierr);
+    ierr = CeedOperatorSetField(*opRestrict, "output", rstrCoarse, basisCtoF,
+                                CEED_VECTOR_ACTIVE); CeedChk(ierr);
+    // -- Prolongation
+    CeedQFunction qfProlong;
+    ierr = CeedQFunctionCreateIdentity(ceed, ncomp, CEED_EVAL_INTERP,
+                                       CEED_EVAL_NONE, &qfProlong);
+    CeedChk(ierr);
+    ierr = CeedOperatorCreate(ceed, qfProlong, CEED_QFUNCTION_NONE,
+                              CEED_QFUNCTION_NONE, opProlong);
+    CeedChk(ierr);
+    ierr = CeedOperatorSetField(*opProlong, "input", rstrCoarse, basisCtoF,
+                                CEED_VECTOR_ACTIVE); CeedChk(ierr);
+    ierr = CeedOperatorSetField(*opProlong, "output", rstrFine,
+                                CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+    CeedChk(ierr);
+    // -- Cleanup
+    *multInv = multVec;
+    ierr = CeedBasisDestroy(&basisCtoF); CeedChk(ierr);
+    ierr = CeedQFunctionDestroy(&qfRestrict); CeedChk(ierr);
+    ierr = CeedQFunctionDestroy(&qfProlong); CeedChk(ierr);
+    return 0;
+  }
+
+  // Restriction
   CeedQFunction qfRestrict;
   ierr = CeedQFunctionCreateInteriorByName(ceed, "Scale", &qfRestrict);
   CeedChk(ierr);
@@ -385,155 +619,1009 @@ static int CeedOperatorMultigridLevel_Core(CeedOperator opFine,
   return 0;
 }
 
-/// @}
+/**
+  @brief Get the active restriction, basis, and evaluation modes on one side of
+           a CeedOperator for assembly
+
+  @param[in] op          CeedOperator
+  @param[in] isinput     true for active input fields; false for active outputs
+  @param[out] supported  Variable to store whether the active fields share a
+                           single restriction and non-collocated basis
+  @param[out] rstr       Active CeedElemRestriction
+  @param[out] basis      Active CeedBasis
+  @param[out] numemodes  Number of evaluation modes, with CEED_EVAL_GRAD
+                           counted once per dimension
+  @param[out] emodes     Array of evaluation modes, to be freed by the caller
 
-/// ----------------------------------------------------------------------------
-/// CeedOperator Backend API
-/// ----------------------------------------------------------------------------
-/// @addtogroup CeedOperatorBackend
-/// @{
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorGetActiveEvalModes(CeedOperator op, bool isinput,
+    bool *supported, CeedElemRestriction *rstr, CeedBasis *basis,
+    CeedInt *numemodes, CeedEvalMode **emodes) {
+  int ierr;
+  CeedInt numfields = isinput ? op->qf->numinputfields :
+                      op->qf->numoutputfields;
+  CeedOperatorField *opfields = isinput ? op->inputfields : op->outputfields;
+  CeedQFunctionField *qffields = isinput ? op->qf->inputfields :
+                                 op->qf->outputfields;
+
+  *supported = true;
+  *rstr = NULL;
+  *basis = NULL;
+  *numemodes = 0;
+  *emodes = NULL;
+  for (CeedInt i=0; i<numfields; i++) {
+    if (opfields[i]->vec != CEED_VECTOR_ACTIVE)
+      continue;
+    if ((*rstr && *rstr != opfields[i]->Erestrict) ||
+        (*basis && *basis != opfields[i]->basis) ||
+        opfields[i]->basis == CEED_BASIS_COLLOCATED) {
+      *supported = false;
+      return 0;
+    }
+    *rstr = opfields[i]->Erestrict;
+    *basis = opfields[i]->basis;
+    CeedInt dim;
+    ierr = CeedBasisGetDimension(*basis, &dim); CeedChk(ierr);
+    switch (qffields[i]->emode) {
+    case CEED_EVAL_NONE:
+    case CEED_EVAL_INTERP:
+      ierr = CeedRealloc(*numemodes + 1, emodes); CeedChk(ierr);
+      (*emodes)[*numemodes] = qffields[i]->emode;
+      *numemodes += 1;
+      break;
+    case CEED_EVAL_GRAD:
+      ierr = CeedRealloc(*numemodes + dim, emodes); CeedChk(ierr);
+      for (CeedInt d=0; d<dim; d++)
+        (*emodes)[*numemodes+d] = CEED_EVAL_GRAD;
+      *numemodes += dim;
+      break;
+    case CEED_EVAL_WEIGHT:
+    case CEED_EVAL_DIV:
+    case CEED_EVAL_CURL:
+      *supported = false;
+      return 0;
+    }
+  }
+  *supported = *supported && *rstr;
+
+  return 0;
+}
 
 /**
-  @brief Get the Ceed associated with a CeedOperator
+  @brief Check if a CeedOperator can be applied as an assembled CSR matrix
 
-  @param op              CeedOperator
-  @param[out] ceed       Variable to store Ceed
+  @param[in] op          CeedOperator to check
+  @param[out] supported  Variable to store support status
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
+  @ref Developer
 **/
+static int CeedOperatorCSRSupported(CeedOperator op, bool *supported) {
+  int ierr;
+
+  *supported = !op->composite && !op->qf->identity;
+  // Passive outputs are only produced by the matrix-free path
+  for (CeedInt i=0; i<op->qf->numoutputfields; i++)
+    if (op->outputfields[i]->vec != CEED_VECTOR_ACTIVE)
+      *supported = false;
+  if (!*supported)
+    return 0;
+
+  for (CeedInt side=0; side<2 && *supported; side++) {
+    CeedElemRestriction rstr;
+    CeedBasis basis;
+    CeedInt numemodes;
+    CeedEvalMode *emodes;
+    ierr = CeedOperatorGetActiveEvalModes(op, side == 0, supported, &rstr,
+                                          &basis, &numemodes, &emodes);
+    CeedChk(ierr);
+    ierr = CeedFree(&emodes); CeedChk(ierr);
+    if (!*supported)
+      break;
+    // L-vector indices must be known on the host
+    if (rstr->strides) {
+      bool backendstrides;
+      ierr = CeedElemRestrictionHasBackendStrides(rstr, &backendstrides);
+      CeedChk(ierr);
+      *supported = !backendstrides;
+    } else {
+      *supported = rstr->GetOffsets;
+    }
+  }
 
-int CeedOperatorGetCeed(CeedOperator op, Ceed *ceed) {
-  *ceed = op->ceed;
   return 0;
 }
 
 /**
-  @brief Get the number of elements associated with a CeedOperator
+  @brief Get the L-vector index of every E-vector entry of a
+           CeedElemRestriction
 
-  @param op              CeedOperator
-  @param[out] numelem    Variable to store number of elements
+  @param[in] rstr      CeedElemRestriction
+  @param[out] indices  Array of indices, ordered as [element, component, node],
+                         to be freed by the caller
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
+  @ref Developer
 **/
+static int CeedOperatorGetRestrictionIndices(CeedElemRestriction rstr,
+    CeedInt **indices) {
+  int ierr;
+  CeedInt nelem, elemsize, ncomp;
+  ierr = CeedElemRestrictionGetNumElements(rstr, &nelem); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetElementSize(rstr, &elemsize); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetNumComponents(rstr, &ncomp); CeedChk(ierr);
+  ierr = CeedMalloc(nelem*ncomp*elemsize, indices); CeedChk(ierr);
+
+  if (rstr->strides) {
+    CeedInt strides[3];
+    ierr = CeedElemRestrictionGetStrides(rstr, &strides); CeedChk(ierr);
+    for (CeedInt e=0; e<nelem; e++)
+      for (CeedInt c=0; c<ncomp; c++)
+        for (CeedInt n=0; n<elemsize; n++)
+          (*indices)[(e*ncomp+c)*elemsize+n] = n*strides[0] + c*strides[1] +
+                                               e*strides[2];
+  } else {
+    CeedInt compstride;
+    const CeedInt *offsets;
+    ierr = CeedElemRestrictionGetCompStride(rstr, &compstride); CeedChk(ierr);
+    ierr = CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets);
+    CeedChk(ierr);
+    for (CeedInt e=0; e<nelem; e++)
+      for (CeedInt c=0; c<ncomp; c++)
+        for (CeedInt n=0; n<elemsize; n++)
+          (*indices)[(e*ncomp+c)*elemsize+n] = offsets[e*elemsize+n] +
+                                               c*compstride;
+    ierr = CeedElemRestrictionRestoreOffsets(rstr, &offsets); CeedChk(ierr);
+  }
 
-int CeedOperatorGetNumElements(CeedOperator op, CeedInt *numelem) {
-  if (op->composite)
-    // LCOV_EXCL_START
-    return CeedError(op->ceed, 1, "Not defined for composite operator");
-  // LCOV_EXCL_STOP
-
-  *numelem = op->numelements;
   return 0;
 }
 
 /**
-  @brief Get the number of quadrature points associated with a CeedOperator
+  @brief Free the assembled CSR matrix of a CeedOperator
 
-  @param op              CeedOperator
-  @param[out] numqpts    Variable to store vector number of quadrature points
+  @param[in] op  CeedOperator
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
+  @ref Developer
 **/
+static int CeedOperatorDestroyCSR(CeedOperator op) {
+  int ierr;
 
-int CeedOperatorGetNumQuadraturePoints(CeedOperator op, CeedInt *numqpts) {
-  if (op->composite)
-    // LCOV_EXCL_START
-    return CeedError(op->ceed, 1, "Not defined for composite operator");
-  // LCOV_EXCL_STOP
+  op->csrnrows = 0;
+  op->csrncols = 0;
+  ierr = CeedFree(&op->csrrowptr); CeedChk(ierr);
+  ierr = CeedFree(&op->csrcolind); CeedChk(ierr);
+  ierr = CeedFree(&op->csrvals); CeedChk(ierr);
+  ierr = CeedFree(&op->csrinputstate); CeedChk(ierr);
 
-  *numqpts = op->numqpoints;
   return 0;
 }
 
 /**
-  @brief Get the number of arguments associated with a CeedOperator
+  @brief Assemble the local action of a CeedOperator as a CSR matrix
 
-  @param op              CeedOperator
-  @param[out] numargs    Variable to store vector number of arguments
+  The element matrices B_out^T D B_in are computed from the assembled
+    QFunction and summed into a matrix mapping the active input L-vector to the
+    active output L-vector. Duplicate entries are merged and the columns of each
+    row are sorted.
+
+  @param op       CeedOperator to assemble
+  @param request  Address of CeedRequest for non-blocking completion, else
+                    @ref CEED_REQUEST_IMMEDIATE
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
+  @ref Developer
 **/
+static int CeedOperatorAssembleCSR(CeedOperator op, CeedRequest *request) {
+  int ierr;
+  bool supported;
+  CeedTraceSample start;
+  CeedTraceStart(NULL, &start);
+
+  ierr = CeedOperatorDestroyCSR(op); CeedChk(ierr);
+
+  // Active restrictions, bases, and evaluation modes
+  CeedElemRestriction rstrin, rstrout;
+  CeedBasis basisin, basisout;
+  CeedInt numemodein, numemodeout;
+  CeedEvalMode *emodein, *emodeout;
+  ierr = CeedOperatorGetActiveEvalModes(op, true, &supported, &rstrin,
+                                        &basisin, &numemodein, &emodein);
+  CeedChk(ierr);
+  ierr = CeedOperatorGetActiveEvalModes(op, false, &supported, &rstrout,
+                                        &basisout, &numemodeout, &emodeout);
+  CeedChk(ierr);
 
-int CeedOperatorGetNumArgs(CeedOperator op, CeedInt *numargs) {
-  if (op->composite)
-    // LCOV_EXCL_START
-    return CeedError(op->ceed, 1, "Not defined for composite operators");
-  // LCOV_EXCL_STOP
+  // Assemble QFunction and view it as an E-vector
+  CeedVector assembledqf, elemqf;
+  CeedElemRestriction rstrqf;
+  CeedInt layout[3];
+  ierr = CeedOperatorLinearAssembleQFunction(op, &assembledqf, &rstrqf,
+         request); CeedChk(ierr);
+  ierr = CeedElemRestrictionCreateVector(rstrqf, NULL, &elemqf); CeedChk(ierr);
+  ierr = CeedElemRestrictionApply(rstrqf, CEED_NOTRANSPOSE, assembledqf, elemqf,
+                                  request); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetELayout(rstrqf, &layout); CeedChk(ierr);
+
+  // Sizes
+  CeedInt nelem = op->numelements, nqpts, ncompin, ncompout, nnodesin,
+          nnodesout, nrows, ncols;
+  ierr = CeedBasisGetNumQuadraturePoints(basisin, &nqpts); CeedChk(ierr);
+  ierr = CeedBasisGetNumComponents(basisin, &ncompin); CeedChk(ierr);
+  ierr = CeedBasisGetNumComponents(basisout, &ncompout); CeedChk(ierr);
+  ierr = CeedBasisGetNumNodes(basisin, &nnodesin); CeedChk(ierr);
+  ierr = CeedBasisGetNumNodes(basisout, &nnodesout); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetLVectorSize(rstrin, &ncols); CeedChk(ierr);
+  ierr = CeedElemRestrictionGetLVectorSize(rstrout, &nrows); CeedChk(ierr);
+  const CeedInt elemrows = ncompout*nnodesout, elemcols = ncompin*nnodesin;
+
+  // L-vector indices
+  CeedInt *indin, *indout;
+  ierr = CeedOperatorGetRestrictionIndices(rstrin, &indin); CeedChk(ierr);
+  ierr = CeedOperatorGetRestrictionIndices(rstrout, &indout); CeedChk(ierr);
+
+  // Count entries per row, before merging duplicates
+  CeedInt *rowptr, *cursor, *colind;
+  CeedScalar *vals;
+  ierr = CeedCalloc(nrows + 1, &rowptr); CeedChk(ierr);
+  for (CeedInt i=0; i<nelem*elemrows; i++)
+    rowptr[indout[i] + 1] += elemcols;
+  for (CeedInt i=0; i<nrows; i++)
+    rowptr[i+1] += rowptr[i];
+  ierr = CeedMalloc(rowptr[nrows], &colind); CeedChk(ierr);
+  ierr = CeedMalloc(rowptr[nrows], &vals); CeedChk(ierr);
+  ierr = CeedMalloc(nrows, &cursor); CeedChk(ierr);
+  memcpy(cursor, rowptr, nrows*sizeof(cursor[0]));
+
+  // Basis matrices
+  const CeedScalar *interpin, *interpout, *gradin, *gradout;
+  CeedScalar *identityin, *identityout;
+  ierr = CeedBasisGetInterp(basisin, &interpin); CeedChk(ierr);
+  ierr = CeedBasisGetInterp(basisout, &interpout); CeedChk(ierr);
+  ierr = CeedBasisGetGrad(basisin, &gradin); CeedChk(ierr);
+  ierr = CeedBasisGetGrad(basisout, &gradout); CeedChk(ierr);
+  ierr = CeedCalloc(nqpts*nnodesin, &identityin); CeedChk(ierr);
+  ierr = CeedCalloc(nqpts*nnodesout, &identityout); CeedChk(ierr);
+  for (CeedInt i=0; i<(nnodesin<nqpts?nnodesin:nqpts); i++)
+    identityin[i*nnodesin+i] = 1.0;
+  for (CeedInt i=0; i<(nnodesout<nqpts?nnodesout:nqpts); i++)
+    identityout[i*nnodesout+i] = 1.0;
+
+  // Element matrices B_out^T D B_in, scattered into the rows
+  const CeedScalar *qf;
+  CeedScalar *elemmat;
+  ierr = CeedMalloc(elemrows*elemcols, &elemmat); CeedChk(ierr);
+  ierr = CeedVectorGetArrayRead(elemqf, CEED_MEM_HOST, &qf); CeedChk(ierr);
+  for (CeedInt e=0; e<nelem; e++) {
+    for (CeedInt i=0; i<elemrows*elemcols; i++)
+      elemmat[i] = 0.0;
+    CeedInt dout = -1;
+    for (CeedInt eout=0; eout<numemodeout; eout++) {
+      const CeedScalar *bt = emodeout[eout] == CEED_EVAL_INTERP ? interpout :
+                             identityout;
+      if (emodeout[eout] == CEED_EVAL_GRAD) {
+        dout += 1;
+        bt = &gradout[dout*nqpts*nnodesout];
+      }
+      CeedInt din = -1;
+      for (CeedInt ein=0; ein<numemodein; ein++) {
+        const CeedScalar *b = emodein[ein] == CEED_EVAL_INTERP ? interpin :
+                              identityin;
+        if (emodein[ein] == CEED_EVAL_GRAD) {
+          din += 1;
+          b = &gradin[din*nqpts*nnodesin];
+        }
+        for (CeedInt compin=0; compin<ncompin; compin++)
+          for (CeedInt compout=0; compout<ncompout; compout++) {
+            const CeedInt qfcomp = ((ein*ncompin+compin)*numemodeout+eout)*
+                                   ncompout+compout;
+            for (CeedInt q=0; q<nqpts; q++) {
+              const CeedScalar qfvalue = qf[q*layout[0] + qfcomp*layout[1] +
+                                                e*layout[2]];
+              if (qfvalue == 0.0)
+                continue;
+              for (CeedInt i=0; i<nnodesout; i++) {
+                const CeedScalar btq = bt[q*nnodesout+i]*qfvalue;
+                CeedScalar *row = &elemmat[(compout*nnodesout+i)*elemcols +
+                                           compin*nnodesin];
+                for (CeedInt j=0; j<nnodesin; j++)
+                  row[j] += btq*b[q*nnodesin+j];
+              }
+            }
+          }
+      }
+    }
+    for (CeedInt i=0; i<elemrows; i++) {
+      const CeedInt row = indout[e*elemrows+i];
+      for (CeedInt j=0; j<elemcols; j++) {
+        colind[cursor[row]+j] = indin[e*elemcols+j];
+        vals[cursor[row]+j] = elemmat[i*elemcols+j];
+      }
+      cursor[row] += elemcols;
+    }
+  }
+  ierr = CeedVectorRestoreArrayRead(elemqf, &qf); CeedChk(ierr);
+
+  // Sort each row by column and merge duplicate entries
+  CeedInt nnz = 0;
+  for (CeedInt i=0; i<nrows; i++) {
+    const CeedInt start = rowptr[i], end = rowptr[i+1];
+    for (CeedInt k=start+1; k<end; k++) {
+      const CeedInt col = colind[k];
+      const CeedScalar val = vals[k];
+      CeedInt l = k;
+      for (; l>start && colind[l-1]>col; l--) {
+        colind[l] = colind[l-1];
+        vals[l] = vals[l-1];
+      }
+      colind[l] = col;
+      vals[l] = val;
+    }
+    rowptr[i] = nnz;
+    for (CeedInt k=start; k<end; k++) {
+      if (nnz > rowptr[i] && colind[nnz-1] == colind[k]) {
+        vals[nnz-1] += vals[k];
+      } else {
+        colind[nnz] = colind[k];
+        vals[nnz] = vals[k];
+        nnz++;
+      }
+    }
+  }
+  rowptr[nrows] = nnz;
+  ierr = CeedRealloc(nnz, &colind); CeedChk(ierr);
+  ierr = CeedRealloc(nnz, &vals); CeedChk(ierr);
+
+  op->csrnrows = nrows;
+  op->csrncols = ncols;
+  op->csrrowptr = rowptr;
+  op->csrcolind = colind;
+  op->csrvals = vals;
+
+  // Record passive input states to detect stale assembly
+  ierr = CeedCalloc(op->qf->numinputfields, &op->csrinputstate); CeedChk(ierr);
+  for (CeedInt i=0; i<op->qf->numinputfields; i++) {
+    CeedVector vec = op->inputfields[i]->vec;
+    if (vec != CEED_VECTOR_ACTIVE && vec != CEED_VECTOR_NONE) {
+      ierr = CeedVectorGetState(vec, &op->csrinputstate[i]); CeedChk(ierr);
+    }
+  }
+  if (op->qf->ctx) {
+    ierr = CeedQFunctionContextGetState(op->qf->ctx, &op->csrctxstate);
+    CeedChk(ierr);
+  }
+
+  // Cleanup
+  ierr = CeedFree(&elemmat); CeedChk(ierr);
+  ierr = CeedFree(&identityin); CeedChk(ierr);
+  ierr = CeedFree(&identityout); CeedChk(ierr);
+  ierr = CeedFree(&cursor); CeedChk(ierr);
+  ierr = CeedFree(&indin); CeedChk(ierr);
+  ierr = CeedFree(&indout); CeedChk(ierr);
+  ierr = CeedFree(&emodein); CeedChk(ierr);
+  ierr = CeedFree(&emodeout); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&assembledqf); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&elemqf); CeedChk(ierr);
+  ierr = CeedElemRestrictionDestroy(&rstrqf); CeedChk(ierr);
+
+  ierr = CeedOperatorTrace(op, CEED_TRACE_ASSEMBLY, __func__, &start);
+  CeedChk(ierr);
 
-  *numargs = op->nfields;
   return 0;
 }
 
 /**
-  @brief Get the setup status of a CeedOperator
+  @brief Check if the passive inputs of a CeedOperator changed since its CSR
+           matrix was assembled
 
-  @param op                CeedOperator
-  @param[out] issetupdone  Variable to store setup status
+  @param[in] op        CeedOperator
+  @param[out] isstale  Variable to store staleness of the assembled matrix
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
+  @ref Developer
 **/
+static int CeedOperatorCSRIsStale(CeedOperator op, bool *isstale) {
+  int ierr;
+  uint64_t state;
+
+  *isstale = !op->csrrowptr;
+  for (CeedInt i=0; i<op->qf->numinputfields && !*isstale; i++) {
+    CeedVector vec = op->inputfields[i]->vec;
+    if (vec != CEED_VECTOR_ACTIVE && vec != CEED_VECTOR_NONE) {
+      ierr = CeedVectorGetState(vec, &state); CeedChk(ierr);
+      *isstale = state != op->csrinputstate[i];
+    }
+  }
+  if (op->qf->ctx && !*isstale) {
+    ierr = CeedQFunctionContextGetState(op->qf->ctx, &state); CeedChk(ierr);
+    *isstale = state != op->csrctxstate;
+  }
 
-int CeedOperatorIsSetupDone(CeedOperator op, bool *issetupdone) {
-  *issetupdone = op->setupdone;
   return 0;
 }
 
 /**
-  @brief Get the QFunction associated with a CeedOperator
+  @brief Apply the assembled CSR matrix of a CeedOperator and add the result to
+           the output vector
 
-  @param op              CeedOperator
-  @param[out] qf         Variable to store QFunction
+  @param op        CeedOperator to apply
+  @param[in] in    CeedVector containing input state
+  @param[out] out  CeedVector to sum in result of applying operator
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
+  @ref Developer
 **/
-
-int CeedOperatorGetQFunction(CeedOperator op, CeedQFunction *qf) {
-  if (op->composite)
+static int CeedOperatorApplyAddCSR(CeedOperator op, CeedVector in,
+                                   CeedVector out) {
+  int ierr;
+  CeedInt inlength, outlength;
+  ierr = CeedVectorGetLength(in, &inlength); CeedChk(ierr);
+  ierr = CeedVectorGetLength(out, &outlength); CeedChk(ierr);
+  if (inlength != op->csrncols || outlength != op->csrnrows)
     // LCOV_EXCL_START
-    return CeedError(op->ceed, 1, "Not defined for composite operator");
+    return CeedError(op->ceed, 1, "Vector lengths %d and %d do not match "
+                     "assembled operator size %d x %d", inlength, outlength,
+                     op->csrnrows, op->csrncols);
   // LCOV_EXCL_STOP
 
-  *qf = op->qf;
+  const CeedInt *rowptr = op->csrrowptr, *colind = op->csrcolind;
+  const CeedScalar *vals = op->csrvals, *x;
+  CeedScalar *y;
+  ierr = CeedVectorGetArrayRead(in, CEED_MEM_HOST, &x); CeedChk(ierr);
+  ierr = CeedVectorGetArray(out, CEED_MEM_HOST, &y); CeedChk(ierr);
+  for (CeedInt i=0; i<op->csrnrows; i++) {
+    CeedScalar sum = 0.0;
+    for (CeedInt k=rowptr[i]; k<rowptr[i+1]; k++)
+      sum += vals[k]*x[colind[k]];
+    y[i] += sum;
+  }
+  ierr = CeedVectorRestoreArrayRead(in, &x); CeedChk(ierr);
+  ierr = CeedVectorRestoreArray(out, &y); CeedChk(ierr);
+
   return 0;
 }
 
 /**
-  @brief Get a boolean value indicating if the CeedOperator is composite
+  @brief Estimate the cost of applying a CeedOperator matrix-free and as an
+           assembled CSR matrix
 
-  @param op                CeedOperator
-  @param[out] iscomposite  Variable to store composite status
+  Both estimates are per element, in flops, using a roofline model with
+    @ref CEED_STRATEGY_FLOPS_PER_BYTE as machine balance. The CSR estimate
+    counts every entry of the element matrices, which bounds the number of
+    nonzeros from above.
+
+  @param[in] op        CeedOperator
+  @param[out] mfcost   Estimated matrix-free cost
+  @param[out] csrcost  Estimated assembled cost
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Backend
+  @ref Developer
 **/
+static int CeedOperatorEstimateStrategyCost(CeedOperator op, double *mfcost,
+    double *csrcost) {
+  int ierr;
+  bool supported;
+  double mfflops = 0, mfbytes = 0, elemrows = 1, elemcols = 1,
+         numactive[2] = {0, 0};
+  CeedInt nqpts = op->numqpoints;
+
+  for (CeedInt side=0; side<2; side++) {
+    CeedElemRestriction rstr;
+    CeedBasis basis;
+    CeedInt numemodes, ncomp, nnodes;
+    CeedEvalMode *emodes;
+    bool tensor;
+    ierr = CeedOperatorGetActiveEvalModes(op, side == 0, &supported, &rstr,
+                                          &basis, &numemodes, &emodes);
+    CeedChk(ierr);
+    ierr = CeedBasisGetNumComponents(basis, &ncomp); CeedChk(ierr);
+    ierr = CeedBasisGetNumNodes(basis, &nnodes); CeedChk(ierr);
+    ierr = CeedBasisIsTensor(basis, &tensor); CeedChk(ierr);
+    // Cost of one basis action for one evaluation mode
+    double basisflops = 2.0*ncomp*nnodes*nqpts;
+    if (tensor) {
+      CeedInt dim, P1d, Q1d;
+      ierr = CeedBasisGetDimension(basis, &dim); CeedChk(ierr);
+      ierr = CeedBasisGetNumNodes1D(basis, &P1d); CeedChk(ierr);
+      ierr = CeedBasisGetNumQuadraturePoints1D(basis, &Q1d); CeedChk(ierr);
+      basisflops = 2.0*ncomp*dim*pow(P1d > Q1d ? P1d : Q1d, dim + 1);
+    }
+    for (CeedInt i=0; i<numemodes; i++)
+      if (emodes[i] != CEED_EVAL_NONE)
+        mfflops += basisflops;
+    // Element values and restriction offsets
+    mfbytes += (sizeof(CeedScalar) + sizeof(CeedInt))*ncomp*nnodes;
+    numactive[side] = numemodes*ncomp;
+    if (side == 0)
+      elemcols = ncomp*nnodes;
+    else
+      elemrows = ncomp*nnodes;
+    ierr = CeedFree(&emodes); CeedChk(ierr);
+  }
+  // Linearized QFunction and passive inputs
+  mfflops += 2.0*numactive[0]*numactive[1]*nqpts;
+  for (CeedInt i=0; i<op->qf->numinputfields; i++) {
+    CeedVector vec = op->inputfields[i]->vec;
+    if (vec != CEED_VECTOR_ACTIVE && vec != CEED_VECTOR_NONE)
+      mfbytes += sizeof(CeedScalar)*op->qf->inputfields[i]->size*nqpts;
+  }
+
+  const double nnz = elemrows*elemcols;
+  const double csrflops = 2.0*nnz,
+               csrbytes = (sizeof(CeedScalar) + sizeof(CeedInt))*nnz;
+  *mfcost = fmax(mfflops, CEED_STRATEGY_FLOPS_PER_BYTE*mfbytes);
+  *csrcost = fmax(csrflops, CEED_STRATEGY_FLOPS_PER_BYTE*csrbytes);
 
-int CeedOperatorIsComposite(CeedOperator op, bool *iscomposite) {
-  *iscomposite = op->composite;
   return 0;
 }
 
 /**
-  @brief Get the number of suboperators associated with a CeedOperator
-
-  @param op              CeedOperator
-  @param[out] numsub     Variable to store number of suboperators
+  @brief Get the current time in seconds for strategy timing probes
 
-  @return An error code: 0 - success, otherwise - failure
+  @return Monotonic wall clock time, in seconds
 
-  @ref Backend
+  @ref Developer
+**/
+static double CeedOperatorStrategyTime(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1e-9*ts.tv_nsec;
+}
+
+/**
+  @brief Resolve the apply strategy of a CeedOperator at its first apply
+
+  For @ref CEED_STRATEGY_AUTO, the operator is applied matrix-free when the cost
+    estimate clearly favors it and assembled when the estimate clearly favors
+    the CSR matrix. Otherwise, both paths are timed on the given input and the
+    faster one is kept. In that case the result is summed into @a out here.
+
+  @param op            CeedOperator
+  @param[in] in        CeedVector containing input state
+  @param[out] out      CeedVector to sum in result of applying operator
+  @param request       Address of CeedRequest for non-blocking completion, else
+                         @ref CEED_REQUEST_IMMEDIATE
+  @param[out] applied  Variable to store whether @a out has been computed
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorSelectStrategy(CeedOperator op, CeedVector in,
+                                      CeedVector out, CeedRequest *request,
+                                      bool *applied) {
+  int ierr;
+  bool supported;
+
+  *applied = false;
+  op->useassembled = false;
+  op->probetime[0] = op->probetime[1] = 0.0;
+  ierr = CeedOperatorCSRSupported(op, &supported); CeedChk(ierr);
+  if (!supported && op->strategy == CEED_STRATEGY_ASSEMBLED)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "CeedOperator cannot be applied as an "
+                     "assembled CSR matrix");
+  // LCOV_EXCL_STOP
+  op->strategyset = true;
+  if (!supported)
+    return 0;
+
+  if (op->strategy == CEED_STRATEGY_ASSEMBLED) {
+    op->useassembled = true;
+    return 0;
+  }
+
+  // Cost estimate
+  double mfcost = 0.0, csrcost = 0.0;
+  ierr = CeedOperatorEstimateStrategyCost(op, &mfcost, &csrcost); CeedChk(ierr);
+  if (csrcost > CEED_STRATEGY_PROBE_RATIO*mfcost)
+    return 0;
+  if (CEED_STRATEGY_PROBE_RATIO*csrcost < mfcost) {
+    op->useassembled = true;
+    return 0;
+  }
+
+  // Timing probe; the first matrix-free apply includes backend setup
+  CeedVector probe;
+  ierr = op->ApplyAdd(op, in, out, request); CeedChk(ierr);
+  *applied = true;
+  ierr = CeedOperatorAssembleCSR(op, request); CeedChk(ierr);
+  ierr = CeedVectorCreate(op->ceed, op->csrnrows, &probe); CeedChk(ierr);
+  ierr = CeedVectorSetValue(probe, 0.0); CeedChk(ierr);
+  double t0 = CeedOperatorStrategyTime();
+  ierr = op->ApplyAdd(op, in, probe, request); CeedChk(ierr);
+  double t1 = CeedOperatorStrategyTime();
+  ierr = CeedOperatorApplyAddCSR(op, in, probe); CeedChk(ierr);
+  double t2 = CeedOperatorStrategyTime();
+  ierr = CeedVectorDestroy(&probe); CeedChk(ierr);
+  op->probetime[0] = t1 - t0;
+  op->probetime[1] = t2 - t1;
+  op->useassembled = op->probetime[1] < op->probetime[0];
+  if (!op->useassembled) {
+    ierr = CeedOperatorDestroyCSR(op); CeedChk(ierr);
+  }
+
+  return 0;
+}
+
+/**
+  @brief Check if the backend composite apply can be used for a composite
+           CeedOperator, which requires matrix-free sub-operators
+
+  @param op               Composite CeedOperator
+  @param[out] usebackend  Variable to store the result
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorUseApplyAddComposite(CeedOperator op,
+    bool *usebackend) {
+  *usebackend = !!op->ApplyAddComposite;
+  for (CeedInt i=0; i<op->numsub && *usebackend; i++)
+    *usebackend = op->suboperators[i]->strategy == CEED_STRATEGY_MATRIX_FREE;
+  return 0;
+}
+
+/**
+  @brief Apply a non-composite CeedOperator with its selected strategy and add
+           the result to the output vector
+
+  @param op        CeedOperator to apply
+  @param[in] in    CeedVector containing input state
+  @param[out] out  CeedVector to sum in result of applying operator
+  @param request   Address of CeedRequest for non-blocking completion, else
+                     @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorApplyAddStrategy(CeedOperator op, CeedVector in,
+                                        CeedVector out, CeedRequest *request) {
+  int ierr;
+
+  if (op->strategy == CEED_STRATEGY_MATRIX_FREE) {
+    ierr = op->ApplyAdd(op, in, out, request); CeedChk(ierr);
+    return 0;
+  }
+
+  if (!op->strategyset) {
+    bool applied;
+    ierr = CeedOperatorSelectStrategy(op, in, out, request, &applied);
+    CeedChk(ierr);
+    if (applied)
+      return 0;
+  }
+
+  if (op->useassembled) {
+    bool isstale;
+    ierr = CeedOperatorCSRIsStale(op, &isstale); CeedChk(ierr);
+    if (isstale) {
+      ierr = CeedOperatorAssembleCSR(op, request); CeedChk(ierr);
+    }
+    ierr = CeedOperatorApplyAddCSR(op, in, out); CeedChk(ierr);
+  } else {
+    ierr = op->ApplyAdd(op, in, out, request); CeedChk(ierr);
+  }
+
+  return 0;
+}
+
+/**
+  @brief Add an object to a list of objects already counted in memory usage
+
+  @param obj            Object to add
+  @param[in,out] seen   List of objects already counted
+  @param[in,out] nseen  Number of objects in the list
+  @param[out] isnew     Boolean flag, true if obj was not already in the list
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorMemorySeen(const void *obj, const void ***seen,
+                                  CeedInt *nseen, bool *isnew) {
+  int ierr;
+
+  for (CeedInt i=0; i<*nseen; i++) {
+    if ((*seen)[i] == obj) {
+      *isnew = false;
+      return 0;
+    }
+  }
+  ierr = CeedRealloc(*nseen + 1, seen); CeedChk(ierr);
+  (*seen)[(*nseen)++] = obj;
+  *isnew = true;
+  return 0;
+}
+
+/**
+  @brief Add the memory held by a CeedOperator to each category of usage
+
+  Sub-operators, restrictions, bases, and vectors shared between fields or
+    sub-operators are counted once.
+
+  @param op             CeedOperator
+  @param[in,out] usage  Array of CEED_MEMORY_TOTAL byte counts to add to
+  @param[in,out] seen   List of objects already counted
+  @param[in,out] nseen  Number of objects in the list
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorGetMemoryUsage_Core(CeedOperator op, size_t *usage,
+    const void ***seen, CeedInt *nseen) {
+  int ierr;
+  bool isnew;
+  size_t bytes;
+
+  ierr = CeedOperatorMemorySeen(op, seen, nseen, &isnew); CeedChk(ierr);
+  if (!isnew)
+    return 0;
+
+  // Sub-operators
+  for (CeedInt i=0; i<op->numsub; i++) {
+    ierr = CeedOperatorGetMemoryUsage_Core(op->suboperators[i], usage, seen,
+                                           nseen); CeedChk(ierr);
+  }
+
+  // Restrictions, bases, and passive vectors of fields
+  const CeedInt numinput = op->qf ? op->qf->numinputfields : 0;
+  const CeedInt numoutput = op->qf ? op->qf->numoutputfields : 0;
+  for (CeedInt i=0; i<numinput+numoutput; i++) {
+    CeedOperatorField field = i < numinput ? op->inputfields[i] :
+                              op->outputfields[i-numinput];
+    if (!field)
+      continue;
+    if (field->Erestrict != CEED_ELEMRESTRICTION_NONE) {
+      ierr = CeedOperatorMemorySeen(field->Erestrict, seen, nseen, &isnew);
+      CeedChk(ierr);
+      if (isnew) {
+        ierr = CeedElemRestrictionGetMemoryUsage(field->Erestrict, &bytes);
+        CeedChk(ierr);
+        usage[CEED_MEMORY_OFFSETS] += bytes;
+      }
+    }
+    if (field->basis != CEED_BASIS_COLLOCATED) {
+      ierr = CeedOperatorMemorySeen(field->basis, seen, nseen, &isnew);
+      CeedChk(ierr);
+      if (isnew) {
+        ierr = CeedBasisGetMemoryUsage(field->basis, &bytes); CeedChk(ierr);
+        usage[CEED_MEMORY_BASIS] += bytes;
+      }
+    }
+    if (field->vec != CEED_VECTOR_ACTIVE && field->vec != CEED_VECTOR_NONE) {
+      ierr = CeedOperatorMemorySeen(field->vec, seen, nseen, &isnew);
+      CeedChk(ierr);
+      if (isnew) {
+        ierr = CeedVectorGetMemoryUsage(field->vec, &bytes); CeedChk(ierr);
+        usage[CEED_MEMORY_PASSIVE] += bytes;
+      }
+    }
+  }
+
+  // Backend work arrays
+  if (op->GetMemoryUsage) {
+    ierr = op->GetMemoryUsage(op, usage); CeedChk(ierr);
+  }
+
+  // Assembled CSR matrix and scaled apply work vector
+  if (op->csrrowptr) {
+    const size_t nnz = op->csrrowptr[op->csrnrows];
+    usage[CEED_MEMORY_ASSEMBLED] += (op->csrnrows + 1 + nnz)*sizeof(CeedInt) +
+                                    nnz*sizeof(CeedScalar);
+  }
+  if (op->scaledwork) {
+    ierr = CeedVectorGetMemoryUsage(op->scaledwork, &bytes); CeedChk(ierr);
+    usage[CEED_MEMORY_LVEC] += bytes;
+  }
+
+  // Work arrays of the fallback operator, which shares the fields of op
+  if (op->opfallback && op->opfallback->GetMemoryUsage) {
+    size_t fallback[CEED_MEMORY_TOTAL] = {0};
+    ierr = op->opfallback->GetMemoryUsage(op->opfallback, fallback);
+    CeedChk(ierr);
+    for (CeedInt i=0; i<CEED_MEMORY_TOTAL; i++)
+      usage[CEED_MEMORY_FALLBACK] += fallback[i];
+  }
+
+  return 0;
+}
+
+/// @}
+
+/// ----------------------------------------------------------------------------
+/// CeedOperator Backend API
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedOperatorBackend
+/// @{
+
+/**
+  @brief Get the Ceed associated with a CeedOperator
+
+  @param op              CeedOperator
+  @param[out] ceed       Variable to store Ceed
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedOperatorGetCeed(CeedOperator op, Ceed *ceed) {
+  *ceed = op->ceed;
+  return 0;
+}
+
+/**
+  @brief Get the number of elements associated with a CeedOperator
+
+  @param op              CeedOperator
+  @param[out] numelem    Variable to store number of elements
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedOperatorGetNumElements(CeedOperator op, CeedInt *numelem) {
+  if (op->composite)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Not defined for composite operator");
+  // LCOV_EXCL_STOP
+
+  *numelem = op->numelements;
+  return 0;
+}
+
+/**
+  @brief Get the number of quadrature points associated with a CeedOperator
+
+  @param op              CeedOperator
+  @param[out] numqpts    Variable to store vector number of quadrature points
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedOperatorGetNumQuadraturePoints(CeedOperator op, CeedInt *numqpts) {
+  if (op->composite)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Not defined for composite operator");
+  // LCOV_EXCL_STOP
+
+  *numqpts = op->numqpoints;
+  return 0;
+}
+
+/**
+  @brief Get the number of arguments associated with a CeedOperator
+
+  @param op              CeedOperator
+  @param[out] numargs    Variable to store vector number of arguments
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedOperatorGetNumArgs(CeedOperator op, CeedInt *numargs) {
+  if (op->composite)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Not defined for composite operators");
+  // LCOV_EXCL_STOP
+
+  *numargs = op->nfields;
+  return 0;
+}
+
+/**
+  @brief Get the number of elements per batch requested for a CeedOperator
+
+  @param op              CeedOperator
+  @param[out] batchsize  Variable to store the batch size, or 0 if none was
+                           requested with CeedOperatorSetBatchSize()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorGetBatchSize(CeedOperator op, CeedInt *batchsize) {
+  *batchsize = op->batchsize;
+  return 0;
+}
+
+/**
+  @brief Get the name of a CeedOperator
+
+  @param op          CeedOperator
+  @param[out] name   Variable to store the name, or NULL if none was set with
+                       CeedOperatorSetName()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorGetName(CeedOperator op, const char **name) {
+  *name = op->name;
+  return 0;
+}
+
+/**
+  @brief Get the setup status of a CeedOperator
+
+  @param op                CeedOperator
+  @param[out] issetupdone  Variable to store setup status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedOperatorIsSetupDone(CeedOperator op, bool *issetupdone) {
+  *issetupdone = op->setupdone;
+  return 0;
+}
+
+/**
+  @brief Get the QFunction associated with a CeedOperator
+
+  @param op              CeedOperator
+  @param[out] qf         Variable to store QFunction
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedOperatorGetQFunction(CeedOperator op, CeedQFunction *qf) {
+  if (op->composite)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Not defined for composite operator");
+  // LCOV_EXCL_STOP
+
+  *qf = op->qf;
+  return 0;
+}
+
+/**
+  @brief Get a boolean value indicating if the CeedOperator is composite
+
+  @param op                CeedOperator
+  @param[out] iscomposite  Variable to store composite status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+
+int CeedOperatorIsComposite(CeedOperator op, bool *iscomposite) {
+  *iscomposite = op->composite;
+  return 0;
+}
+
+/**
+  @brief Get the number of suboperators associated with a CeedOperator
+
+  @param op              CeedOperator
+  @param[out] numsub     Variable to store number of suboperators
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
 **/
 
 int CeedOperatorGetNumSub(CeedOperator op, CeedInt *numsub) {
@@ -687,6 +1775,125 @@ int CeedOperatorFieldGetVector(CeedOperatorField opfield, CeedVector *vec) {
   return 0;
 }
 
+/**
+  @brief Get the storage precision of a CeedOperatorField
+
+  @param opfield         CeedOperatorField
+  @param[out] precision  Variable to store the storage precision
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorFieldGetPrecision(CeedOperatorField opfield,
+                                  CeedFieldPrecision *precision) {
+  *precision = opfield->precision;
+  return 0;
+}
+
+/**
+  @brief Get the size in bytes of one value stored with a CeedFieldPrecision
+
+  @param precision  CeedFieldPrecision
+  @param[out] size  Variable to store the size in bytes
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedFieldPrecisionGetSize(CeedFieldPrecision precision, size_t *size) {
+  switch (precision) {
+  case CEED_PRECISION_SCALAR:
+    *size = sizeof(CeedScalar);
+    break;
+  case CEED_PRECISION_FP32:
+    *size = sizeof(float);
+    break;
+  case CEED_PRECISION_BF16:
+    *size = sizeof(uint16_t);
+    break;
+  }
+  return 0;
+}
+
+/**
+  @brief Convert an array of CeedScalar to a storage precision
+
+  Values are rounded to nearest, with ties to even.
+
+  @param precision  CeedFieldPrecision of the output
+  @param n          Number of values
+  @param in         Array of n CeedScalar values
+  @param[out] out   Array to store n values with the given precision
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedFieldPrecisionPack(CeedFieldPrecision precision, CeedInt n,
+                           const CeedScalar *in, void *out) {
+  switch (precision) {
+  case CEED_PRECISION_SCALAR:
+    memcpy(out, in, n*sizeof(CeedScalar));
+    break;
+  case CEED_PRECISION_FP32: {
+    float *o = out;
+    for (CeedInt i=0; i<n; i++)
+      o[i] = in[i];
+  } break;
+  case CEED_PRECISION_BF16: {
+    uint16_t *o = out;
+    for (CeedInt i=0; i<n; i++) {
+      const float f = in[i];
+      uint32_t bits;
+      memcpy(&bits, &f, sizeof(bits));
+      if (f != f) // Keep NaN a NaN after truncation
+        bits |= 0x00400000;
+      else
+        bits += 0x7FFF + ((bits >> 16) & 1);
+      o[i] = bits >> 16;
+    }
+  } break;
+  }
+  return 0;
+}
+
+/**
+  @brief Convert an array in a storage precision to CeedScalar
+
+  @param precision  CeedFieldPrecision of the input
+  @param n          Number of values
+  @param in         Array of n values with the given precision
+  @param[out] out   Array to store n CeedScalar values
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedFieldPrecisionUnpack(CeedFieldPrecision precision, CeedInt n,
+                             const void *in, CeedScalar *out) {
+  switch (precision) {
+  case CEED_PRECISION_SCALAR:
+    memcpy(out, in, n*sizeof(CeedScalar));
+    break;
+  case CEED_PRECISION_FP32: {
+    const float *x = in;
+    for (CeedInt i=0; i<n; i++)
+      out[i] = x[i];
+  } break;
+  case CEED_PRECISION_BF16: {
+    const uint16_t *x = in;
+    for (CeedInt i=0; i<n; i++) {
+      const uint32_t bits = (uint32_t)x[i] << 16;
+      float f;
+      memcpy(&f, &bits, sizeof(f));
+      out[i] = f;
+    }
+  } break;
+  }
+  return 0;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -736,17 +1943,17 @@ int CeedOperatorCreate(Ceed ceed, CeedQFunction qf, CeedQFunction dqf,
   // LCOV_EXCL_STOP
   ierr = CeedCalloc(1, op); CeedChk(ierr);
   (*op)->ceed = ceed;
-  ceed->refcount++;
+  CeedAtomicAdd(ceed->refcount, 1);
   (*op)->refcount = 1;
   (*op)->qf = qf;
-  qf->refcount++;
+  CeedAtomicAdd(qf->refcount, 1);
   if (dqf && dqf != CEED_QFUNCTION_NONE) {
     (*op)->dqf = dqf;
-    dqf->refcount++;
+    CeedAtomicAdd(dqf->refcount, 1);
   }
   if (dqfT && dqfT != CEED_QFUNCTION_NONE) {
     (*op)->dqfT = dqfT;
-    dqfT->refcount++;
+    CeedAtomicAdd(dqfT->refcount, 1);
   }
   ierr = CeedCalloc(16, &(*op)->inputfields); CeedChk(ierr);
   ierr = CeedCalloc(16, &(*op)->outputfields); CeedChk(ierr);
@@ -757,6 +1964,11 @@ int CeedOperatorCreate(Ceed ceed, CeedQFunction qf, CeedQFunction dqf,
 /**
   @brief Create an operator that composes the action of several operators
 
+  On /cpu/self/ref/serial and /cpu/self/memcheck/serial, sub-operators whose
+    active fields all use the same CeedElemRestriction share one restriction
+    of the active input and one transpose restriction of the active output
+    per element. Other backends apply each sub-operator separately.
+
   @param ceed    A Ceed object where the CeedOperator will be created
   @param[out] op Address of the variable where the newly created
                      Composite CeedOperator will be stored
@@ -780,7 +1992,8 @@ int CeedCompositeOperatorCreate(Ceed ceed, CeedOperator *op) {
 
   ierr = CeedCalloc(1, op); CeedChk(ierr);
   (*op)->ceed = ceed;
-  ceed->refcount++;
+  CeedAtomicAdd(ceed->refcount, 1);
+  (*op)->refcount = 1;
   (*op)->composite = true;
   ierr = CeedCalloc(16, &(*op)->suboperators); CeedChk(ierr);
 
@@ -892,13 +2105,13 @@ found:
   // LCOV_EXCL_STOP
   ierr = CeedCalloc(1, ofield); CeedChk(ierr);
   (*ofield)->Erestrict = r;
-  r->refcount += 1;
+  CeedAtomicAdd(r->refcount, 1);
   (*ofield)->basis = b;
   if (b != CEED_BASIS_COLLOCATED)
-    b->refcount += 1;
+    CeedAtomicAdd(b->refcount, 1);
   (*ofield)->vec = v;
   if (v != CEED_VECTOR_ACTIVE && v != CEED_VECTOR_NONE)
-    v->refcount += 1;
+    CeedAtomicAdd(v->refcount, 1);
   op->nfields += 1;
 
   size_t len = strlen(fieldname);
@@ -932,7 +2145,7 @@ int CeedCompositeOperatorAddSub(CeedOperator compositeop, CeedOperator subop) {
   // LCOV_EXCL_STOP
 
   compositeop->suboperators[compositeop->numsub] = subop;
-  subop->refcount++;
+  CeedAtomicAdd(subop->refcount, 1);
   compositeop->numsub++;
   return 0;
 }
@@ -970,6 +2183,8 @@ int CeedOperatorLinearAssembleQFunction(CeedOperator op, CeedVector *assembled,
   int ierr;
   Ceed ceed = op->ceed;
   ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+  CeedTraceSample start;
+  CeedTraceStart(NULL, &start);
 
   // Backend version
   if (op->LinearAssembleQFunction) {
@@ -985,6 +2200,9 @@ int CeedOperatorLinearAssembleQFunction(CeedOperator op, CeedVector *assembled,
            rstr, request); CeedChk(ierr);
   }
 
+  ierr = CeedOperatorTrace(op, CEED_TRACE_ASSEMBLY, __func__, &start);
+  CeedChk(ierr);
+
   return 0;
 }
 
@@ -1010,13 +2228,16 @@ int CeedOperatorLinearAssembleDiagonal(CeedOperator op, CeedVector assembled,
   int ierr;
   Ceed ceed = op->ceed;
   ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+  CeedTraceSample start;
+  CeedTraceStart(NULL, &start);
 
   // Use backend version, if available
   if (op->LinearAssembleDiagonal) {
     ierr = op->LinearAssembleDiagonal(op, assembled, request); CeedChk(ierr);
   } else if (op->LinearAssembleAddDiagonal) {
     ierr = CeedVectorSetValue(assembled, 0.0); CeedChk(ierr);
-    return CeedOperatorLinearAssembleAddDiagonal(op, assembled, request);
+    ierr = CeedOperatorLinearAssembleAddDiagonal(op, assembled, request);
+    CeedChk(ierr);
   } else {
     // Fallback to reference Ceed
     if (!op->opfallback) {
@@ -1028,10 +2249,14 @@ int CeedOperatorLinearAssembleDiagonal(CeedOperator op, CeedVector assembled,
              request); CeedChk(ierr);
     } else {
       ierr = CeedVectorSetValue(assembled, 0.0); CeedChk(ierr);
-      return CeedOperatorLinearAssembleAddDiagonal(op, assembled, request);
+      ierr = CeedOperatorLinearAssembleAddDiagonal(op, assembled, request);
+      CeedChk(ierr);
     }
   }
 
+  ierr = CeedOperatorTrace(op, CEED_TRACE_ASSEMBLY, __func__, &start);
+  CeedChk(ierr);
+
   return 0;
 }
 
@@ -1057,6 +2282,8 @@ int CeedOperatorLinearAssembleAddDiagonal(CeedOperator op, CeedVector assembled,
   int ierr;
   Ceed ceed = op->ceed;
   ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+  CeedTraceSample start;
+  CeedTraceStart(NULL, &start);
 
   // Use backend version, if available
   if (op->LinearAssembleAddDiagonal) {
@@ -1072,6 +2299,9 @@ int CeedOperatorLinearAssembleAddDiagonal(CeedOperator op, CeedVector assembled,
            request); CeedChk(ierr);
   }
 
+  ierr = CeedOperatorTrace(op, CEED_TRACE_ASSEMBLY, __func__, &start);
+  CeedChk(ierr);
+
   return 0;
 }
 
@@ -1103,6 +2333,8 @@ int CeedOperatorLinearAssemblePointBlockDiagonal(CeedOperator op,
   int ierr;
   Ceed ceed = op->ceed;
   ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+  CeedTraceSample start;
+  CeedTraceStart(NULL, &start);
 
   // Use backend version, if available
   if (op->LinearAssemblePointBlockDiagonal) {
@@ -1110,8 +2342,8 @@ int CeedOperatorLinearAssemblePointBlockDiagonal(CeedOperator op,
     CeedChk(ierr);
   } else if (op->LinearAssembleAddPointBlockDiagonal) {
     ierr = CeedVectorSetValue(assembled, 0.0); CeedChk(ierr);
-    return CeedOperatorLinearAssembleAddPointBlockDiagonal(op, assembled,
-           request);
+    ierr = CeedOperatorLinearAssembleAddPointBlockDiagonal(op, assembled,
+           request); CeedChk(ierr);
   } else {
     // Fallback to reference Ceed
     if (!op->opfallback) {
@@ -1123,11 +2355,14 @@ int CeedOperatorLinearAssemblePointBlockDiagonal(CeedOperator op,
              assembled, request); CeedChk(ierr);
     } else {
       ierr = CeedVectorSetValue(assembled, 0.0); CeedChk(ierr);
-      return CeedOperatorLinearAssembleAddPointBlockDiagonal(op, assembled,
-             request);
+      ierr = CeedOperatorLinearAssembleAddPointBlockDiagonal(op, assembled,
+             request); CeedChk(ierr);
     }
   }
 
+  ierr = CeedOperatorTrace(op, CEED_TRACE_ASSEMBLY, __func__, &start);
+  CeedChk(ierr);
+
   return 0;
 }
 
@@ -1159,6 +2394,8 @@ int CeedOperatorLinearAssembleAddPointBlockDiagonal(CeedOperator op,
   int ierr;
   Ceed ceed = op->ceed;
   ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+  CeedTraceSample start;
+  CeedTraceStart(NULL, &start);
 
   // Use backend version, if available
   if (op->LinearAssembleAddPointBlockDiagonal) {
@@ -1174,36 +2411,36 @@ int CeedOperatorLinearAssembleAddPointBlockDiagonal(CeedOperator op,
            assembled, request); CeedChk(ierr);
   }
 
+  ierr = CeedOperatorTrace(op, CEED_TRACE_ASSEMBLY, __func__, &start);
+  CeedChk(ierr);
+
   return 0;
 }
 
 /**
-  @brief Create a multigrid coarse operator and level transfer operators
-           for a CeedOperator, creating the prolongation basis from the
-           fine and coarse grid interpolation
+  @brief Compute the coarse to fine interpolation matrix for multigrid level
+           transfer by projecting the coarse grid basis onto the fine grid
+           basis
 
   @param[in] opFine       Fine grid operator
-  @param[in] PMultFine    L-vector multiplicity in parallel gather/scatter
-  @param[in] rstrCoarse   Coarse grid restriction
   @param[in] basisCoarse  Coarse grid active vector basis
-  @param[out] opCoarse    Coarse grid operator
-  @param[out] opProlong   Coarse to fine operator
-  @param[out] opRestrict  Fine to coarse operator
+  @param[out] interpCtoF  Matrix for coarse to fine interpolation, to be freed
+                            by the caller
+  @param[out] isTensor    Variable to store whether the bases are tensor bases
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref User
+  @ref Developer
 **/
-int CeedOperatorMultigridLevelCreate(CeedOperator opFine, CeedVector PMultFine,
-                                     CeedElemRestriction rstrCoarse, CeedBasis basisCoarse,
-                                     CeedOperator *opCoarse, CeedOperator *opProlong, CeedOperator *opRestrict) {
+static int CeedOperatorMultigridInterpCtoF(CeedOperator opFine,
+    CeedBasis basisCoarse, CeedScalar **interpCtoF, bool *isTensor) {
   int ierr;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(opFine, &ceed); CeedChk(ierr);
 
   // Check for compatible quadrature spaces
   CeedBasis basisFine;
-  ierr = CeedOperatorGetActiveBasis(opFine, &basisFine); CeedChk(ierr);
+  ierr = CeedOperatorGetActiveBasis(opFine, NULL, &basisFine); CeedChk(ierr);
   CeedInt Qf, Qc;
   ierr = CeedBasisGetNumQuadraturePoints(basisFine, &Qf); CeedChk(ierr);
   ierr = CeedBasisGetNumQuadraturePoints(basisCoarse, &Qc); CeedChk(ierr);
@@ -1217,7 +2454,7 @@ int CeedOperatorMultigridLevelCreate(CeedOperator opFine, CeedVector PMultFine,
   bool isTensorF, isTensorC;
   ierr = CeedBasisIsTensor(basisFine, &isTensorF); CeedChk(ierr);
   ierr = CeedBasisIsTensor(basisCoarse, &isTensorC); CeedChk(ierr);
-  CeedScalar *interpC, *interpF, *interpCtoF, *tau;
+  CeedScalar *interpC, *interpF, *tau;
   if (isTensorF && isTensorC) {
     ierr = CeedBasisGetNumNodes1D(basisFine, &Pf); CeedChk(ierr);
     ierr = CeedBasisGetNumNodes1D(basisCoarse, &Pc); CeedChk(ierr);
@@ -1230,10 +2467,11 @@ int CeedOperatorMultigridLevelCreate(CeedOperator opFine, CeedVector PMultFine,
     return CeedError(ceed, 1, "Bases must both be tensor or non-tensor");
     // LCOV_EXCL_STOP
   }
+  *isTensor = isTensorF;
 
   ierr = CeedMalloc(Q*Pf, &interpF); CeedChk(ierr);
   ierr = CeedMalloc(Q*Pc, &interpC); CeedChk(ierr);
-  ierr = CeedCalloc(Pc*Pf, &interpCtoF); CeedChk(ierr);
+  ierr = CeedCalloc(Pc*Pf, interpCtoF); CeedChk(ierr);
   ierr = CeedMalloc(Q, &tau); CeedChk(ierr);
   if (isTensorF) {
     memcpy(interpF, basisFine->interp1d, Q*Pf*sizeof basisFine->interp1d[0]);
@@ -1252,62 +2490,45 @@ int CeedOperatorMultigridLevelCreate(CeedOperator opFine, CeedVector PMultFine,
 
   // -- Apply Rinv, interpCtoF = Rinv interpC
   for (CeedInt j=0; j<Pc; j++) { // Column j
-    interpCtoF[j+Pc*(Pf-1)] = interpC[j+Pc*(Pf-1)]/interpF[Pf*Pf-1];
+    (*interpCtoF)[j+Pc*(Pf-1)] = interpC[j+Pc*(Pf-1)]/interpF[Pf*Pf-1];
     for (CeedInt i=Pf-2; i>=0; i--) { // Row i
-      interpCtoF[j+Pc*i] = interpC[j+Pc*i];
+      (*interpCtoF)[j+Pc*i] = interpC[j+Pc*i];
       for (CeedInt k=i+1; k<Pf; k++)
-        interpCtoF[j+Pc*i] -= interpF[k+Pf*i]*interpCtoF[j+Pc*k];
-      interpCtoF[j+Pc*i] /= interpF[i+Pf*i];
+        (*interpCtoF)[j+Pc*i] -= interpF[k+Pf*i]*(*interpCtoF)[j+Pc*k];
+      (*interpCtoF)[j+Pc*i] /= interpF[i+Pf*i];
     }
   }
   ierr = CeedFree(&tau); CeedChk(ierr);
   ierr = CeedFree(&interpC); CeedChk(ierr);
   ierr = CeedFree(&interpF); CeedChk(ierr);
 
-  // Fallback to interpCtoF versions of code
-  if (isTensorF) {
-    ierr = CeedOperatorMultigridLevelCreateTensorH1(opFine, PMultFine,
-           rstrCoarse, basisCoarse, interpCtoF, opCoarse, opProlong, opRestrict);
-    CeedChk(ierr);
-  } else {
-    ierr = CeedOperatorMultigridLevelCreateH1(opFine, PMultFine,
-           rstrCoarse, basisCoarse, interpCtoF, opCoarse, opProlong, opRestrict);
-    CeedChk(ierr);
-  }
-
-  // Cleanup
-  ierr = CeedFree(&interpCtoF); CeedChk(ierr);
   return 0;
 }
 
 /**
-  @brief Create a multigrid coarse operator and level transfer operators
-           for a CeedOperator with a tensor basis for the active basis
+  @brief Create the coarse to fine interpolation basis for a CeedOperator with
+           a tensor basis for the active vector
 
   @param[in] opFine       Fine grid operator
-  @param[in] PMultFine    L-vector multiplicity in parallel gather/scatter
   @param[in] rstrCoarse   Coarse grid restriction
   @param[in] basisCoarse  Coarse grid active vector basis
   @param[in] interpCtoF   Matrix for coarse to fine interpolation
-  @param[out] opCoarse    Coarse grid operator
-  @param[out] opProlong   Coarse to fine operator
-  @param[out] opRestrict  Fine to coarse operator
+  @param[out] basisCtoF   Basis for coarse to fine interpolation
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref User
+  @ref Developer
 **/
-int CeedOperatorMultigridLevelCreateTensorH1(CeedOperator opFine,
-    CeedVector PMultFine, CeedElemRestriction rstrCoarse, CeedBasis basisCoarse,
-    const CeedScalar *interpCtoF, CeedOperator *opCoarse,
-    CeedOperator *opProlong, CeedOperator *opRestrict) {
+static int CeedOperatorMultigridBasisCtoFTensorH1(CeedOperator opFine,
+    CeedElemRestriction rstrCoarse, CeedBasis basisCoarse,
+    const CeedScalar *interpCtoF, CeedBasis *basisCtoF) {
   int ierr;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(opFine, &ceed); CeedChk(ierr);
 
   // Check for compatible quadrature spaces
   CeedBasis basisFine;
-  ierr = CeedOperatorGetActiveBasis(opFine, &basisFine); CeedChk(ierr);
+  ierr = CeedOperatorGetActiveBasis(opFine, NULL, &basisFine); CeedChk(ierr);
   CeedInt Qf, Qc;
   ierr = CeedBasisGetNumQuadraturePoints(basisFine, &Qf); CeedChk(ierr);
   ierr = CeedBasisGetNumQuadraturePoints(basisCoarse, &Qc); CeedChk(ierr);
@@ -1330,54 +2551,40 @@ int CeedOperatorMultigridLevelCreateTensorH1(CeedOperator opFine,
   ierr = CeedCalloc(P1dFine, &qref); CeedChk(ierr);
   ierr = CeedCalloc(P1dFine, &qweight); CeedChk(ierr);
   ierr = CeedCalloc(P1dFine*P1dCoarse*dim, &grad); CeedChk(ierr);
-  CeedBasis basisCtoF;
   ierr = CeedBasisCreateTensorH1(ceed, dim, ncomp, P1dCoarse, P1dFine,
-                                 interpCtoF, grad, qref, qweight, &basisCtoF);
+                                 interpCtoF, grad, qref, qweight, basisCtoF);
   CeedChk(ierr);
   ierr = CeedFree(&qref); CeedChk(ierr);
   ierr = CeedFree(&qweight); CeedChk(ierr);
   ierr = CeedFree(&grad); CeedChk(ierr);
 
-  // Core code
-  ierr = CeedOperatorMultigridLevel_Core(opFine, PMultFine, rstrCoarse,
-                                         basisCoarse, basisCtoF, opCoarse,
-                                         opProlong, opRestrict);
-  CeedChk(ierr);
   return 0;
 }
 
 /**
-  @brief Create a multigrid coarse operator and level transfer operators
-           for a CeedOperator with a non-tensor basis for the active vector
+  @brief Create the coarse to fine interpolation basis for a CeedOperator with
+           a non-tensor basis for the active vector
 
   @param[in] opFine       Fine grid operator
-  @param[in] PMultFine    L-vector multiplicity in parallel gather/scatter
   @param[in] rstrCoarse   Coarse grid restriction
   @param[in] basisCoarse  Coarse grid active vector basis
   @param[in] interpCtoF   Matrix for coarse to fine interpolation
-  @param[out] opCoarse    Coarse grid operator
-  @param[out] opProlong   Coarse to fine operator
-  @param[out] opRestrict  Fine to coarse operator
+  @param[out] basisCtoF   Basis for coarse to fine interpolation
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref User
+  @ref Developer
 **/
-int CeedOperatorMultigridLevelCreateH1(CeedOperator opFine,
-                                       CeedVector PMultFine,
-                                       CeedElemRestriction rstrCoarse,
-                                       CeedBasis basisCoarse,
-                                       const CeedScalar *interpCtoF,
-                                       CeedOperator *opCoarse,
-                                       CeedOperator *opProlong,
-                                       CeedOperator *opRestrict) {
+static int CeedOperatorMultigridBasisCtoFH1(CeedOperator opFine,
+    CeedElemRestriction rstrCoarse, CeedBasis basisCoarse,
+    const CeedScalar *interpCtoF, CeedBasis *basisCtoF) {
   int ierr;
   Ceed ceed;
   ierr = CeedOperatorGetCeed(opFine, &ceed); CeedChk(ierr);
 
   // Check for compatible quadrature spaces
   CeedBasis basisFine;
-  ierr = CeedOperatorGetActiveBasis(opFine, &basisFine); CeedChk(ierr);
+  ierr = CeedOperatorGetActiveBasis(opFine, NULL, &basisFine); CeedChk(ierr);
   CeedInt Qf, Qc;
   ierr = CeedBasisGetNumQuadraturePoints(basisFine, &Qf); CeedChk(ierr);
   ierr = CeedBasisGetNumQuadraturePoints(basisCoarse, &Qc); CeedChk(ierr);
@@ -1399,18 +2606,167 @@ int CeedOperatorMultigridLevelCreateH1(CeedOperator opFine,
   ierr = CeedCalloc(nnodesFine, &qref); CeedChk(ierr);
   ierr = CeedCalloc(nnodesFine, &qweight); CeedChk(ierr);
   ierr = CeedCalloc(nnodesFine*nnodesCoarse*dim, &grad); CeedChk(ierr);
+  ierr = CeedBasisCreateH1(ceed, topo, ncomp, nnodesCoarse, nnodesFine,
+                           interpCtoF, grad, qref, qweight, basisCtoF);
+  CeedChk(ierr);
+  ierr = CeedFree(&qref); CeedChk(ierr);
+  ierr = CeedFree(&qweight); CeedChk(ierr);
+  ierr = CeedFree(&grad); CeedChk(ierr);
+
+  return 0;
+}
+
+/**
+  @brief Create a multigrid coarse operator and level transfer operators
+           for a CeedOperator, creating the prolongation basis from the
+           fine and coarse grid interpolation
+
+  If multInv is NULL, this is CeedOperatorMultigridLevelCreate(). Otherwise,
+    the transfer operators use an identity QFunction and the caller applies
+    the inverse multiplicity to the fine grid L-vector, see
+    CeedOperatorMultigridLevel_Core().
+
+  @param[in] opFine       Fine grid operator
+  @param[in] PMultFine    L-vector multiplicity in parallel gather/scatter
+  @param[in] rstrCoarse   Coarse grid restriction
+  @param[in] basisCoarse  Coarse grid active vector basis
+  @param[out] opCoarse    Coarse grid operator
+  @param[out] opProlong   Coarse to fine operator
+  @param[out] opRestrict  Fine to coarse operator
+  @param[out] multInv     Inverse multiplicity of the fine L-vector, or NULL
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedOperatorMultigridLevelCreateFused(CeedOperator opFine,
+    CeedVector PMultFine, CeedElemRestriction rstrCoarse, CeedBasis basisCoarse,
+    CeedOperator *opCoarse, CeedOperator *opProlong, CeedOperator *opRestrict,
+    CeedVector *multInv) {
+  int ierr;
+
+  // Coarse to fine basis
+  CeedScalar *interpCtoF;
+  bool isTensor;
+  ierr = CeedOperatorMultigridInterpCtoF(opFine, basisCoarse, &interpCtoF,
+                                         &isTensor); CeedChk(ierr);
+  CeedBasis basisCtoF;
+  if (isTensor) {
+    ierr = CeedOperatorMultigridBasisCtoFTensorH1(opFine, rstrCoarse,
+           basisCoarse, interpCtoF, &basisCtoF); CeedChk(ierr);
+  } else {
+    ierr = CeedOperatorMultigridBasisCtoFH1(opFine, rstrCoarse, basisCoarse,
+                                            interpCtoF, &basisCtoF);
+    CeedChk(ierr);
+  }
+  ierr = CeedFree(&interpCtoF); CeedChk(ierr);
+
+  // Core code
+  ierr = CeedOperatorMultigridLevel_Core(opFine, PMultFine, rstrCoarse,
+                                         basisCoarse, basisCtoF, opCoarse,
+                                         opProlong, opRestrict, multInv);
+  CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Create a multigrid coarse operator and level transfer operators
+           for a CeedOperator, creating the prolongation basis from the
+           fine and coarse grid interpolation
+
+  @param[in] opFine       Fine grid operator
+  @param[in] PMultFine    L-vector multiplicity in parallel gather/scatter
+  @param[in] rstrCoarse   Coarse grid restriction
+  @param[in] basisCoarse  Coarse grid active vector basis
+  @param[out] opCoarse    Coarse grid operator
+  @param[out] opProlong   Coarse to fine operator
+  @param[out] opRestrict  Fine to coarse operator
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorMultigridLevelCreate(CeedOperator opFine, CeedVector PMultFine,
+                                     CeedElemRestriction rstrCoarse, CeedBasis basisCoarse,
+                                     CeedOperator *opCoarse, CeedOperator *opProlong, CeedOperator *opRestrict) {
+  int ierr;
+  ierr = CeedOperatorMultigridLevelCreateFused(opFine, PMultFine, rstrCoarse,
+         basisCoarse, opCoarse, opProlong, opRestrict, NULL); CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Create a multigrid coarse operator and level transfer operators
+           for a CeedOperator with a tensor basis for the active basis
+
+  @param[in] opFine       Fine grid operator
+  @param[in] PMultFine    L-vector multiplicity in parallel gather/scatter
+  @param[in] rstrCoarse   Coarse grid restriction
+  @param[in] basisCoarse  Coarse grid active vector basis
+  @param[in] interpCtoF   Matrix for coarse to fine interpolation
+  @param[out] opCoarse    Coarse grid operator
+  @param[out] opProlong   Coarse to fine operator
+  @param[out] opRestrict  Fine to coarse operator
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorMultigridLevelCreateTensorH1(CeedOperator opFine,
+    CeedVector PMultFine, CeedElemRestriction rstrCoarse, CeedBasis basisCoarse,
+    const CeedScalar *interpCtoF, CeedOperator *opCoarse,
+    CeedOperator *opProlong, CeedOperator *opRestrict) {
+  int ierr;
+
+  // Coarse to fine basis
+  CeedBasis basisCtoF;
+  ierr = CeedOperatorMultigridBasisCtoFTensorH1(opFine, rstrCoarse, basisCoarse,
+         interpCtoF, &basisCtoF); CeedChk(ierr);
+
+  // Core code
+  ierr = CeedOperatorMultigridLevel_Core(opFine, PMultFine, rstrCoarse,
+                                         basisCoarse, basisCtoF, opCoarse,
+                                         opProlong, opRestrict, NULL);
+  CeedChk(ierr);
+  return 0;
+}
+
+/**
+  @brief Create a multigrid coarse operator and level transfer operators
+           for a CeedOperator with a non-tensor basis for the active vector
+
+  @param[in] opFine       Fine grid operator
+  @param[in] PMultFine    L-vector multiplicity in parallel gather/scatter
+  @param[in] rstrCoarse   Coarse grid restriction
+  @param[in] basisCoarse  Coarse grid active vector basis
+  @param[in] interpCtoF   Matrix for coarse to fine interpolation
+  @param[out] opCoarse    Coarse grid operator
+  @param[out] opProlong   Coarse to fine operator
+  @param[out] opRestrict  Fine to coarse operator
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorMultigridLevelCreateH1(CeedOperator opFine,
+                                       CeedVector PMultFine,
+                                       CeedElemRestriction rstrCoarse,
+                                       CeedBasis basisCoarse,
+                                       const CeedScalar *interpCtoF,
+                                       CeedOperator *opCoarse,
+                                       CeedOperator *opProlong,
+                                       CeedOperator *opRestrict) {
+  int ierr;
+
+  // Coarse to fine basis
   CeedBasis basisCtoF;
-  ierr = CeedBasisCreateH1(ceed, topo, ncomp, nnodesCoarse, nnodesFine,
-                           interpCtoF, grad, qref, qweight, &basisCtoF);
-  CeedChk(ierr);
-  ierr = CeedFree(&qref); CeedChk(ierr);
-  ierr = CeedFree(&qweight); CeedChk(ierr);
-  ierr = CeedFree(&grad); CeedChk(ierr);
+  ierr = CeedOperatorMultigridBasisCtoFH1(opFine, rstrCoarse, basisCoarse,
+                                          interpCtoF, &basisCtoF); CeedChk(ierr);
 
   // Core code
   ierr = CeedOperatorMultigridLevel_Core(opFine, PMultFine, rstrCoarse,
                                          basisCoarse, basisCtoF, opCoarse,
-                                         opProlong, opRestrict);
+                                         opProlong, opRestrict, NULL);
   CeedChk(ierr);
   return 0;
 }
@@ -1443,6 +2799,8 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdminv,
   int ierr;
   Ceed ceed = op->ceed;
   ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+  CeedTraceSample start;
+  CeedTraceStart(NULL, &start);
 
   // Use backend version, if available
   if (op->CreateFDMElementInverse) {
@@ -1457,6 +2815,180 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdminv,
            request); CeedChk(ierr);
   }
 
+  ierr = CeedOperatorTrace(op, CEED_TRACE_ASSEMBLY, __func__, &start);
+  CeedChk(ierr);
+
+  return 0;
+}
+
+/**
+  @brief Set the strategy used to apply a CeedOperator
+
+  With @ref CEED_STRATEGY_ASSEMBLED, the local operator is assembled as a CSR
+    matrix from CeedOperatorLinearAssembleQFunction() at the first apply and
+    applied with a sparse matrix-vector product. The matrix is reassembled
+    when a passive input vector or the QFunction context changes. With
+    @ref CEED_STRATEGY_AUTO, the first apply estimates the cost of both
+    strategies from the basis sizes and number of components and, when the
+    estimates are close, times both on the given input to select one. The
+    selection is reported by CeedOperatorView().
+
+  Assembly requires a linear operator with a single active restriction and
+    basis for its inputs and for its outputs, no passive outputs, and
+    restrictions with offsets or user-provided strides. Operators that do not
+    meet these requirements are applied matrix-free with
+    @ref CEED_STRATEGY_AUTO. For a composite CeedOperator, the strategy is set
+    on every current suboperator.
+
+  @param op        CeedOperator
+  @param strategy  Strategy to use for CeedOperatorApply() and
+                     CeedOperatorApplyAdd()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorSetStrategy(CeedOperator op, CeedOperatorStrategy strategy) {
+  int ierr;
+
+  op->strategy = strategy;
+  op->strategyset = false;
+  op->useassembled = false;
+  op->probetime[0] = op->probetime[1] = 0.0;
+  ierr = CeedOperatorDestroyCSR(op); CeedChk(ierr);
+  for (CeedInt i=0; i<op->numsub; i++) {
+    ierr = CeedOperatorSetStrategy(op->suboperators[i], strategy);
+    CeedChk(ierr);
+  }
+
+  return 0;
+}
+
+/**
+  @brief Set the storage precision of a passive CeedOperator input field
+
+  Backends that support reduced precision storage, currently
+    /cpu/self/ref/serial, /cpu/self/memcheck/serial, and the /cpu/self/opt,
+    /cpu/self/avx, and /cpu/self/xsmm backends, keep a copy of the restricted
+    field in the requested precision, refreshed when the vector changes, and
+    convert it to CeedScalar one element or block at a time before calling
+    the QFunction. This reduces the memory traffic for stored quadrature
+    data, while all arithmetic is in CeedScalar. Other backends read the
+    field in CeedScalar.
+
+  The field must be an input with eval mode @ref CEED_EVAL_NONE and a passive
+    vector. The precision must be set before the first apply.
+
+  @param op         CeedOperator
+  @param fieldname  Name of the field
+  @param precision  Storage precision of the field
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorSetFieldPrecision(CeedOperator op, const char *fieldname,
+                                  CeedFieldPrecision precision) {
+  if (op->composite)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Cannot set field precision of composite "
+                     "operator.");
+  // LCOV_EXCL_STOP
+  if (op->setupdone)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Field precision must be set before the "
+                     "first apply.");
+  // LCOV_EXCL_STOP
+
+  for (CeedInt i=0; i<op->qf->numinputfields; i++) {
+    if (!strcmp(fieldname, (*op->qf->inputfields[i]).fieldname)) {
+      CeedOperatorField field = op->inputfields[i];
+      if (!field || op->qf->inputfields[i]->emode != CEED_EVAL_NONE ||
+          field->vec == CEED_VECTOR_ACTIVE)
+        // LCOV_EXCL_START
+        return CeedError(op->ceed, 1, "Field '%s' must be set, with a passive "
+                         "vector and eval mode CEED_EVAL_NONE", fieldname);
+      // LCOV_EXCL_STOP
+      field->precision = precision;
+      return 0;
+    }
+  }
+  // LCOV_EXCL_START
+  return CeedError(op->ceed, 1, "QFunction has no input field '%s'",
+                   fieldname);
+  // LCOV_EXCL_STOP
+}
+
+/**
+  @brief Set the number of elements processed together by a CeedOperator
+
+  Backends that apply the operator one element at a time, currently
+    /cpu/self/ref/serial and /cpu/self/memcheck/serial, instead restrict
+    batches of this many elements into the layout of
+    CeedElemRestrictionCreateBlocked() and call the basis and QFunction once
+    per batch, with batchsize times as many quadrature points. Backends with
+    their own block size ignore this setting. For a composite CeedOperator,
+    the batch size is set on every current suboperator.
+
+  The basis scratch for a batch is kept on the stack, so these backends
+    return an error on the first apply if a tensor basis would need more than
+    2 MiB of scratch for a batch. Batches of tens to hundreds of elements fit
+    this limit for low and moderate orders.
+
+  The batch size must be set before the first apply.
+
+  @param op         CeedOperator
+  @param batchsize  Number of elements per basis and QFunction call
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorSetBatchSize(CeedOperator op, CeedInt batchsize) {
+  int ierr;
+
+  if (batchsize < 1)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Batch size must be positive, not %d",
+                     batchsize);
+  // LCOV_EXCL_STOP
+  if (op->setupdone)
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, 1, "Batch size must be set before the first "
+                     "apply.");
+  // LCOV_EXCL_STOP
+
+  op->batchsize = batchsize;
+  for (CeedInt i=0; i<op->numsub; i++) {
+    ierr = CeedOperatorSetBatchSize(op->suboperators[i], batchsize);
+    CeedChk(ierr);
+  }
+
+  return 0;
+}
+
+/**
+  @brief Set the name of a CeedOperator
+
+  The name is shown by CeedOperatorView() and tags the spans of the operator in
+    the trace event timeline written to the file named by the environment
+    variable CEED_TRACE, which can be opened in chrome://tracing or Perfetto.
+
+  @param op    CeedOperator
+  @param name  Name of the operator, such as "mass, level 2"
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorSetName(CeedOperator op, const char *name) {
+  int ierr;
+  size_t len = strlen(name);
+
+  ierr = CeedFree(&op->name); CeedChk(ierr);
+  ierr = CeedCalloc(len+1, &op->name); CeedChk(ierr);
+  memcpy(op->name, name, len+1);
+
   return 0;
 }
 
@@ -1473,6 +3005,8 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdminv,
 int CeedOperatorView(CeedOperator op, FILE *stream) {
   int ierr;
 
+  if (op->name)
+    fprintf(stream, "Name: \"%s\"\n", op->name);
   if (op->composite) {
     fprintf(stream, "Composite CeedOperator\n");
 
@@ -1489,6 +3023,178 @@ int CeedOperatorView(CeedOperator op, FILE *stream) {
   return 0;
 }
 
+/**
+  @brief Get the number of bytes of memory held by a CeedOperator
+
+  This counts the restrictions, bases, and passive vectors of the operator
+    fields, backend work arrays, the assembled matrix, and the work arrays of a
+    fallback operator, if any. Objects shared between fields or sub-operators
+    of a composite operator are counted once, while objects shared with other
+    operators are counted for each. Backend work arrays are allocated at the
+    first apply.
+
+  @param op          CeedOperator
+  @param category    Category of memory, or @ref CEED_MEMORY_TOTAL for the sum
+                       of all categories
+  @param[out] bytes  Variable to store the number of bytes
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorGetMemoryUsage(CeedOperator op, CeedMemoryCategory category,
+                               size_t *bytes) {
+  int ierr;
+  size_t usage[CEED_MEMORY_TOTAL] = {0};
+  const void **seen = NULL;
+  CeedInt nseen = 0;
+
+  ierr = CeedOperatorGetMemoryUsage_Core(op, usage, &seen, &nseen);
+  CeedChk(ierr);
+  ierr = CeedFree(&seen); CeedChk(ierr);
+
+  *bytes = 0;
+  for (CeedInt i=0; i<CEED_MEMORY_TOTAL; i++)
+    if (category == CEED_MEMORY_TOTAL || category == (CeedMemoryCategory)i)
+      *bytes += usage[i];
+  return 0;
+}
+
+/**
+  @brief View the memory held by a CeedOperator in each category
+
+  @param[in] op     CeedOperator to view
+  @param[in] stream Stream to write; typically stdout/stderr or a file
+
+  @return Error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorViewMemoryUsage(CeedOperator op, FILE *stream) {
+  int ierr;
+  size_t usage[CEED_MEMORY_TOTAL] = {0}, total = 0;
+  const void **seen = NULL;
+  CeedInt nseen = 0;
+
+  ierr = CeedOperatorGetMemoryUsage_Core(op, usage, &seen, &nseen);
+  CeedChk(ierr);
+  ierr = CeedFree(&seen); CeedChk(ierr);
+
+  fprintf(stream, "%sCeedOperator memory usage\n",
+          op->composite ? "Composite " : "");
+  for (CeedInt i=0; i<CEED_MEMORY_TOTAL; i++) {
+    fprintf(stream, "  %s: %zu bytes\n", CeedMemoryCategories[i], usage[i]);
+    total += usage[i];
+  }
+  fprintf(stream, "  %s: %zu bytes\n", CeedMemoryCategories[CEED_MEMORY_TOTAL],
+          total);
+
+  return 0;
+}
+
+/**
+  @brief Estimate the floating point operations of one application of a
+           CeedOperator
+
+  This counts the tensor contractions of the bases, from the number of nodes
+    and quadrature points in one dimension, the dimension, and the number of
+    components, the sums of transpose restrictions, and the QFunction flops per
+    quadrature point set by CeedQFunctionSetUserFlopsEstimate(). A composite
+    CeedOperator sums its sub-operators.
+
+  @param op          CeedOperator
+  @param[out] flops  Variable to store the estimated flops
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorGetFlopsEstimate(CeedOperator op, size_t *flops) {
+  int ierr;
+  size_t subflops, bytes;
+
+  *flops = 0;
+  if (op->composite) {
+    for (CeedInt i=0; i<op->numsub; i++) {
+      ierr = CeedOperatorGetFlopsEstimate(op->suboperators[i], &subflops);
+      CeedChk(ierr);
+      *flops += subflops;
+    }
+  } else {
+    ierr = CeedOperatorGetEstimates(op, flops, &bytes); CeedChk(ierr);
+  }
+  return 0;
+}
+
+/**
+  @brief Estimate the bytes of memory traffic of one application of a
+           CeedOperator
+
+  This counts the values and offsets read by the element restrictions of the
+    input fields, the values read and written by the transpose restrictions of
+    the output fields, at the storage precision of passive inputs, and the
+    QFunction input and output values. Reuse in cache is not modeled. A
+    composite CeedOperator sums its sub-operators.
+
+  @param op          CeedOperator
+  @param[out] bytes  Variable to store the estimated bytes
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorGetBytesEstimate(CeedOperator op, size_t *bytes) {
+  int ierr;
+  size_t subbytes, flops;
+
+  *bytes = 0;
+  if (op->composite) {
+    for (CeedInt i=0; i<op->numsub; i++) {
+      ierr = CeedOperatorGetBytesEstimate(op->suboperators[i], &subbytes);
+      CeedChk(ierr);
+      *bytes += subbytes;
+    }
+  } else {
+    ierr = CeedOperatorGetEstimates(op, &flops, bytes); CeedChk(ierr);
+  }
+  return 0;
+}
+
+/**
+  @brief View the time, estimated flop rate, and hardware counter metrics of
+           the restriction, basis, and QFunction stages of the applications of
+           a CeedOperator
+
+  Totals are recorded for Ceed contexts created with the environment variable
+    CEED_PERF_COUNTERS set. On Linux, cycles, instructions, and L1 data and
+    last level cache accesses and misses of the applying thread are sampled
+    with perf_event_open(), as permitted by
+    /proc/sys/kernel/perf_event_paranoid; metrics of counters that cannot be
+    opened are shown as "-". Bandwidth is estimated from last level cache
+    misses.
+
+  @param[in] op     CeedOperator to view
+  @param[in] stream Stream to write; typically stdout/stderr or a file
+
+  @return Error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorViewPerformance(CeedOperator op, FILE *stream) {
+  int ierr;
+
+  fprintf(stream, "%sCeedOperator performance\n",
+          op->composite ? "Composite " : "");
+  ierr = CeedTraceViewStats(op->stagestats, "  ", stream); CeedChk(ierr);
+  for (CeedInt i=0; i<op->numsub; i++) {
+    fprintf(stream, "  SubOperator [%d]:\n", i);
+    ierr = CeedTraceViewStats(op->suboperators[i]->stagestats, "    ", stream);
+    CeedChk(ierr);
+  }
+
+  return 0;
+}
+
 /**
   @brief Apply CeedOperator to a vector
 
@@ -1514,55 +3220,68 @@ int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out,
   int ierr;
   Ceed ceed = op->ceed;
   ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+  CeedTraceSample start;
+  CeedTraceStart(op, &start);
 
   if (op->numelements)  {
     // Standard Operator
-    if (op->Apply) {
-      ierr = op->Apply(op, in, out, request); CeedChk(ierr);
+    bool matrixfree = op->strategy == CEED_STRATEGY_MATRIX_FREE ||
+                      (op->strategyset && !op->useassembled);
+    if (op->Apply && matrixfree) {
+      ierr = op->Apply(op, in, out, request); CeedTraceChk(ierr, &start);
     } else {
-      // Zero all output vectors
+      // Zero all output vectors, once each
       CeedQFunction qf = op->qf;
       for (CeedInt i=0; i<qf->numoutputfields; i++) {
         CeedVector vec = op->outputfields[i]->vec;
         if (vec == CEED_VECTOR_ACTIVE)
           vec = out;
-        if (vec != CEED_VECTOR_NONE) {
-          ierr = CeedVectorSetValue(vec, 0.0); CeedChk(ierr);
+        bool zeroed = vec == CEED_VECTOR_NONE;
+        for (CeedInt j=0; j<i && !zeroed; j++) {
+          CeedVector prev = op->outputfields[j]->vec;
+          zeroed = (prev == CEED_VECTOR_ACTIVE ? out : prev) == vec;
+        }
+        if (!zeroed) {
+          ierr = CeedVectorSetValue(vec, 0.0); CeedTraceChk(ierr, &start);
         }
       }
       // Apply
-      ierr = op->ApplyAdd(op, in, out, request); CeedChk(ierr);
+      ierr = CeedOperatorApplyAddStrategy(op, in, out, request);
+      CeedTraceChk(ierr, &start);
     }
   } else if (op->composite) {
     // Composite Operator
     if (op->ApplyComposite) {
-      ierr = op->ApplyComposite(op, in, out, request); CeedChk(ierr);
+      ierr = op->ApplyComposite(op, in, out, request);
+      CeedTraceChk(ierr, &start);
     } else {
       CeedInt numsub;
-      ierr = CeedOperatorGetNumSub(op, &numsub); CeedChk(ierr);
+      ierr = CeedOperatorGetNumSub(op, &numsub); CeedTraceChk(ierr, &start);
       CeedOperator *suboperators;
-      ierr = CeedOperatorGetSubList(op, &suboperators); CeedChk(ierr);
+      ierr = CeedOperatorGetSubList(op, &suboperators);
+      CeedTraceChk(ierr, &start);
 
       // Zero all output vectors
       if (out != CEED_VECTOR_NONE) {
-        ierr = CeedVectorSetValue(out, 0.0); CeedChk(ierr);
+        ierr = CeedVectorSetValue(out, 0.0); CeedTraceChk(ierr, &start);
       }
       for (CeedInt i=0; i<numsub; i++) {
         for (CeedInt j=0; j<suboperators[i]->qf->numoutputfields; j++) {
           CeedVector vec = suboperators[i]->outputfields[j]->vec;
           if (vec != CEED_VECTOR_ACTIVE && vec != CEED_VECTOR_NONE) {
-            ierr = CeedVectorSetValue(vec, 0.0); CeedChk(ierr);
+            ierr = CeedVectorSetValue(vec, 0.0); CeedTraceChk(ierr, &start);
           }
         }
       }
       // Apply
-      for (CeedInt i=0; i<op->numsub; i++) {
-        ierr = CeedOperatorApplyAdd(op->suboperators[i], in, out, request);
-        CeedChk(ierr);
-      }
+      ierr = CeedOperatorApplyAdd(op, in, out, request);
+      CeedTraceChk(ierr, &start);
     }
   }
 
+  ierr = CeedOperatorTrace(op, CEED_TRACE_OPERATOR, __func__, &start);
+  CeedChk(ierr);
+
   return 0;
 }
 
@@ -1590,27 +3309,197 @@ int CeedOperatorApplyAdd(CeedOperator op, CeedVector in, CeedVector out,
   int ierr;
   Ceed ceed = op->ceed;
   ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+  CeedTraceSample start;
+  CeedTraceStart(op, &start);
 
   if (op->numelements)  {
     // Standard Operator
-    ierr = op->ApplyAdd(op, in, out, request); CeedChk(ierr);
+    ierr = CeedOperatorApplyAddStrategy(op, in, out, request);
+    CeedTraceChk(ierr, &start);
   } else if (op->composite) {
     // Composite Operator
-    if (op->ApplyAddComposite) {
-      ierr = op->ApplyAddComposite(op, in, out, request); CeedChk(ierr);
+    bool usebackend;
+    ierr = CeedOperatorUseApplyAddComposite(op, &usebackend);
+    CeedTraceChk(ierr, &start);
+    if (usebackend) {
+      ierr = op->ApplyAddComposite(op, in, out, request);
+      CeedTraceChk(ierr, &start);
     } else {
       CeedInt numsub;
-      ierr = CeedOperatorGetNumSub(op, &numsub); CeedChk(ierr);
+      ierr = CeedOperatorGetNumSub(op, &numsub); CeedTraceChk(ierr, &start);
       CeedOperator *suboperators;
-      ierr = CeedOperatorGetSubList(op, &suboperators); CeedChk(ierr);
+      ierr = CeedOperatorGetSubList(op, &suboperators);
+      CeedTraceChk(ierr, &start);
 
       for (CeedInt i=0; i<numsub; i++) {
         ierr = CeedOperatorApplyAdd(suboperators[i], in, out, request);
-        CeedChk(ierr);
+        CeedTraceChk(ierr, &start);
+      }
+    }
+  }
+
+  ierr = CeedOperatorTrace(op, CEED_TRACE_OPERATOR, __func__, &start);
+  CeedChk(ierr);
+
+  return 0;
+}
+
+/**
+  @brief Apply CeedOperator to a vector and scale the result pointwise
+
+  This computes out = D op(in), with D the diagonal matrix with entries
+    @a scale. For explicit time stepping with a lumped mass matrix, @a scale is
+    the inverse of the lumped mass on the local vector. See
+    CeedOperatorApplyScaledAdd().
+
+  @param op        CeedOperator to apply
+  @param[in] in    CeedVector containing input state or NULL if there are no
+                     active inputs
+  @param[out] out  CeedVector to store result of applying operator (must be
+                     distinct from @a in) or NULL if there are no active outputs
+  @param[in] scale CeedVector with the same length as @a out of pointwise
+                     scaling factors, or @ref CEED_VECTOR_NONE for no scaling
+  @param request   Address of CeedRequest for non-blocking completion, else
+                     @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApplyScaled(CeedOperator op, CeedVector in, CeedVector out,
+                            CeedVector scale, CeedRequest *request) {
+  int ierr;
+  Ceed ceed = op->ceed;
+  ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+
+  // Zero passive output vectors
+  CeedInt numsub = op->composite ? op->numsub : 1;
+  CeedOperator *suboperators = op->composite ? op->suboperators : &op;
+  for (CeedInt i=0; i<numsub; i++) {
+    for (CeedInt j=0; j<suboperators[i]->qf->numoutputfields; j++) {
+      CeedVector vec = suboperators[i]->outputfields[j]->vec;
+      if (vec != CEED_VECTOR_ACTIVE && vec != CEED_VECTOR_NONE) {
+        ierr = CeedVectorSetValue(vec, 0.0); CeedChk(ierr);
       }
     }
   }
 
+  // Apply
+  ierr = CeedOperatorApplyScaledAdd(op, in, out, 0.0, 1.0, scale, request);
+  CeedChk(ierr);
+
+  return 0;
+}
+
+/**
+  @brief Apply CeedOperator to a vector and add the pointwise scaled result to
+           the scaled output vector
+
+  This computes out = alpha out + beta D op(in), with D the diagonal matrix
+    with entries @a scale. Backends that support it apply beta D to each
+    element contribution before the transpose element restriction, so the
+    output vector is only updated once, instead of in separate passes for the
+    operator action and the scaling. Passive output fields are summed into,
+    as in CeedOperatorApplyAdd().
+
+  @param op        CeedOperator to apply
+  @param[in] in    CeedVector containing input state or NULL if there are no
+                     active inputs
+  @param[out] out  CeedVector to update with result of applying operator (must
+                     be distinct from @a in) or NULL if there are no active
+                     outputs
+  @param[in] alpha Scaling factor for the initial value of @a out
+  @param[in] beta  Scaling factor for the operator action
+  @param[in] scale CeedVector with the same length as @a out of pointwise
+                     scaling factors, or @ref CEED_VECTOR_NONE for no scaling
+  @param request   Address of CeedRequest for non-blocking completion, else
+                     @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApplyScaledAdd(CeedOperator op, CeedVector in, CeedVector out,
+                               CeedScalar alpha, CeedScalar beta,
+                               CeedVector scale, CeedRequest *request) {
+  int ierr;
+  Ceed ceed = op->ceed;
+  ierr = CeedOperatorCheckReady(ceed, op); CeedChk(ierr);
+
+  // No active output to scale
+  if (out == CEED_VECTOR_NONE) {
+    ierr = CeedOperatorApplyAdd(op, in, out, request); CeedChk(ierr);
+    return 0;
+  }
+  if (scale != CEED_VECTOR_NONE && scale->length != out->length)
+    // LCOV_EXCL_START
+    return CeedError(ceed, 1, "Scaling vector length %d does not match output "
+                     "vector length %d", scale->length, out->length);
+  // LCOV_EXCL_STOP
+
+  // Backend scaled apply
+  CeedTraceSample start;
+  CeedTraceStart(op, &start);
+  bool matrixfree = op->strategy == CEED_STRATEGY_MATRIX_FREE ||
+                    (op->strategyset && !op->useassembled);
+  if (op->numelements && op->ApplyScaledAdd && matrixfree) {
+    if (alpha == 0.0) {
+      ierr = CeedVectorSetValue(out, 0.0); CeedTraceChk(ierr, &start);
+    } else if (alpha != 1.0) {
+      ierr = CeedVectorScale(out, alpha); CeedTraceChk(ierr, &start);
+    }
+    ierr = op->ApplyScaledAdd(op, in, out, beta, scale, request);
+    CeedTraceChk(ierr, &start);
+    ierr = CeedOperatorTrace(op, CEED_TRACE_OPERATOR, __func__, &start);
+    CeedChk(ierr);
+    return 0;
+  }
+
+  // Unscaled apply
+  if (scale == CEED_VECTOR_NONE && alpha == 1.0 && beta == 1.0) {
+    ierr = CeedOperatorApplyAdd(op, in, out, request);
+    CeedTraceChk(ierr, &start);
+    ierr = CeedOperatorTrace(op, CEED_TRACE_OPERATOR, __func__, &start);
+    CeedChk(ierr);
+    return 0;
+  }
+
+  // Apply to work vector and update output in a single pass
+  if (!op->scaledwork) {
+    ierr = CeedVectorCreate(ceed, out->length, &op->scaledwork);
+    CeedTraceChk(ierr, &start);
+  } else if (op->scaledwork->length != out->length) {
+    // LCOV_EXCL_START
+    ierr = CeedError(ceed, 1, "Output vector length %d does not match previous "
+                     "length %d", out->length, op->scaledwork->length);
+    CeedTraceChk(ierr, &start);
+    // LCOV_EXCL_STOP
+  }
+  ierr = CeedVectorSetValue(op->scaledwork, 0.0); CeedTraceChk(ierr, &start);
+  ierr = CeedOperatorApplyAdd(op, in, op->scaledwork, request);
+  CeedTraceChk(ierr, &start);
+
+  const CeedScalar *work, *s = NULL;
+  CeedScalar *y;
+  ierr = CeedVectorGetArrayRead(op->scaledwork, CEED_MEM_HOST, &work);
+  CeedTraceChk(ierr, &start);
+  if (scale != CEED_VECTOR_NONE) {
+    ierr = CeedVectorGetArrayRead(scale, CEED_MEM_HOST, &s);
+    CeedTraceChk(ierr, &start);
+  }
+  ierr = CeedVectorGetArray(out, CEED_MEM_HOST, &y); CeedTraceChk(ierr, &start);
+  // -- Do not propagate non-finite values from the output for alpha = 0
+  for (CeedInt i=0; i<out->length; i++)
+    y[i] = (alpha == 0.0 ? 0.0 : alpha*y[i]) + beta*(s ? s[i] : 1.0)*work[i];
+  ierr = CeedVectorRestoreArray(out, &y); CeedTraceChk(ierr, &start);
+  if (s) {
+    ierr = CeedVectorRestoreArrayRead(scale, &s); CeedTraceChk(ierr, &start);
+  }
+  ierr = CeedVectorRestoreArrayRead(op->scaledwork, &work);
+  CeedTraceChk(ierr, &start);
+  ierr = CeedOperatorTrace(op, CEED_TRACE_OPERATOR, __func__, &start);
+  CeedChk(ierr);
+
   return 0;
 }
 
@@ -1626,7 +3515,7 @@ int CeedOperatorApplyAdd(CeedOperator op, CeedVector in, CeedVector out,
 int CeedOperatorDestroy(CeedOperator *op) {
   int ierr;
 
-  if (!*op || --(*op)->refcount > 0) return 0;
+  if (!*op || CeedAtomicAdd((*op)->refcount, -1) > 0) return 0;
   if ((*op)->Destroy) {
     ierr = (*op)->Destroy(*op); CeedChk(ierr);
   }
@@ -1671,6 +3560,12 @@ int CeedOperatorDestroy(CeedOperator *op) {
   ierr = CeedQFunctionDestroy(&(*op)->dqf); CeedChk(ierr);
   ierr = CeedQFunctionDestroy(&(*op)->dqfT); CeedChk(ierr);
 
+  // Destroy assembled CSR matrix
+  ierr = CeedOperatorDestroyCSR(*op); CeedChk(ierr);
+  ierr = CeedVectorDestroy(&(*op)->scaledwork); CeedChk(ierr);
+  ierr = CeedFree(&(*op)->name); CeedChk(ierr);
+  ierr = CeedFree(&(*op)->stagestats); CeedChk(ierr);
+
   // Destroy fallback
   if ((*op)->opfallback) {
     ierr = (*op)->qffallback->Destroy((*op)->qffallback); CeedChk(ierr);
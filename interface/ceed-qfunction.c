@@ -279,10 +279,11 @@ int CeedQFunctionGetInnerContext(CeedQFunction qf, CeedQFunctionContext *ctx) {
   int ierr;
   if (qf->fortranstatus) {
     CeedFortranContext fctx = NULL;
-    ierr = CeedQFunctionContextGetData(qf->ctx, CEED_MEM_HOST, &fctx);
+    ierr = CeedQFunctionContextGetDataRead(qf->ctx, CEED_MEM_HOST, &fctx);
     CeedChk(ierr);
     *ctx = fctx->innerctx;
-    ierr = CeedQFunctionContextRestoreData(qf->ctx, (void *)&fctx); CeedChk(ierr);
+    ierr = CeedQFunctionContextRestoreDataRead(qf->ctx, (void *)&fctx);
+    CeedChk(ierr);
   } else {
     *ctx = qf->ctx;
   }
@@ -306,6 +307,23 @@ int CeedQFunctionIsIdentity(CeedQFunction qf, bool *isidentity) {
   return 0;
 }
 
+/**
+  @brief Get the estimated flops per quadrature point of a CeedQFunction, set
+           by CeedQFunctionSetUserFlopsEstimate()
+
+  @param qf          CeedQFunction
+  @param[out] flops  Variable to store the flops per quadrature point, or 0 if
+                       unknown
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedQFunctionGetUserFlopsEstimate(CeedQFunction qf, size_t *flops) {
+  *flops = qf->userflops;
+  return 0;
+}
+
 /**
   @brief Get backend data of a CeedQFunction
 
@@ -453,7 +471,7 @@ int CeedQFunctionCreateInterior(Ceed ceed, CeedInt vlength, CeedQFunctionUser f,
 
   ierr = CeedCalloc(1, qf); CeedChk(ierr);
   (*qf)->ceed = ceed;
-  ceed->refcount++;
+  CeedAtomicAdd(ceed->refcount, 1);
   (*qf)->refcount = 1;
   (*qf)->vlength = vlength;
   (*qf)->identity = 0;
@@ -634,7 +652,25 @@ int CeedQFunctionAddOutput(CeedQFunction qf, const char *fieldname,
 **/
 int CeedQFunctionSetContext(CeedQFunction qf, CeedQFunctionContext ctx) {
   qf->ctx = ctx;
-  ctx->refcount++;
+  CeedAtomicAdd(ctx->refcount, 1);
+  return 0;
+}
+
+/**
+  @brief Set the estimated flops per quadrature point of a CeedQFunction, used
+           by CeedOperatorGetFlopsEstimate() and the per stage totals recorded
+           with CEED_PERF_COUNTERS
+
+  @param qf     CeedQFunction
+  @param flops  Floating point operations of the user function for one
+                  quadrature point
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedQFunctionSetUserFlopsEstimate(CeedQFunction qf, size_t flops) {
+  qf->userflops = flops;
   return 0;
 }
 
@@ -694,7 +730,13 @@ int CeedQFunctionApply(CeedQFunction qf, CeedInt Q,
     return CeedError(qf->ceed, 2, "Number of quadrature points %d must be a "
                      "multiple of %d", Q, qf->vlength);
   // LCOV_EXCL_STOP
+  CeedTraceSample start;
+  CeedTraceStart(NULL, &start);
   ierr = qf->Apply(qf, Q, u, v); CeedChk(ierr);
+  ierr = CeedTraceSpan(qf->ceed, CEED_TRACE_QFUNCTION, __func__, &start,
+                       (double)Q*qf->userflops,
+                       qf->qfname ? qf->qfname : qf->sourcepath,
+                       "\"qpoints\": %d", Q); CeedChk(ierr);
   return 0;
 }
 
@@ -710,7 +752,7 @@ int CeedQFunctionApply(CeedQFunction qf, CeedInt Q,
 int CeedQFunctionDestroy(CeedQFunction *qf) {
   int ierr;
 
-  if (!*qf || --(*qf)->refcount > 0) return 0;
+  if (!*qf || CeedAtomicAdd((*qf)->refcount, -1) > 0) return 0;
   // Backend destroy
   if ((*qf)->Destroy) {
     ierr = (*qf)->Destroy(*qf); CeedChk(ierr);
@@ -140,7 +140,7 @@ int CeedQFunctionContextCreate(Ceed ceed, CeedQFunctionContext *ctx) {
 
   ierr = CeedCalloc(1, ctx); CeedChk(ierr);
   (*ctx)->ceed = ceed;
-  ceed->refcount++;
+  CeedAtomicAdd(ceed->refcount, 1);
   (*ctx)->refcount = 1;
   ierr = ceed->QFunctionContextCreate(*ctx); CeedChk(ierr);
   return 0;
@@ -178,9 +178,16 @@ int CeedQFunctionContextSetData(CeedQFunctionContext ctx, CeedMemType mtype,
                      "access lock is already in use");
   // LCOV_EXCL_STOP
 
+  if (ctx->numreaders > 0)
+    // LCOV_EXCL_START
+    return CeedError(ctx->ceed, 1,
+                     "Cannot grant CeedQFunctionContext data access, a "
+                     "process has read access");
+  // LCOV_EXCL_STOP
+
   ctx->ctxsize = size;
   ierr = ctx->SetData(ctx, mtype, cmode, data); CeedChk(ierr);
-  ctx->state += 2;
+  CeedAtomicAdd(ctx->state, 2);
 
   return 0;
 }
@@ -218,8 +225,15 @@ int CeedQFunctionContextGetData(CeedQFunctionContext ctx, CeedMemType mtype,
                      "access lock is already in use");
   // LCOV_EXCL_STOP
 
+  if (ctx->numreaders > 0)
+    // LCOV_EXCL_START
+    return CeedError(ctx->ceed, 1,
+                     "Cannot grant CeedQFunctionContext data access, a "
+                     "process has read access");
+  // LCOV_EXCL_STOP
+
   ierr = ctx->GetData(ctx, mtype, data); CeedChk(ierr);
-  ctx->state += 1;
+  CeedAtomicAdd(ctx->state, 1);
 
   return 0;
 }
@@ -251,7 +265,71 @@ int CeedQFunctionContextRestoreData(CeedQFunctionContext ctx, void *data) {
 
   ierr = ctx->RestoreData(ctx); CeedChk(ierr);
   *(void **)data = NULL;
-  ctx->state += 1;
+  CeedAtomicAdd(ctx->state, 1);
+
+  return 0;
+}
+
+/**
+  @brief Get read-only access to a CeedQFunctionContext via the specified memory
+           type. Restore access with @ref CeedQFunctionContextRestoreDataRead().
+
+  Unlike @ref CeedQFunctionContextGetData(), read-only access may be held by
+    several callers at once, such as operators sharing a CeedQFunction that are
+    applied from different threads, and does not update the context state.
+
+  @param ctx        CeedQFunctionContext to access
+  @param mtype      Memory type on which to access the data. If the backend
+                    uses a different memory type, this will perform a copy.
+  @param[out] data  Data on memory type mtype
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedQFunctionContextGetDataRead(CeedQFunctionContext ctx,
+                                    CeedMemType mtype, void *data) {
+  int ierr;
+
+  if (!ctx->GetData)
+    // LCOV_EXCL_START
+    return CeedError(ctx->ceed, 1, "Backend does not support GetData");
+  // LCOV_EXCL_STOP
+
+  if (ctx->state % 2 == 1)
+    // LCOV_EXCL_START
+    return CeedError(ctx->ceed, 1,
+                     "Cannot grant CeedQFunctionContext read-only data "
+                     "access, the access lock is already in use");
+  // LCOV_EXCL_STOP
+
+  ierr = ctx->GetData(ctx, mtype, data); CeedChk(ierr);
+  CeedAtomicAdd(ctx->numreaders, 1);
+
+  return 0;
+}
+
+/**
+  @brief Restore data obtained using @ref CeedQFunctionContextGetDataRead()
+
+  @param ctx     CeedQFunctionContext to restore
+  @param data    Data to restore
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedQFunctionContextRestoreDataRead(CeedQFunctionContext ctx, void *data) {
+  int ierr;
+
+  if (!ctx->RestoreData)
+    // LCOV_EXCL_START
+    return CeedError(ctx->ceed, 1, "Backend does not support RestoreData");
+  // LCOV_EXCL_STOP
+
+  ierr = ctx->RestoreData(ctx); CeedChk(ierr);
+  *(void **)data = NULL;
+  CeedAtomicAdd(ctx->numreaders, -1);
 
   return 0;
 }
@@ -284,7 +362,7 @@ int CeedQFunctionContextView(CeedQFunctionContext ctx, FILE *stream) {
 int CeedQFunctionContextDestroy(CeedQFunctionContext *ctx) {
   int ierr;
 
-  if (!*ctx || --(*ctx)->refcount > 0)
+  if (!*ctx || CeedAtomicAdd((*ctx)->refcount, -1) > 0)
     return 0;
 
   if ((*ctx) && ((*ctx)->state % 2) == 1)
@@ -294,6 +372,13 @@ int CeedQFunctionContextDestroy(CeedQFunctionContext *ctx) {
                      "lock is in use");
   // LCOV_EXCL_STOP
 
+  if ((*ctx)->numreaders > 0)
+    // LCOV_EXCL_START
+    return CeedError((*ctx)->ceed, 1,
+                     "Cannot destroy CeedQFunctionContext, a process has "
+                     "read access");
+  // LCOV_EXCL_STOP
+
   if ((*ctx)->Destroy) {
     ierr = (*ctx)->Destroy(*ctx); CeedChk(ierr);
   }
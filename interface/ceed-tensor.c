@@ -16,10 +16,151 @@
 
 #include <ceed-impl.h>
 #include <ceed-backend.h>
+#include <math.h>
 
 /// @file
 /// Implementation of CeedTensorContract interfaces
 
+/// ----------------------------------------------------------------------------
+/// CeedTensorContract Library Internal Functions
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedBasisDeveloper
+/// @{
+
+/**
+  @brief Apply tensor contraction with an even-odd decomposition of the matrix,
+           using the given scratch
+
+  With T = t for @ref CEED_NOTRANSPOSE and T = t^T for @ref CEED_TRANSPOSE,
+    the input is folded into even and odd parts, u_b + u_(B-1-b) and
+    u_b - u_(B-1-b), which are contracted with the even and odd parts of the
+    first half of the rows of T. The output rows j and J-1-j are the sum and
+    the (signed) difference of these two contractions.
+
+  @param contract   CeedTensorContract to use
+  @param eo         Even-odd decomposition of the matrix
+  @param A          First index of u, v
+  @param B          Middle index of u
+  @param C          Last index of u, v
+  @param J          Middle index of v
+  @param tmode      Transpose mode for the matrix
+  @param add        Add mode
+  @param[in] u      Input array
+  @param[out] v     Output array
+  @param work       Scratch of length A*(B + 2*((J+1)/2))*C for the folded
+                      input and output
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedTensorContractApplyEvenOddWork(CeedTensorContract contract,
+    const CeedTensorContractEvenOdd *eo, CeedInt A, CeedInt B, CeedInt C,
+    CeedInt J, CeedTransposeMode tmode, const CeedInt add,
+    const CeedScalar *restrict u, CeedScalar *restrict v,
+    CeedScalar *restrict work) {
+  int ierr;
+  const CeedInt Jh = (J+1)/2, Be = (B+1)/2, Bo = B/2;
+  const CeedScalar sign = eo->parity;
+  CeedScalar *ue = work, *uo = ue + A*Be*C, *ve = uo + A*Bo*C,
+              *vo = ve + A*Jh*C;
+
+  // Fold input
+  for (CeedInt a=0; a<A; a++) {
+    for (CeedInt b=0; b<Bo; b++)
+      for (CeedInt c=0; c<C; c++) {
+        const CeedScalar u0 = u[(a*B+b)*C+c], u1 = u[(a*B+B-1-b)*C+c];
+        ue[(a*Be+b)*C+c] = u0 + u1;
+        uo[(a*Bo+b)*C+c] = u0 - u1;
+      }
+    if (Be > Bo)
+      for (CeedInt c=0; c<C; c++)
+        ue[(a*Be+Bo)*C+c] = u[(a*B+Bo)*C+c];
+  }
+
+  // Contract even and odd parts
+  ierr = contract->Apply(contract, A, Be, C, Jh, eo->even[tmode],
+                         CEED_NOTRANSPOSE, 0, ue, ve); CeedChk(ierr);
+  ierr = contract->Apply(contract, A, Bo, C, Jh, eo->odd[tmode],
+                         CEED_NOTRANSPOSE, 0, uo, vo); CeedChk(ierr);
+
+  // Unfold output
+  for (CeedInt a=0; a<A; a++) {
+    for (CeedInt j=0; j<J/2; j++)
+      for (CeedInt c=0; c<C; c++) {
+        const CeedScalar e = ve[(a*Jh+j)*C+c], o = vo[(a*Jh+j)*C+c];
+        if (add) {
+          v[(a*J+j)*C+c] += e + o;
+          v[(a*J+J-1-j)*C+c] += sign*(e - o);
+        } else {
+          v[(a*J+j)*C+c] = e + o;
+          v[(a*J+J-1-j)*C+c] = sign*(e - o);
+        }
+      }
+    if (Jh > J/2)
+      for (CeedInt c=0; c<C; c++) {
+        const CeedScalar e = ve[(a*Jh+J/2)*C+c], o = vo[(a*Jh+J/2)*C+c];
+        v[(a*J+J/2)*C+c] = (add ? v[(a*J+J/2)*C+c] : 0.0) + e + o;
+      }
+  }
+  return 0;
+}
+
+/**
+  @brief Apply tensor contraction with an even-odd decomposition of the matrix
+
+  The folded input and output are kept with the contraction and grown on
+    demand. A contraction applied from several threads at once, through a
+    shared CeedBasis, uses temporary scratch while the kept scratch is in use.
+
+  @param contract   CeedTensorContract to use
+  @param eo         Even-odd decomposition of the matrix
+  @param A          First index of u, v
+  @param B          Middle index of u
+  @param C          Last index of u, v
+  @param J          Middle index of v
+  @param tmode      Transpose mode for the matrix
+  @param add        Add mode
+  @param[in] u      Input array
+  @param[out] v     Output array
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedTensorContractApplyEvenOdd(CeedTensorContract contract,
+    const CeedTensorContractEvenOdd *eo, CeedInt A, CeedInt B, CeedInt C,
+    CeedInt J, CeedTransposeMode tmode, const CeedInt add,
+    const CeedScalar *restrict u, CeedScalar *restrict v) {
+  int ierr = 0;
+  const CeedInt worksize = A*(B + 2*((J+1)/2))*C;
+  bool busy = false;
+
+  if (!CeedAtomicCompareExchange(contract->evenoddworkbusy, busy, true)) {
+    CeedScalar *work;
+    ierr = CeedMalloc(worksize, &work); CeedChk(ierr);
+    ierr = CeedTensorContractApplyEvenOddWork(contract, eo, A, B, C, J, tmode,
+           add, u, v, work);
+    CeedFree(&work);
+    CeedChk(ierr);
+    return 0;
+  }
+  if (worksize > contract->evenoddworksize) {
+    ierr = CeedRealloc(worksize, &contract->evenoddwork);
+    if (!ierr)
+      contract->evenoddworksize = worksize;
+  }
+  if (!ierr)
+    ierr = CeedTensorContractApplyEvenOddWork(contract, eo, A, B, C, J, tmode,
+           add, u, v, contract->evenoddwork);
+  busy = true;
+  CeedAtomicCompareExchange(contract->evenoddworkbusy, busy, false);
+  CeedChk(ierr);
+  return 0;
+}
+
+/// @}
+
 /// ----------------------------------------------------------------------------
 /// CeedTensorContract Backend API
 /// ----------------------------------------------------------------------------
@@ -60,9 +201,95 @@ int CeedTensorContractCreate(Ceed ceed, CeedBasis basis,
   ierr = CeedCalloc(1,contract); CeedChk(ierr);
 
   (*contract)->ceed = ceed;
-  ceed->refcount++;
+  CeedAtomicAdd(ceed->refcount, 1);
   ierr = ceed->TensorContractCreate(basis, *contract);
   CeedChk(ierr);
+
+  // Even-odd decomposition of 1D basis matrices
+  if (basis->tensorbasis) {
+    ierr = CeedTensorContractAddEvenOdd(*contract, basis->interp1d, basis->Q1d,
+                                        basis->P1d); CeedChk(ierr);
+    ierr = CeedTensorContractAddEvenOdd(*contract, basis->grad1d, basis->Q1d,
+                                        basis->P1d); CeedChk(ierr);
+  }
+  return 0;
+}
+
+/**
+  @brief Add a matrix with an even-odd decomposition to a CeedTensorContract
+
+  If the J x B matrix t is centrosymmetric, t_jb = t_(J-1-j)(B-1-b), or
+    skew-centrosymmetric, t_jb = -t_(J-1-j)(B-1-b), then
+    CeedTensorContractApply() with t replaces the contraction by two
+    contractions with its even and odd parts, which roughly halves the number
+    of flops. The 1D interpolation and gradient matrices for nodes and
+    quadrature points symmetric about the element center have this property.
+    This function has no effect on other matrices.
+
+  CeedTensorContractCreate() adds the 1D interpolation and gradient matrices of
+    tensor bases. Backends may add other matrices, such as the collocated
+    gradient.
+
+  @param contract  CeedTensorContract
+  @param[in] t     Row-major J x B matrix, identified by its address in
+                     CeedTensorContractApply(); it must remain valid for the
+                     lifetime of @a contract
+  @param J         Number of rows of t
+  @param B         Number of columns of t
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedTensorContractAddEvenOdd(CeedTensorContract contract,
+                                 const CeedScalar *t, CeedInt J, CeedInt B) {
+  int ierr;
+
+  if (!t || J < 2 || B < 2 ||
+      contract->numevenodd == CEED_TENSOR_EVENODD_MAX)
+    return 0;
+  for (CeedInt i=0; i<contract->numevenodd; i++)
+    if (contract->evenodd[i].t == t)
+      return 0;
+
+  // Check for symmetry, up to roundoff in the computed nodes
+  CeedScalar tmax = 0.0;
+  for (CeedInt i=0; i<J*B; i++)
+    tmax = fabs(t[i]) > tmax ? fabs(t[i]) : tmax;
+  const CeedScalar tol = 1e-14*tmax;
+  bool symmetric = tmax > 0.0, skew = tmax > 0.0;
+  for (CeedInt i=0; i<J*B; i++) {
+    symmetric = symmetric && fabs(t[i] - t[J*B-1-i]) <= tol;
+    skew = skew && fabs(t[i] + t[J*B-1-i]) <= tol;
+  }
+  if (!symmetric && !skew)
+    return 0;
+
+  // Even and odd parts of the first half of the rows of T = t or T = t^T,
+  //   T_jb = t[j*s0 + b*s1]
+  CeedTensorContractEvenOdd *eo = &contract->evenodd[contract->numevenodd];
+  eo->t = t;
+  eo->J = J;
+  eo->B = B;
+  eo->parity = symmetric ? 1 : -1;
+  for (CeedInt tmode=0; tmode<2; tmode++) {
+    const CeedInt Jt = tmode ? B : J, Bt = tmode ? J : B;
+    const CeedInt Jh = (Jt+1)/2, Be = (Bt+1)/2, Bo = Bt/2;
+    const CeedInt s0 = tmode ? 1 : B, s1 = tmode ? B : 1;
+    ierr = CeedMalloc(Jh*Be, &eo->even[tmode]); CeedChk(ierr);
+    ierr = CeedMalloc(Jh*Bo, &eo->odd[tmode]); CeedChk(ierr);
+    for (CeedInt j=0; j<Jh; j++) {
+      for (CeedInt b=0; b<Bo; b++) {
+        const CeedScalar t0 = t[j*s0+b*s1], t1 = t[j*s0+(Bt-1-b)*s1];
+        eo->even[tmode][j*Be+b] = 0.5*(t0 + t1);
+        eo->odd[tmode][j*Bo+b] = 0.5*(t0 - t1);
+      }
+      if (Be > Bo)
+        eo->even[tmode][j*Be+Bo] = t[j*s0+Bo*s1];
+    }
+  }
+  contract->numevenodd++;
+
   return 0;
 }
 
@@ -97,6 +324,17 @@ int CeedTensorContractApply(CeedTensorContract contract, CeedInt A, CeedInt B,
                             CeedScalar *restrict v) {
   int ierr;
 
+  // Even-odd decomposition
+  for (CeedInt i=0; i<contract->numevenodd; i++) {
+    const CeedTensorContractEvenOdd *eo = &contract->evenodd[i];
+    const CeedInt Jt = tmode ? eo->B : eo->J, Bt = tmode ? eo->J : eo->B;
+    if (eo->t == t && J == Jt && B == Bt) {
+      ierr = CeedTensorContractApplyEvenOdd(contract, eo, A, B, C, J, tmode,
+                                            add, u, v); CeedChk(ierr);
+      return 0;
+    }
+  }
+
   ierr = contract->Apply(contract, A, B, C, J, t, tmode, add,  u, v);
   CeedChk(ierr);
   return 0;
@@ -159,10 +397,16 @@ int CeedTensorContractSetData(CeedTensorContract contract, void *data) {
 int CeedTensorContractDestroy(CeedTensorContract *contract) {
   int ierr;
 
-  if (!*contract || --(*contract)->refcount > 0) return 0;
+  if (!*contract || CeedAtomicAdd((*contract)->refcount, -1) > 0) return 0;
   if ((*contract)->Destroy) {
     ierr = (*contract)->Destroy(*contract); CeedChk(ierr);
   }
+  for (CeedInt i=0; i<(*contract)->numevenodd; i++)
+    for (CeedInt tmode=0; tmode<2; tmode++) {
+      ierr = CeedFree(&(*contract)->evenodd[i].even[tmode]); CeedChk(ierr);
+      ierr = CeedFree(&(*contract)->evenodd[i].odd[tmode]); CeedChk(ierr);
+    }
+  ierr = CeedFree(&(*contract)->evenoddwork); CeedChk(ierr);
   ierr = CeedDestroy(&(*contract)->ceed); CeedChk(ierr);
   ierr = CeedFree(contract); CeedChk(ierr);
   return 0;
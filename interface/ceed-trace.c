@@ -0,0 +1,534 @@
+// Copyright (c) 2017, Lawrence Livermore National Security, LLC. Produced at
+// the Lawrence Livermore National Laboratory. LLNL-CODE-734707. All Rights
+// reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#define _POSIX_C_SOURCE 200112
+#ifdef __linux__
+#  define _DEFAULT_SOURCE // syscall()
+#endif
+#include <ceed-impl.h>
+#include <ceed-backend.h>
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#ifdef __linux__
+#  include <linux/perf_event.h>
+#  include <sys/ioctl.h>
+#  include <sys/syscall.h>
+#endif
+
+/// @cond DOXYGEN_SKIP
+// Trace event file shared by all Ceed contexts, in the JSON array format of
+//   the Chrome trace viewer, and per stage totals of operators
+static struct {
+  bool enabled;          /* trace file open for events */
+  bool counting;         /* per stage totals recorded */
+  bool lock;
+  bool empty;            /* no event written yet */
+  int numceeds;          /* Ceed contexts not yet destroyed */
+  int numthreads;        /* threads that have written an event */
+  unsigned countermask;  /* counters opened by any thread */
+  unsigned generation;   /* counter groups opened since the last finalize */
+  int *counterfds;       /* counter file descriptors of all threads */
+  int numcounterfds;
+  FILE *file;
+  long end;              /* offset of the closing bracket */
+  double start;          /* time of the first CeedInit, in seconds */
+} ceed_trace;
+
+static const char *const CeedTraceCategories[] = {
+  [CEED_TRACE_RESTRICTION] = "restriction",
+  [CEED_TRACE_BASIS] = "basis",
+  [CEED_TRACE_QFUNCTION] = "qfunction",
+  [CEED_TRACE_OPERATOR] = "operator",
+  [CEED_TRACE_ASSEMBLY] = "assembly",
+};
+
+static const char *const CeedCounterNames[] = {
+  [CEED_COUNTER_CYCLES] = "cycles",
+  [CEED_COUNTER_INSTRUCTIONS] = "instructions",
+  [CEED_COUNTER_L1D_LOADS] = "l1d_loads",
+  [CEED_COUNTER_L1D_LOAD_MISSES] = "l1d_load_misses",
+  [CEED_COUNTER_LLC_REFERENCES] = "llc_references",
+  [CEED_COUNTER_LLC_MISSES] = "llc_misses",
+};
+
+#if defined(__GNUC__) || defined(__clang__)
+#  define CeedTraceLock() \
+  while (__atomic_test_and_set(&ceed_trace.lock, __ATOMIC_ACQUIRE)) {}
+#  define CeedTraceUnlock() __atomic_clear(&ceed_trace.lock, __ATOMIC_RELEASE)
+#  define CeedThreadLocal __thread
+#else
+#  define CeedTraceLock()
+#  define CeedTraceUnlock()
+#  define CeedThreadLocal
+#endif
+static CeedThreadLocal int ceed_trace_tid;
+static CeedThreadLocal CeedOperator ceed_trace_op; /* operator being applied */
+
+// Counter group of each thread
+static CeedThreadLocal struct {
+  bool opened;
+  unsigned generation;                  /* generation of the open group */
+  int numopen;
+  CeedCounter index[CEED_NUM_COUNTERS]; /* counter of each group member */
+  int fds[CEED_NUM_COUNTERS];           /* group leader first */
+} ceed_counters;
+/// @endcond
+
+/// @file
+/// Implementation of trace event timeline output and operator stage totals
+
+/// ----------------------------------------------------------------------------
+/// Ceed Library Internal Functions
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedDeveloper
+/// @{
+
+/**
+  @brief Get the current time in seconds for trace events
+
+  @return Monotonic wall clock time, in seconds
+
+  @ref Developer
+**/
+static double CeedTraceTime(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1e-9*ts.tv_nsec;
+}
+
+/**
+  @brief Open the hardware counters of the calling thread as one group
+
+  Counters that are not supported, or not permitted by
+    /proc/sys/kernel/perf_event_paranoid, are left out of the group. Only user
+    space events of the calling thread are counted.
+
+  @ref Developer
+**/
+static void CeedCountersOpen(void) {
+  ceed_counters.opened = true;
+  ceed_counters.numopen = 0;
+#ifdef __linux__
+  const uint64_t l1dread = PERF_COUNT_HW_CACHE_L1D |
+                           (PERF_COUNT_HW_CACHE_OP_READ << 8);
+  const struct {
+    uint32_t type;
+    uint64_t config;
+  } events[CEED_NUM_COUNTERS] = {
+    [CEED_COUNTER_CYCLES] = {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    [CEED_COUNTER_INSTRUCTIONS] = {PERF_TYPE_HARDWARE,
+                                   PERF_COUNT_HW_INSTRUCTIONS
+                                  },
+    [CEED_COUNTER_L1D_LOADS] = {PERF_TYPE_HW_CACHE, l1dread |
+                                (PERF_COUNT_HW_CACHE_RESULT_ACCESS << 16)
+                               },
+    [CEED_COUNTER_L1D_LOAD_MISSES] = {PERF_TYPE_HW_CACHE, l1dread |
+                                      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)
+                                     },
+    [CEED_COUNTER_LLC_REFERENCES] = {PERF_TYPE_HARDWARE,
+                                     PERF_COUNT_HW_CACHE_REFERENCES
+                                    },
+    [CEED_COUNTER_LLC_MISSES] = {PERF_TYPE_HARDWARE,
+                                 PERF_COUNT_HW_CACHE_MISSES
+                                },
+  };
+  unsigned mask = 0;
+
+  for (CeedInt i=0; i<CEED_NUM_COUNTERS; i++) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = events[i].type;
+    attr.config = events[i].config;
+    attr.read_format = PERF_FORMAT_GROUP;
+    attr.disabled = !ceed_counters.numopen;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    int leader = ceed_counters.numopen ? ceed_counters.fds[0] : -1;
+    int fd = syscall(SYS_perf_event_open, &attr, 0, -1, leader, 0);
+    if (fd < 0)
+      continue;
+    ceed_counters.index[ceed_counters.numopen] = (CeedCounter)i;
+    ceed_counters.fds[ceed_counters.numopen++] = fd;
+    mask |= 1u << i;
+  }
+
+  // Record the group, so it is closed with the counters of other threads
+  CeedTraceLock();
+  ceed_counters.generation = ceed_trace.generation;
+  if (ceed_counters.numopen &&
+      CeedRealloc(ceed_trace.numcounterfds + ceed_counters.numopen,
+                  &ceed_trace.counterfds)) {
+    // LCOV_EXCL_START
+    for (CeedInt i=ceed_counters.numopen-1; i>=0; i--)
+      close(ceed_counters.fds[i]);
+    ceed_counters.numopen = 0;
+    mask = 0;
+    // LCOV_EXCL_STOP
+  }
+  for (CeedInt i=0; i<ceed_counters.numopen; i++)
+    ceed_trace.counterfds[ceed_trace.numcounterfds++] = ceed_counters.fds[i];
+  ceed_trace.countermask |= mask;
+  CeedTraceUnlock();
+  if (ceed_counters.numopen)
+    ioctl(ceed_counters.fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#else
+  CeedTraceLock();
+  ceed_counters.generation = ceed_trace.generation;
+  CeedTraceUnlock();
+#endif
+}
+
+/**
+  @brief Close the hardware counters of all threads; called with the trace
+           lock held
+
+  Threads open their counters again at their next read.
+
+  @ref Developer
+**/
+static void CeedCountersClose(void) {
+  for (CeedInt i=ceed_trace.numcounterfds-1; i>=0; i--)
+    close(ceed_trace.counterfds[i]);
+  CeedFree(&ceed_trace.counterfds);
+  ceed_trace.numcounterfds = 0;
+  ceed_trace.countermask = 0;
+  ceed_trace.generation++;
+  ceed_counters.opened = false;
+  ceed_counters.numopen = 0;
+}
+
+/**
+  @brief Read the hardware counters of the calling thread
+
+  @param[out] counters  Array of CEED_NUM_COUNTERS counts, 0 for counters that
+                          are not open
+
+  @ref Developer
+**/
+static void CeedCountersRead(uint64_t *counters) {
+  uint64_t values[CEED_NUM_COUNTERS+1];
+
+  memset(counters, 0, CEED_NUM_COUNTERS*sizeof(*counters));
+  CeedTraceLock();
+  bool closed = ceed_counters.generation != ceed_trace.generation;
+  CeedTraceUnlock();
+  if (!ceed_counters.opened || closed)
+    CeedCountersOpen();
+  if (!ceed_counters.numopen ||
+      read(ceed_counters.fds[0], values, sizeof(values)) <= 0)
+    return;
+  for (uint64_t i=0; i<values[0] && i<(uint64_t)ceed_counters.numopen; i++)
+    counters[ceed_counters.index[i]] = values[i+1];
+}
+
+/**
+  @brief Write a string to the trace file as a JSON string
+
+  @param str  String to write
+
+  @ref Developer
+**/
+static void CeedTraceWriteString(const char *str) {
+  fputc('"', ceed_trace.file);
+  for (; *str; str++) {
+    if (*str == '"' || *str == '\\')
+      fprintf(ceed_trace.file, "\\%c", *str);
+    else if ((unsigned char)*str < 0x20)
+      fprintf(ceed_trace.file, "\\u%04x", (unsigned char)*str);
+    else
+      fputc(*str, ceed_trace.file);
+  }
+  fputc('"', ceed_trace.file);
+}
+
+/**
+  @brief Register a Ceed context with the trace, opening the trace file named
+           by the environment variable CEED_TRACE at the first CeedInit(), and
+           recording per stage totals of operators if the environment variable
+           CEED_PERF_COUNTERS is set
+
+  The trace file is completed each time the last Ceed context is destroyed, and
+    events of Ceed contexts created afterwards are appended to it.
+
+  @param ceed  Ceed context
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedTraceInit(Ceed ceed) {
+  const char *filename = getenv("CEED_TRACE");
+  const char *counters = getenv("CEED_PERF_COUNTERS");
+  bool trace = filename && *filename, counting = counters && *counters;
+  if (!trace && !counting)
+    return 0;
+
+  CeedTraceLock();
+  if (trace && !ceed_trace.file) {
+    ceed_trace.file = fopen(filename, "w");
+    if (!ceed_trace.file) {
+      // LCOV_EXCL_START
+      CeedTraceUnlock();
+      return CeedError(ceed, 1, "Cannot open trace file %s", filename);
+      // LCOV_EXCL_STOP
+    }
+    fprintf(ceed_trace.file, "[\n");
+    ceed_trace.empty = true;
+    ceed_trace.start = CeedTraceTime();
+  } else if (trace && !ceed_trace.enabled) {
+    // Reopen the completed trace
+    fseek(ceed_trace.file, ceed_trace.end, SEEK_SET);
+  }
+  ceed_trace.numceeds++;
+  ceed_trace.enabled |= trace;
+  ceed_trace.counting |= counting;
+  CeedTraceUnlock();
+  ceed->traced = true;
+
+  return 0;
+}
+
+/**
+  @brief Unregister a Ceed context registered by CeedTraceInit(), completing
+           the trace file when no Ceed context is left
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedTraceFinalize(void) {
+  CeedTraceLock();
+  if (!--ceed_trace.numceeds) {
+    if (ceed_trace.enabled) {
+      ceed_trace.end = ftell(ceed_trace.file);
+      fprintf(ceed_trace.file, "\n]\n");
+      fflush(ceed_trace.file);
+    }
+    ceed_trace.enabled = false;
+    ceed_trace.counting = false;
+    CeedCountersClose();
+  }
+  CeedTraceUnlock();
+
+  return 0;
+}
+
+/**
+  @brief Start a trace span
+
+  @param[in] op      CeedOperator applied in the span, whose stages are the
+                       restriction, basis, and QFunction spans it contains, or
+                       NULL
+  @param[out] start  Time and counters at the start of the span; the time is 0
+                       if neither tracing nor counting is enabled
+
+  @ref Developer
+**/
+void CeedTraceStart(CeedOperator op, CeedTraceSample *start) {
+  start->time = 0.0;
+  if (!ceed_trace.enabled && !ceed_trace.counting)
+    return;
+
+  start->op = op;
+  if (op) {
+    start->prevop = ceed_trace_op;
+    ceed_trace_op = op;
+  }
+  if (ceed_trace.counting)
+    CeedCountersRead(start->counters);
+  start->time = CeedTraceTime();
+}
+
+/**
+  @brief End a trace span started by CeedTraceStart() without an event, when
+           the call of the span fails
+
+  @param[in] start  Start of the span, from CeedTraceStart()
+
+  @ref Developer
+**/
+void CeedTraceAbort(const CeedTraceSample *start) {
+  if (start->time != 0.0 && start->op)
+    ceed_trace_op = start->prevop;
+}
+
+/**
+  @brief End a trace span started by CeedTraceStart()
+
+  With CEED_TRACE, this writes a complete trace event carrying the Ceed
+    resource, the label, the counter deltas, and the arguments in format, a
+    list of comma separated JSON members such as "\"elements\": %d". Spans of
+    one thread nest by time in the timeline. With CEED_PERF_COUNTERS, the time,
+    counters, and flops are added to the totals of the operator of the span, or
+    to the totals of the stage of the operator being applied.
+
+  @param ceed      Ceed context
+  @param category  Category of the span
+  @param name      Name of the span, typically the interface function
+  @param start     Start of the span, from CeedTraceStart()
+  @param flops     Estimated flops of the span, or 0 if unknown
+  @param label     Name of the object, or NULL
+  @param format    printf-style format of additional JSON members, or NULL
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedTraceSpan(Ceed ceed, CeedTraceCategory category, const char *name,
+                  const CeedTraceSample *start, double flops,
+                  const char *label, const char *format, ...) {
+  int ierr;
+  uint64_t counters[CEED_NUM_COUNTERS] = {0};
+  if (start->time == 0.0)
+    return 0;
+  double end = CeedTraceTime();
+  if (ceed_trace.counting) {
+    CeedCountersRead(counters);
+    for (CeedInt i=0; i<CEED_NUM_COUNTERS; i++)
+      counters[i] -= start->counters[i];
+  }
+  if (start->op)
+    ceed_trace_op = start->prevop;
+
+  // Totals of the operator, or of a stage of the operator being applied;
+  //   nested calls on the same operator count once
+  CeedOperator op = category < CEED_TRACE_OPERATOR ? ceed_trace_op : NULL;
+  if (category == CEED_TRACE_OPERATOR && start->prevop != start->op)
+    op = start->op;
+  if (ceed_trace.counting && op) {
+    if (!op->stagestats) {
+      // The operator may be applied from several threads
+      CeedStageStats *stats, *none = NULL;
+      ierr = CeedCalloc(CEED_TRACE_OPERATOR+1, &stats); CeedChk(ierr);
+      if (!CeedAtomicCompareExchange(op->stagestats, none, stats)) {
+        ierr = CeedFree(&stats); CeedChk(ierr);
+      }
+    }
+    CeedTraceLock();
+    CeedStageStats *stats = &op->stagestats[category];
+    stats->calls++;
+    stats->time += end - start->time;
+    stats->flops += flops;
+    for (CeedInt i=0; i<CEED_NUM_COUNTERS; i++)
+      stats->counters[i] += counters[i];
+    CeedTraceUnlock();
+  }
+
+  if (!ceed_trace.enabled)
+    return 0;
+  CeedTraceLock();
+  if (!ceed_trace_tid)
+    ceed_trace_tid = ++ceed_trace.numthreads;
+  fprintf(ceed_trace.file, "%s{\"name\": \"%s\", \"cat\": \"%s\", "
+          "\"ph\": \"X\", \"ts\": %.3f, \"dur\": %.3f, \"pid\": %d, "
+          "\"tid\": %d, \"args\": {\"resource\": ",
+          ceed_trace.empty ? "" : ",\n", name, CeedTraceCategories[category],
+          1e6*(start->time - ceed_trace.start), 1e6*(end - start->time),
+          (int)getpid(), ceed_trace_tid);
+  CeedTraceWriteString(ceed && ceed->resource ? ceed->resource : "");
+  if (label) {
+    fprintf(ceed_trace.file, ", \"name\": ");
+    CeedTraceWriteString(label);
+  }
+  if (format) {
+    va_list args;
+    va_start(args, format);
+    fprintf(ceed_trace.file, ", ");
+    vfprintf(ceed_trace.file, format, args);
+    va_end(args);
+  }
+  if (flops > 0)
+    fprintf(ceed_trace.file, ", \"flops\": %.0f", flops);
+  for (CeedInt i=0; i<CEED_NUM_COUNTERS; i++)
+    if (ceed_trace.counting && ceed_trace.countermask & (1u << i))
+      fprintf(ceed_trace.file, ", \"%s\": %" PRIu64, CeedCounterNames[i],
+              counters[i]);
+  fprintf(ceed_trace.file, "}}");
+  ceed_trace.empty = false;
+  CeedTraceUnlock();
+
+  return 0;
+}
+
+/**
+  @brief View the totals of the stages and applications of an operator, with
+           metrics derived from the hardware counters
+
+  Bandwidth is estimated from last level cache misses, at 64 bytes per miss,
+    and flop rates from the estimated flops of basis actions and transpose
+    restrictions. Metrics of counters that could not be opened are shown as
+    "-".
+
+  @param[in] stats   Totals of each stage, then of the operator applications,
+                       or NULL
+  @param[in] indent  Indentation of each line
+  @param[in] stream  Stream to write; typically stdout/stderr or a file
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedTraceViewStats(const CeedStageStats *stats, const char *indent,
+                       FILE *stream) {
+  const char *names[] = {"restriction", "basis", "qfunction", "total"};
+  const unsigned mask = ceed_trace.countermask;
+  const bool ipc = (mask & 3u) == 3u, l1d = (mask & 12u) == 12u,
+             llc = (mask & 48u) == 48u;
+
+  if (!stats) {
+    fprintf(stream, "%sNo applications recorded; set CEED_PERF_COUNTERS\n",
+            indent);
+    return 0;
+  }
+  fprintf(stream, "%s%-12s %8s %11s %9s %9s %6s %9s %9s\n", indent, "Stage",
+          "Calls", "Time (s)", "GFLOP/s", "GB/s", "IPC", "L1D miss",
+          "LLC miss");
+  for (CeedInt i=0; i<=CEED_TRACE_OPERATOR; i++) {
+    const uint64_t *c = stats[i].counters;
+    const double t = stats[i].time > 0 ? stats[i].time : 1;
+    double flops = stats[i].flops;
+    if (i == CEED_TRACE_OPERATOR)
+      for (CeedInt j=0; j<CEED_TRACE_OPERATOR; j++)
+        flops += stats[j].flops;
+    const uint64_t cycles = c[CEED_COUNTER_CYCLES],
+                   l1dloads = c[CEED_COUNTER_L1D_LOADS],
+                   llcrefs = c[CEED_COUNTER_LLC_REFERENCES];
+    char rates[5][16];
+
+    snprintf(rates[0], 16, flops > 0 ? "%.2f" : "-", 1e-9*flops/t);
+    snprintf(rates[1], 16, llc ? "%.2f" : "-",
+             64e-9*c[CEED_COUNTER_LLC_MISSES]/t);
+    snprintf(rates[2], 16, ipc && cycles ? "%.2f" : "-",
+             (double)c[CEED_COUNTER_INSTRUCTIONS]/(cycles ? cycles : 1));
+    snprintf(rates[3], 16, l1d && l1dloads ? "%.1f%%" : "-",
+             100.0*c[CEED_COUNTER_L1D_LOAD_MISSES]/(l1dloads ? l1dloads : 1));
+    snprintf(rates[4], 16, llc && llcrefs ? "%.1f%%" : "-",
+             100.0*c[CEED_COUNTER_LLC_MISSES]/(llcrefs ? llcrefs : 1));
+    fprintf(stream, "%s%-12s %8d %11.3e %9s %9s %6s %9s %9s\n", indent,
+            names[i], stats[i].calls, stats[i].time, rates[0], rates[1],
+            rates[2], rates[3], rates[4]);
+  }
+
+  return 0;
+}
+
+/// @}
@@ -55,3 +55,27 @@ const char *const CeedElemTopologies[] = {
   [CEED_PRISM] = "prism",
   [CEED_HEX] = "hexahedron",
 };
+
+const char *const CeedOperatorStrategies[] = {
+  [CEED_STRATEGY_MATRIX_FREE] = "matrix-free",
+  [CEED_STRATEGY_ASSEMBLED] = "assembled",
+  [CEED_STRATEGY_AUTO] = "auto",
+};
+
+const char *const CeedFieldPrecisions[] = {
+  [CEED_PRECISION_SCALAR] = "CeedScalar",
+  [CEED_PRECISION_FP32] = "FP32",
+  [CEED_PRECISION_BF16] = "BF16",
+};
+
+const char *const CeedMemoryCategories[] = {
+  [CEED_MEMORY_OFFSETS] = "restriction offsets",
+  [CEED_MEMORY_BASIS] = "basis matrices",
+  [CEED_MEMORY_PASSIVE] = "passive inputs",
+  [CEED_MEMORY_EVEC] = "E-vector work",
+  [CEED_MEMORY_QVEC] = "Q-vector work",
+  [CEED_MEMORY_LVEC] = "L-vector work",
+  [CEED_MEMORY_ASSEMBLED] = "assembled matrix",
+  [CEED_MEMORY_FALLBACK] = "fallback operator",
+  [CEED_MEMORY_TOTAL] = "total",
+};
@@ -84,7 +84,7 @@ int CeedVectorGetState(CeedVector vec, uint64_t *state) {
   @ref Backend
 **/
 int CeedVectorAddReference(CeedVector vec) {
-  vec->refcount++;
+  CeedAtomicAdd(vec->refcount, 1);
   return 0;
 }
 
@@ -156,7 +156,7 @@ int CeedVectorCreate(Ceed ceed, CeedInt length, CeedVector *vec) {
 
   ierr = CeedCalloc(1,vec); CeedChk(ierr);
   (*vec)->ceed = ceed;
-  ceed->refcount++;
+  CeedAtomicAdd(ceed->refcount, 1);
   (*vec)->refcount = 1;
   (*vec)->length = length;
   (*vec)->state = 0;
@@ -198,7 +198,7 @@ int CeedVectorSetArray(CeedVector vec, CeedMemType mtype, CeedCopyMode cmode,
                      "process has read access");
 
   ierr = vec->SetArray(vec, mtype, cmode, array); CeedChk(ierr);
-  vec->state += 2;
+  CeedAtomicAdd(vec->state, 2);
 
   return 0;
 }
@@ -229,7 +229,7 @@ int CeedVectorSetValue(CeedVector vec, CeedScalar value) {
     ierr = CeedVectorRestoreArray(vec, &array); CeedChk(ierr);
   }
 
-  vec->state += 2;
+  CeedAtomicAdd(vec->state, 2);
 
   return 0;
 }
@@ -296,6 +296,7 @@ int CeedVectorTakeArray(CeedVector vec, CeedMemType mtype, CeedScalar **array) {
 
   CeedScalar *tempArray = NULL;
   ierr = vec->TakeArray(vec, mtype, &tempArray); CeedChk(ierr);
+  ierr = CeedUntrackArray(tempArray); CeedChk(ierr);
   if (array)
     (*array) = tempArray;
   return 0;
@@ -336,7 +337,7 @@ int CeedVectorGetArray(CeedVector vec, CeedMemType mtype, CeedScalar **array) {
                      "process has read access");
 
   ierr = vec->GetArray(vec, mtype, array); CeedChk(ierr);
-  vec->state += 1;
+  CeedAtomicAdd(vec->state, 1);
 
   return 0;
 }
@@ -369,7 +370,7 @@ int CeedVectorGetArrayRead(CeedVector vec, CeedMemType mtype,
                      "access, the access lock is already in use");
 
   ierr = vec->GetArrayRead(vec, mtype, array); CeedChk(ierr);
-  vec->numreaders++;
+  CeedAtomicAdd(vec->numreaders, 1);
 
   return 0;
 }
@@ -398,7 +399,7 @@ int CeedVectorRestoreArray(CeedVector vec, CeedScalar **array) {
 
   ierr = vec->RestoreArray(vec); CeedChk(ierr);
   *array = NULL;
-  vec->state += 1;
+  CeedAtomicAdd(vec->state, 1);
 
   return 0;
 }
@@ -423,7 +424,7 @@ int CeedVectorRestoreArrayRead(CeedVector vec, const CeedScalar **array) {
 
   ierr = vec->RestoreArrayRead(vec); CeedChk(ierr);
   *array = NULL;
-  vec->numreaders--;
+  CeedAtomicAdd(vec->numreaders, -1);
 
   return 0;
 }
@@ -518,6 +519,98 @@ int CeedVectorReciprocal(CeedVector vec) {
   return 0;
 }
 
+/**
+  @brief Scale a CeedVector, x = alpha x
+
+  @param[in,out] x  CeedVector to scale
+  @param[in] alpha  Scaling factor
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorScale(CeedVector x, CeedScalar alpha) {
+  int ierr;
+
+  // Check data
+  if (!x->state)
+    // LCOV_EXCL_START
+    return CeedError(x->ceed, 1, "CeedVector must have data set to scale");
+  // LCOV_EXCL_STOP
+
+  // Backend impl for GPU, if added
+  if (x->Scale) {
+    ierr = x->Scale(x, alpha); CeedChk(ierr);
+    return 0;
+  }
+
+  CeedScalar *array;
+  ierr = CeedVectorGetArray(x, CEED_MEM_HOST, &array); CeedChk(ierr);
+  for (CeedInt i=0; i<x->length; i++)
+    array[i] *= alpha;
+  ierr = CeedVectorRestoreArray(x, &array); CeedChk(ierr);
+
+  return 0;
+}
+
+/**
+  @brief Compute the pointwise product w = x .* y of two CeedVectors
+
+  Any of the vectors may be the same CeedVector, e.g. to scale w in place by y.
+
+  @param[out] w  Target CeedVector for the product
+  @param[in] x   First CeedVector factor
+  @param[in] y   Second CeedVector factor
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorPointwiseMult(CeedVector w, CeedVector x, CeedVector y) {
+  int ierr;
+
+  // Check compatibility
+  if (w->length != x->length || w->length != y->length)
+    // LCOV_EXCL_START
+    return CeedError(w->ceed, 1, "Cannot multiply vectors of different lengths "
+                     "(%d, %d, %d)", w->length, x->length, y->length);
+  // LCOV_EXCL_STOP
+  if (!x->state || !y->state)
+    // LCOV_EXCL_START
+    return CeedError(w->ceed, 1,
+                     "CeedVector must have data set to take pointwise product");
+  // LCOV_EXCL_STOP
+
+  // Backend impl for GPU, if added
+  if (w->PointwiseMult) {
+    ierr = w->PointwiseMult(w, x, y); CeedChk(ierr);
+    return 0;
+  }
+
+  CeedScalar *warray;
+  const CeedScalar *xarray = NULL, *yarray = NULL;
+  ierr = CeedVectorGetArray(w, CEED_MEM_HOST, &warray); CeedChk(ierr);
+  if (x != w) {
+    ierr = CeedVectorGetArrayRead(x, CEED_MEM_HOST, &xarray); CeedChk(ierr);
+  }
+  if (y != w && y != x) {
+    ierr = CeedVectorGetArrayRead(y, CEED_MEM_HOST, &yarray); CeedChk(ierr);
+  }
+  const CeedScalar *xvals = x == w ? warray : xarray;
+  const CeedScalar *yvals = y == w ? warray : (y == x ? xvals : yarray);
+  for (CeedInt i=0; i<w->length; i++)
+    warray[i] = xvals[i]*yvals[i];
+  if (xarray) {
+    ierr = CeedVectorRestoreArrayRead(x, &xarray); CeedChk(ierr);
+  }
+  if (yarray) {
+    ierr = CeedVectorRestoreArrayRead(y, &yarray); CeedChk(ierr);
+  }
+  ierr = CeedVectorRestoreArray(w, &warray); CeedChk(ierr);
+
+  return 0;
+}
+
 /**
   @brief View a CeedVector
 
@@ -560,6 +653,30 @@ int CeedVectorGetLength(CeedVector vec, CeedInt *length) {
   return 0;
 }
 
+/**
+  @brief Get the number of bytes of memory held by a CeedVector
+
+  Arrays provided with @ref CEED_USE_POINTER are not counted. Backends that do
+    not report their usage are assumed to hold one array of the vector length.
+
+  @param vec          CeedVector
+  @param[out] bytes   Variable to store the number of bytes
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorGetMemoryUsage(CeedVector vec, size_t *bytes) {
+  int ierr;
+
+  if (vec->GetMemoryUsage) {
+    ierr = vec->GetMemoryUsage(vec, bytes); CeedChk(ierr);
+  } else {
+    *bytes = (size_t)vec->length * sizeof(CeedScalar);
+  }
+  return 0;
+}
+
 /**
   @brief Destroy a CeedVector
 
@@ -572,7 +689,7 @@ int CeedVectorGetLength(CeedVector vec, CeedInt *length) {
 int CeedVectorDestroy(CeedVector *vec) {
   int ierr;
 
-  if (!*vec || --(*vec)->refcount > 0) return 0;
+  if (!*vec || CeedAtomicAdd((*vec)->refcount, -1) > 0) return 0;
 
   if (((*vec)->state % 2) == 1)
     return CeedError((*vec)->ceed, 1,
@@ -37,6 +37,38 @@ static size_t num_backends;
 
 #define CEED_FTABLE_ENTRY(class, method) \
   {#class #method, offsetof(struct class ##_private, method)}
+
+// Open addressing table of tracked host allocations
+typedef struct {
+  const void *ptr;
+  size_t bytes;
+} CeedMemoryEntry;
+
+static struct {
+  bool enabled;
+  bool tracked; /* tracking is or has been enabled */
+  bool lock;
+  size_t current, peak;
+  CeedMemoryEntry *entries;
+  size_t size;  /* table size, a power of 2 */
+  size_t count; /* number of tracked allocations */
+  size_t used;  /* number of tracked and removed entries */
+} ceed_memory;
+static char ceed_memory_removed; /* marks removed entries */
+
+#if defined(__GNUC__) || defined(__clang__)
+#  define CeedMemoryLock() \
+  while (__atomic_test_and_set(&ceed_memory.lock, __ATOMIC_ACQUIRE)) {}
+#  define CeedMemoryUnlock() __atomic_clear(&ceed_memory.lock, __ATOMIC_RELEASE)
+#  define CeedMemoryFlag(x) __atomic_load_n(&ceed_memory.x, __ATOMIC_ACQUIRE)
+#  define CeedMemorySetFlag(x, v) \
+  __atomic_store_n(&ceed_memory.x, (v), __ATOMIC_RELEASE)
+#else
+#  define CeedMemoryLock()
+#  define CeedMemoryUnlock()
+#  define CeedMemoryFlag(x) (ceed_memory.x)
+#  define CeedMemorySetFlag(x, v) (ceed_memory.x = (v))
+#endif
 /// @endcond
 
 /// @file
@@ -119,6 +151,104 @@ int CeedRequestWait(CeedRequest *req) {
 /// @addtogroup CeedDeveloper
 /// @{
 
+/**
+  @brief Find the slot of a pointer in the table of tracked allocations
+
+  The caller must hold the memory tracking lock.
+
+  @param ptr  Pointer to find
+  @param insert  Return the first free slot if ptr is not tracked
+
+  @return Slot index, or ceed_memory.size if ptr is not tracked and insert is
+            false
+
+  @ref Developer
+**/
+static size_t CeedMemoryFind(const void *ptr, bool insert) {
+  size_t mask = ceed_memory.size - 1, slot = ceed_memory.size;
+  uint64_t hash = ((uint64_t)(uintptr_t)ptr >> 4) * 0x9E3779B97F4A7C15ULL;
+  for (size_t i = (size_t)(hash >> 32) & mask; ; i = (i + 1) & mask) {
+    const void *entry = ceed_memory.entries[i].ptr;
+    if (entry == ptr)
+      return i;
+    if (entry == &ceed_memory_removed && slot == ceed_memory.size)
+      slot = i;
+    if (!entry)
+      return !insert ? ceed_memory.size : (slot < ceed_memory.size ? slot : i);
+  }
+}
+
+/**
+  @brief Record a host allocation in the table of tracked allocations
+
+  The caller must hold the memory tracking lock. If the table cannot grow, the
+    allocation is not recorded.
+
+  @param ptr    Allocated pointer
+  @param bytes  Size of the allocation in bytes
+
+  @ref Developer
+**/
+static void CeedMemoryTrack(const void *ptr, size_t bytes) {
+  if (!ptr) return;
+
+  // Grow the table, dropping removed entries, to keep the load at most 1/2
+  if (2*(ceed_memory.used + 1) > ceed_memory.size) {
+    CeedMemoryEntry *old = ceed_memory.entries;
+    size_t oldsize = ceed_memory.size, size = 64;
+    while (4*(ceed_memory.count + 1) > size) size *= 2;
+    CeedMemoryEntry *entries = calloc(size, sizeof(*entries));
+    if (!entries)
+      // LCOV_EXCL_START
+      return;
+    // LCOV_EXCL_STOP
+    ceed_memory.entries = entries;
+    ceed_memory.size = size;
+    ceed_memory.used = ceed_memory.count;
+    for (size_t i = 0; i < oldsize; i++)
+      if (old[i].ptr && old[i].ptr != &ceed_memory_removed)
+        ceed_memory.entries[CeedMemoryFind(old[i].ptr, true)] = old[i];
+    free(old);
+  }
+
+  size_t i = CeedMemoryFind(ptr, true);
+  if (ceed_memory.entries[i].ptr == ptr) {
+    // Address reused after memory was freed outside of libCEED
+    ceed_memory.current -= ceed_memory.entries[i].bytes;
+  } else {
+    if (!ceed_memory.entries[i].ptr) ceed_memory.used++;
+    ceed_memory.count++;
+  }
+  ceed_memory.entries[i].ptr = ptr;
+  ceed_memory.entries[i].bytes = bytes;
+  ceed_memory.current += bytes;
+  if (ceed_memory.current > ceed_memory.peak)
+    ceed_memory.peak = ceed_memory.current;
+}
+
+/**
+  @brief Remove a host allocation from the table of tracked allocations
+
+  The caller must hold the memory tracking lock.
+
+  @param ptr  Pointer to remove
+
+  @return Size of the allocation in bytes, or 0 if ptr is not tracked
+
+  @ref Developer
+**/
+static size_t CeedMemoryUntrack(const void *ptr) {
+  if (!ptr || !ceed_memory.count) return 0;
+
+  size_t i = CeedMemoryFind(ptr, false);
+  if (i == ceed_memory.size) return 0;
+  size_t bytes = ceed_memory.entries[i].bytes;
+  ceed_memory.entries[i].ptr = &ceed_memory_removed;
+  ceed_memory.count--;
+  ceed_memory.current -= bytes;
+  return bytes;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -198,6 +328,12 @@ int CeedMallocArray(size_t n, size_t unit, void *p) {
                      "members of size %zd\n", n, unit);
   // LCOV_EXCL_STOP
 
+  // The lock is only taken while tracking
+  if (CeedMemoryFlag(enabled)) {
+    CeedMemoryLock();
+    if (ceed_memory.enabled) CeedMemoryTrack(*(void **)p, n*unit);
+    CeedMemoryUnlock();
+  }
   return 0;
 }
 
@@ -224,6 +360,11 @@ int CeedCallocArray(size_t n, size_t unit, void *p) {
                      "%zd\n", n, unit);
   // LCOV_EXCL_STOP
 
+  if (CeedMemoryFlag(enabled)) {
+    CeedMemoryLock();
+    if (ceed_memory.enabled) CeedMemoryTrack(*(void **)p, n*unit);
+    CeedMemoryUnlock();
+  }
   return 0;
 }
 
@@ -243,13 +384,33 @@ int CeedCallocArray(size_t n, size_t unit, void *p) {
   @ref Backend
 **/
 int CeedReallocArray(size_t n, size_t unit, void *p) {
-  *(void **)p = realloc(*(void **)p, n*unit);
-  if (n && unit && !*(void **)p)
+  void *old = *(void **)p;
+  size_t oldbytes = 0;
+  if (CeedMemoryFlag(tracked)) {
+    CeedMemoryLock();
+    oldbytes = CeedMemoryUntrack(old);
+    CeedMemoryUnlock();
+  }
+
+  *(void **)p = realloc(old, n*unit);
+  if (n && unit && !*(void **)p) {
     // LCOV_EXCL_START
+    *(void **)p = old;
+    if (oldbytes) {
+      CeedMemoryLock();
+      CeedMemoryTrack(old, oldbytes);
+      CeedMemoryUnlock();
+    }
     return CeedError(NULL, 1, "realloc failed to allocate %zd members of size "
                      "%zd\n", n, unit);
-  // LCOV_EXCL_STOP
+    // LCOV_EXCL_STOP
+  }
 
+  if (CeedMemoryFlag(enabled)) {
+    CeedMemoryLock();
+    if (ceed_memory.enabled) CeedMemoryTrack(*(void **)p, n*unit);
+    CeedMemoryUnlock();
+  }
   return 0;
 }
 
@@ -260,11 +421,38 @@ int CeedReallocArray(size_t n, size_t unit, void *p) {
              zeroed) rather than the pointer.
 **/
 int CeedFree(void *p) {
+  // Allocations are only recorded once tracking has been enabled
+  if (CeedMemoryFlag(tracked)) {
+    CeedMemoryLock();
+    CeedMemoryUntrack(*(void **)p);
+    CeedMemoryUnlock();
+  }
   free(*(void **)p);
   *(void **)p = NULL;
   return 0;
 }
 
+/**
+  @brief Stop tracking host memory that is handed over to the user
+
+  Arrays taken from libCEED objects, such as with CeedVectorTakeArray(), are no
+    longer counted by CeedGetMemoryUsage().
+
+  @param ptr  Pointer handed over to the user
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedUntrackArray(const void *ptr) {
+  if (CeedMemoryFlag(tracked)) {
+    CeedMemoryLock();
+    CeedMemoryUntrack(ptr);
+    CeedMemoryUnlock();
+  }
+  return 0;
+}
+
 /**
   @brief Register a Ceed backend
 
@@ -670,12 +858,18 @@ int CeedInit(const char *resource, Ceed *ceed) {
     CEED_FTABLE_ENTRY(CeedVector, RestoreArrayRead),
     CEED_FTABLE_ENTRY(CeedVector, Norm),
     CEED_FTABLE_ENTRY(CeedVector, Reciprocal),
+    CEED_FTABLE_ENTRY(CeedVector, Scale),
+    CEED_FTABLE_ENTRY(CeedVector, PointwiseMult),
+    CEED_FTABLE_ENTRY(CeedVector, GetMemoryUsage),
     CEED_FTABLE_ENTRY(CeedVector, Destroy),
     CEED_FTABLE_ENTRY(CeedElemRestriction, Apply),
     CEED_FTABLE_ENTRY(CeedElemRestriction, ApplyBlock),
     CEED_FTABLE_ENTRY(CeedElemRestriction, GetOffsets),
+    CEED_FTABLE_ENTRY(CeedElemRestriction, GetMemoryUsage),
     CEED_FTABLE_ENTRY(CeedElemRestriction, Destroy),
     CEED_FTABLE_ENTRY(CeedBasis, Apply),
+    CEED_FTABLE_ENTRY(CeedBasis, ApplyInterpGrad),
+    CEED_FTABLE_ENTRY(CeedBasis, GetMemoryUsage),
     CEED_FTABLE_ENTRY(CeedBasis, Destroy),
     CEED_FTABLE_ENTRY(CeedTensorContract, Apply),
     CEED_FTABLE_ENTRY(CeedTensorContract, Destroy),
@@ -697,7 +891,9 @@ int CeedInit(const char *resource, Ceed *ceed) {
     CEED_FTABLE_ENTRY(CeedOperator, ApplyComposite),
     CEED_FTABLE_ENTRY(CeedOperator, ApplyAdd),
     CEED_FTABLE_ENTRY(CeedOperator, ApplyAddComposite),
+    CEED_FTABLE_ENTRY(CeedOperator, ApplyScaledAdd),
     CEED_FTABLE_ENTRY(CeedOperator, ApplyJacobian),
+    CEED_FTABLE_ENTRY(CeedOperator, GetMemoryUsage),
     CEED_FTABLE_ENTRY(CeedOperator, Destroy),
     {NULL, 0} // End of lookup table - used in SetBackendFunction loop
   };
@@ -723,6 +919,9 @@ int CeedInit(const char *resource, Ceed *ceed) {
   memcpy(tmp, backends[matchidx].prefix, len+1);
   (*ceed)->resource = tmp;
 
+  // Trace event timeline, if CEED_TRACE names a file
+  ierr = CeedTraceInit(*ceed); CeedChk(ierr);
+
   return 0;
 }
 
@@ -786,6 +985,52 @@ int CeedIsDeterministic(Ceed ceed, bool *isDeterministic) {
   return 0;
 }
 
+/**
+  @brief Enable or disable tracking of host memory allocated by libCEED
+
+  When tracking is enabled, host allocations made by libCEED and its CPU
+    backends are recorded until they are freed, and the peak usage reported by
+    CeedGetMemoryUsage() is reset to the current usage. Allocations recorded
+    before tracking is disabled are still removed when freed. Device memory and
+    arrays provided by the user with @ref CEED_USE_POINTER are not counted.
+
+  @param enable  Boolean value to enable or disable tracking
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedSetMemoryTracking(bool enable) {
+  CeedMemoryLock();
+  if (enable) {
+    CeedMemorySetFlag(tracked, true);
+    ceed_memory.peak = ceed_memory.current;
+  }
+  CeedMemorySetFlag(enabled, enable);
+  CeedMemoryUnlock();
+  return 0;
+}
+
+/**
+  @brief Get the host memory held by libCEED, as recorded by
+           CeedSetMemoryTracking()
+
+  @param[out] current  Variable to store the bytes currently allocated, or NULL
+  @param[out] peak     Variable to store the largest number of bytes allocated
+                         at once since tracking was enabled, or NULL
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedGetMemoryUsage(size_t *current, size_t *peak) {
+  CeedMemoryLock();
+  if (current) *current = ceed_memory.current;
+  if (peak) *peak = ceed_memory.peak;
+  CeedMemoryUnlock();
+  return 0;
+}
+
 /**
   @brief View a Ceed
 
@@ -821,7 +1066,7 @@ int CeedView(Ceed ceed, FILE *stream) {
 **/
 int CeedDestroy(Ceed *ceed) {
   int ierr;
-  if (!*ceed || --(*ceed)->refcount > 0) return 0;
+  if (!*ceed || CeedAtomicAdd((*ceed)->refcount, -1) > 0) return 0;
   if ((*ceed)->delegate) {
     ierr = CeedDestroy(&(*ceed)->delegate); CeedChk(ierr);
   }
@@ -842,6 +1087,9 @@ int CeedDestroy(Ceed *ceed) {
   ierr = CeedFree(&(*ceed)->resource); CeedChk(ierr);
   ierr = CeedDestroy(&(*ceed)->opfallbackceed); CeedChk(ierr);
   ierr = CeedFree(&(*ceed)->opfallbackresource); CeedChk(ierr);
+  if ((*ceed)->traced) {
+    ierr = CeedTraceFinalize(); CeedChk(ierr);
+  }
   ierr = CeedFree(ceed); CeedChk(ierr);
   return 0;
 }
@@ -18,7 +18,7 @@ from .ceed import Ceed
 from .ceed_vector import Vector
 from .ceed_basis import Basis, BasisTensorH1, BasisTensorH1Lagrange, BasisH1
 from .ceed_elemrestriction import ElemRestriction, StridedElemRestriction, BlockedElemRestriction, BlockedStridedElemRestriction
-from .ceed_qfunction import QFunction, QFunctionByName, IdentityQFunction
+from .ceed_qfunction import QFunction, QFunctionByName, IdentityQFunction, qfunction_cfunc
 from .ceed_operator import Operator, CompositeOperator
 from .ceed_constants import *
 
@@ -29,7 +29,7 @@ __all__ = ["Ceed",
            "Vector",
            "Basis", "BasisTensorH1", "BasisTensorH1Lagrange", "BasisH1",
            "ElemRestriction", "StridedElemRestriction", "BlockedElemRestriction", "BlockedStridedelemRestriction",
-           "QFunction", "QFunctionByName", "IdentityQFunction",
+           "QFunction", "QFunctionByName", "IdentityQFunction", "qfunction_cfunc",
            "Operator", "CompositeOperator",
            "MEM_HOST", "MEM_DEVICE", "mem_types",
            "COPY_VALUES", "USE_POINTER", "OWN_POINTER", "copy_modes",
@@ -38,6 +38,7 @@ __all__ = ["Ceed",
            "EVAL_NONE", "EVAL_INTERP", "EVAL_GRAD", "EVAL_DIV", "EVAL_CURL", "EVAL_WEIGHT", "eval_modes",
            "GAUSS", "GAUSS_LOBATTO", "quad_modes",
            "LINE", "TRIANGLE", "QUAD", "TET", "PYRAMID", "PRISM", "HEX", "elem_topologies",
+           "STRATEGY_MATRIX_FREE", "STRATEGY_ASSEMBLED", "STRATEGY_AUTO", "operator_strategies",
            "REQUEST_IMMEDIATE", "REQUEST_ORDERED",
            "VECTOR_ACTIVE", "VECTOR_NONE", "ELEMRESTRICTION_NONE", "BASIS_COLLOCATED"]
 
@@ -37,6 +37,10 @@ with open(os.path.abspath("include/ceed.h")) as f:
     header = re.sub("va_list", "const char *", header)
 ffibuilder.cdef(header)
 
+# Note: in API mode, cffi releases the GIL around every call into libCEED, so
+#   operators, bases, and restrictions may be applied concurrently from Python
+#   threads; QFunctions are compiled C and never call back into Python
+
 ffibuilder.set_source("_ceed_cffi",
                       """
   #define va_list const char *
@@ -304,16 +304,17 @@ class Ceed():
                        interp, grad, qref, qweight)
 
     # CeedQFunction
-    def QFunction(self, vlength, f, source):
+    def QFunction(self, vlength, f, source=""):
         """Ceed QFunction: point-wise operation at quadrature points for
              evaluating volumetric terms.
 
            Args:
              vlength: vector length. Caller must ensure that number of quadrature
                         points is a multiple of vlength
-             f: ctypes function pointer to evaluate action at quadrature points
-             source: absolute path to source of QFunction,
-               "\\abs_path\\file.h:function_name
+             f: ctypes function pointer or Numba cfunc, see qfunction_cfunc(),
+                  to evaluate action at quadrature points
+             **source: absolute path to source of QFunction,
+               "\\abs_path\\file.h:function_name, required by GPU backends
 
            Returns:
              qfunction: Ceed QFunction"""
@@ -84,6 +84,14 @@ elem_topologies = {LINE: "line",
                    PRISM: "prism",
                    HEX: "hexahedron"}
 
+# CeedOperatorStrategy
+STRATEGY_MATRIX_FREE = lib.CEED_STRATEGY_MATRIX_FREE
+STRATEGY_ASSEMBLED = lib.CEED_STRATEGY_ASSEMBLED
+STRATEGY_AUTO = lib.CEED_STRATEGY_AUTO
+operator_strategies = {STRATEGY_MATRIX_FREE: "matrix-free",
+                       STRATEGY_ASSEMBLED: "assembled",
+                       STRATEGY_AUTO: "auto"}
+
 # ------------------------------------------------------------------------------
 # Ceed Constants
 # ------------------------------------------------------------------------------
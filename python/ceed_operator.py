@@ -114,6 +114,81 @@ class _OperatorBase(ABC):
                                                                        d._pointer[0], request)
         self._ceed._check_error(err_code)
 
+    # Set apply strategy
+    def set_strategy(self, strategy):
+        """Set the strategy used to apply the Operator.
+
+           Args:
+             strategy: STRATEGY_MATRIX_FREE, STRATEGY_ASSEMBLED to apply an
+                         assembled CSR matrix, or STRATEGY_AUTO to select one
+                         at the first apply"""
+
+        # libCEED call
+        err_code = lib.CeedOperatorSetStrategy(self._pointer[0], strategy)
+        self._ceed._check_error(err_code)
+
+    # Set batch size
+    def set_batch_size(self, batchsize):
+        """Set the number of elements per basis and QFunction call on backends
+             that otherwise apply the Operator one element at a time.
+
+           Args:
+             batchsize: number of elements per batch, set before the first
+                          apply"""
+
+        # libCEED call
+        err_code = lib.CeedOperatorSetBatchSize(self._pointer[0], batchsize)
+        self._ceed._check_error(err_code)
+
+    # Set name
+    def set_name(self, name):
+        """Set the name of the Operator, shown by view and in the trace event
+             timeline written to the file named by CEED_TRACE.
+
+           Args:
+             name: name of the Operator"""
+
+        # libCEED call
+        nameAscii = ffi.new("char[]", name.encode('ascii'))
+        err_code = lib.CeedOperatorSetName(self._pointer[0], nameAscii)
+        self._ceed._check_error(err_code)
+
+    # Get flops estimate
+    def get_flops_estimate(self):
+        """Estimate the floating point operations of one application of the
+             Operator.
+
+           Returns:
+             flops: estimated flops per apply"""
+
+        # Setup argument
+        flops_pointer = ffi.new("size_t *")
+
+        # libCEED call
+        err_code = lib.CeedOperatorGetFlopsEstimate(self._pointer[0],
+                                                    flops_pointer)
+        self._ceed._check_error(err_code)
+
+        return flops_pointer[0]
+
+    # Get bytes estimate
+    def get_bytes_estimate(self):
+        """Estimate the bytes of memory traffic of one application of the
+             Operator.
+
+           Returns:
+             bytes: estimated bytes per apply"""
+
+        # Setup argument
+        bytes_pointer = ffi.new("size_t *")
+
+        # libCEED call
+        err_code = lib.CeedOperatorGetBytesEstimate(self._pointer[0],
+                                                    bytes_pointer)
+        self._ceed._check_error(err_code)
+
+        return bytes_pointer[0]
+
     # Apply CeedOperator
     def apply(self, u, v, request=REQUEST_IMMEDIATE):
         """Apply Operator to a vector.
@@ -78,10 +78,16 @@ class Vector():
            array if applicable.
 
            Args:
-             *array: Numpy or Numba array to be used
+             *array: Numpy or Numba array, or host DLPack tensor, to be used
              **memtype: memory type of the array being passed, default CEED_MEM_HOST
              **cmode: copy mode for the array, default CEED_COPY_VALUES"""
 
+        # Host DLPack tensors, such as PyTorch or JAX CPU tensors, are viewed
+        #   without a copy
+        if (memtype == MEM_HOST and hasattr(array, '__dlpack__') and
+                not hasattr(array, '__array_interface__')):
+            array = np.from_dlpack(array)
+
         # Store array reference if needed
         if cmode == USE_POINTER:
             self._array_reference = array
@@ -269,6 +275,45 @@ class Vector():
         yield x
         self.restore_array_read()
 
+    # DLPack device of the exported array
+    def __dlpack_device__(self):
+        """Get the DLPack device of the Vector's exported array.
+
+           Returns:
+             (device_type, device_id): kDLCPU, as the host array is exported"""
+
+        return (1, 0)
+
+    # Export the Vector's host array via DLPack
+    def __dlpack__(self, stream=None, **kwargs):
+        """Export the Vector's host array via DLPack without a copy, e.g. for
+           torch.from_dlpack(vec) or np.from_dlpack(vec).
+
+           The exported tensor keeps the Vector alive and aliases its host
+           array. It remains valid until the array is replaced with
+           set_array() or the Vector is modified through another memory type.
+
+           Returns:
+             capsule: DLPack capsule for the host array"""
+
+        # Retrieve the length of the array
+        length_pointer = ffi.new("CeedInt *")
+        err_code = lib.CeedVectorGetLength(self._pointer[0], length_pointer)
+        self._ceed._check_error(err_code)
+
+        # Take write access so the host array is current, then release it;
+        #   the host array remains owned by the Vector
+        array_pointer = ffi.new("CeedScalar **")
+        err_code = lib.CeedVectorGetArray(
+            self._pointer[0], MEM_HOST, array_pointer)
+        self._ceed._check_error(err_code)
+        array = np.asarray(_HostArray(self, array_pointer[0],
+                                      length_pointer[0]))
+        err_code = lib.CeedVectorRestoreArray(self._pointer[0], array_pointer)
+        self._ceed._check_error(err_code)
+
+        return array.__dlpack__(stream=stream, **kwargs)
+
     # Get the length of a Vector
     def get_length(self):
         """Get the length of a Vector.
@@ -361,6 +406,25 @@ class Vector():
 # ------------------------------------------------------------------------------
 
 
+class _HostArray():
+    """Expose a Vector's host array to Numpy, keeping the Vector alive."""
+
+    # Constructor
+    def __init__(self, vector, array_pointer, length):
+        # Reference to Vector
+        self._vector = vector
+
+        # Numpy array interface
+        self.__array_interface__ = {
+            'shape': (length,),
+            'typestr': '<f8',
+            'data': (int(ffi.cast("intptr_t", array_pointer)), False),
+            'version': 3
+        }
+
+# ------------------------------------------------------------------------------
+
+
 class _VectorWrap(Vector):
     """Wrap a CeedVector pointer in a Vector object."""
 
@@ -77,6 +77,10 @@ def run(test, backends):
                                       stderr=subprocess.PIPE)
                 proc.stdout = proc.stdout.decode('utf-8')
                 proc.stderr = proc.stderr.decode('utf-8')
+                # Performance diagnostics of perfcheck backends are reported on stderr
+                if 'perfcheck' in ceed_resource:
+                    proc.stderr = ''.join(line for line in proc.stderr.splitlines(keepends=True)
+                                          if not line.startswith('perfcheck: '))
 
                 case = TestCase('{} {}'.format(test, ceed_resource),
                                 elapsed_sec=time.time()-start,
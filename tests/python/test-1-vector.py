@@ -230,6 +230,48 @@ def test_119(ceed_resource):
         for i in range(n):
             assert abs(b[i] - 1. / (10 + i)) < 1e-15
 
+# -------------------------------------------------------------------------------
+# Test zero-copy DLPack exchange
+# -------------------------------------------------------------------------------
+
+
+class DLPackTensor():
+    """Host tensor exposing only the DLPack protocol"""
+
+    def __init__(self, a):
+        self.a = a
+
+    def __dlpack__(self, stream=None):
+        return self.a.__dlpack__()
+
+    def __dlpack_device__(self):
+        return self.a.__dlpack_device__()
+
+
+def test_120(ceed_resource):
+    ceed = libceed.Ceed(ceed_resource)
+
+    n = 10
+    x = ceed.Vector(n)
+
+    a = np.arange(10, 10 + n, dtype="float64")
+    x.set_array(DLPackTensor(a), cmode=libceed.USE_POINTER)
+    a[0] = 1.
+
+    with x.array_read() as b:
+        assert np.all(b == a)
+
+    x.set_value(2.)
+    b = np.from_dlpack(x)
+    b[1] = 3.
+    del x
+
+    assert b[0] == 2. and b[1] == 3.
+    y = ceed.Vector(n)
+    y.set_array(b, cmode=libceed.USE_POINTER)
+    with y.array_read() as c:
+        assert np.all(c == b)
+
 # -------------------------------------------------------------------------------
 # Test modification of reshaped array
 # -------------------------------------------------------------------------------
@@ -18,6 +18,7 @@
 # Test Ceed QFunction functionality
 
 import os
+import pytest
 import libceed
 import numpy as np
 import check
@@ -193,6 +194,78 @@ def test_402(ceed_resource, capsys):
     assert not stderr
     assert stdout == ref_stdout
 
+# -------------------------------------------------------------------------------
+# Test creation and evaluation of Numba compiled qfunction
+# -------------------------------------------------------------------------------
+
+
+def test_403(ceed_resource):
+    numba = pytest.importorskip("numba")
+
+    ceed = libceed.Ceed(ceed_resource)
+
+    @libceed.qfunction_cfunc
+    def setup_mass(ctx, Q, in_, out):
+        w = numba.carray(in_[0], Q)
+        J = numba.carray(in_[1], Q)
+        qdata = numba.carray(out[0], Q)
+        for i in range(Q):
+            qdata[i] = J[i] * w[i]
+        return 0
+
+    @libceed.qfunction_cfunc
+    def apply_mass(ctx, Q, in_, out):
+        qdata = numba.carray(in_[0], Q)
+        u = numba.carray(in_[1], Q)
+        v = numba.carray(out[0], Q)
+        for i in range(Q):
+            v[i] = qdata[i] * u[i]
+        return 0
+
+    qf_setup = ceed.QFunction(1, setup_mass)
+    qf_setup.add_input("w", 1, libceed.EVAL_WEIGHT)
+    qf_setup.add_input("dx", 1, libceed.EVAL_GRAD)
+    qf_setup.add_output("qdata", 1, libceed.EVAL_NONE)
+
+    qf_mass = ceed.QFunction(1, apply_mass)
+    qf_mass.add_input("qdata", 1, libceed.EVAL_NONE)
+    qf_mass.add_input("u", 1, libceed.EVAL_INTERP)
+    qf_mass.add_output("v", 1, libceed.EVAL_INTERP)
+
+    q = 8
+
+    w_array = np.zeros(q, dtype="float64")
+    u_array = np.zeros(q, dtype="float64")
+    v_true = np.zeros(q, dtype="float64")
+    for i in range(q):
+        x = 2. * i / (q - 1) - 1
+        w_array[i] = 1 - x * x
+        u_array[i] = 2 + 3 * x + 5 * x * x
+        v_true[i] = w_array[i] * u_array[i]
+
+    dx = ceed.Vector(q)
+    dx.set_value(1)
+    w = ceed.Vector(q)
+    w.set_array(w_array, cmode=libceed.USE_POINTER)
+    u = ceed.Vector(q)
+    u.set_array(u_array, cmode=libceed.USE_POINTER)
+    v = ceed.Vector(q)
+    v.set_value(0)
+    qdata = ceed.Vector(q)
+    qdata.set_value(0)
+
+    inputs = [w, dx]
+    outputs = [qdata]
+    qf_setup.apply(q, inputs, outputs)
+
+    inputs = [qdata, u]
+    outputs = [v]
+    qf_mass.apply(q, inputs, outputs)
+
+    with v.array_read() as v_array:
+        for i in range(q):
+            assert v_array[i] == v_true[i]
+
 # -------------------------------------------------------------------------------
 # Test creation, evaluation, and destruction for qfunction by name
 # -------------------------------------------------------------------------------
@@ -0,0 +1,47 @@
+/// @file
+/// Test perfcheck diagnostics of vector access
+/// \test Test perfcheck diagnostics of vector access
+#define _POSIX_C_SOURCE 200809
+#include <ceed.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector x;
+  CeedScalar *a;
+  CeedInt n = 10;
+  char filename[] = "t120-perfcheck-XXXXXX", line[256];
+  close(mkstemp(filename));
+  setenv("CEED_PERFCHECK_FILE", filename, 1);
+
+  // The diagnostics are those of the perfcheck backend, whatever the backend
+  //   under test
+  CeedInit("/cpu/self/perfcheck", &ceed);
+  CeedVectorCreate(ceed, n, &x);
+
+  // Redundant CeedVectorSetValue
+  CeedVectorSetValue(x, 0.0);
+  CeedVectorSetValue(x, 0.0);
+  CeedVectorSetValue(x, 0.0);
+
+  // Read-only CeedVectorGetArray
+  CeedVectorGetArray(x, CEED_MEM_HOST, &a);
+  if (a[0] != 0.0)
+    // LCOV_EXCL_START
+    printf("Error reading array a[0] = %f\n", (double)a[0]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArray(x, &a);
+
+  CeedVectorDestroy(&x);
+  CeedDestroy(&ceed);
+
+  // Ranked diagnostics
+  FILE *stream = fopen(filename, "r");
+  while (fgets(line, sizeof(line), stream))
+    fputs(line, stdout);
+  fclose(stream);
+  remove(filename);
+  return 0;
+}
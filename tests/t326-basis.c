@@ -0,0 +1,128 @@
+/// @file
+/// Test combined interpolation and gradient basis evaluation
+/// \test Test combined interpolation and gradient basis evaluation
+#include <ceed.h>
+#include <math.h>
+#include "t320-basis.h"
+
+// Compare CEED_EVAL_INTERP | CEED_EVAL_GRAD with separate evaluations
+static void CheckInterpGrad(Ceed ceed, CeedBasis b, const char *name) {
+  CeedVector U, V, G, Vq, Uq, W;
+  CeedInt dim, ncomp, P, Q;
+  const CeedScalar *v, *vq, *w, *g;
+  CeedScalar *u;
+
+  CeedBasisGetDimension(b, &dim);
+  CeedBasisGetNumComponents(b, &ncomp);
+  CeedBasisGetNumNodes(b, &P);
+  CeedBasisGetNumQuadraturePoints(b, &Q);
+  const CeedInt len = ncomp*Q;
+
+  CeedVectorCreate(ceed, ncomp*P, &U);
+  CeedVectorCreate(ceed, (1+dim)*len, &Uq);
+  CeedVectorCreate(ceed, (1+dim)*len, &Vq);
+  CeedVectorCreate(ceed, dim*len, &W);
+  CeedVectorCreate(ceed, ncomp*P, &V);
+  CeedVectorCreate(ceed, ncomp*P, &G);
+
+  // Nodes to quadrature points
+  CeedVectorGetArray(U, CEED_MEM_HOST, &u);
+  for (CeedInt i=0; i<ncomp*P; i++)
+    u[i] = sin(i + 0.3);
+  CeedVectorRestoreArray(U, &u);
+  CeedBasisApply(b, 1, CEED_NOTRANSPOSE, CEED_EVAL_INTERP | CEED_EVAL_GRAD, U,
+                 Vq);
+  CeedBasisApply(b, 1, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, U, W);
+  CeedVectorGetArrayRead(Vq, CEED_MEM_HOST, &vq);
+  CeedVectorGetArrayRead(W, CEED_MEM_HOST, &w);
+  for (CeedInt i=0; i<dim*len; i++)
+    if (fabs(vq[len+i] - w[i]) > 1E-13)
+      // LCOV_EXCL_START
+      printf("%s grad [%d] %f != %f\n", name, i, vq[len+i], w[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(W, &w);
+  CeedVectorRestoreArrayRead(Vq, &vq);
+  CeedVectorDestroy(&W);
+  CeedVectorCreate(ceed, len, &W);
+  CeedBasisApply(b, 1, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, U, W);
+  CeedVectorGetArrayRead(Vq, CEED_MEM_HOST, &vq);
+  CeedVectorGetArrayRead(W, CEED_MEM_HOST, &w);
+  for (CeedInt i=0; i<len; i++)
+    if (fabs(vq[i] - w[i]) > 1E-13)
+      // LCOV_EXCL_START
+      printf("%s interp [%d] %f != %f\n", name, i, vq[i], w[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(W, &w);
+  CeedVectorRestoreArrayRead(Vq, &vq);
+
+  // Quadrature points to nodes
+  CeedVectorGetArray(Uq, CEED_MEM_HOST, &u);
+  for (CeedInt i=0; i<(1+dim)*len; i++)
+    u[i] = cos(i + 0.7);
+  CeedVectorRestoreArray(Uq, &u);
+  CeedBasisApply(b, 1, CEED_TRANSPOSE, CEED_EVAL_INTERP | CEED_EVAL_GRAD, Uq,
+                 V);
+  CeedVectorGetArray(Uq, CEED_MEM_HOST, &u);
+  CeedVectorSetArray(W, CEED_MEM_HOST, CEED_COPY_VALUES, u);
+  CeedVectorRestoreArray(Uq, &u);
+  CeedBasisApply(b, 1, CEED_TRANSPOSE, CEED_EVAL_INTERP, W, U);
+  CeedVectorDestroy(&W);
+  CeedVectorCreate(ceed, dim*len, &W);
+  CeedVectorGetArray(Uq, CEED_MEM_HOST, &u);
+  CeedVectorSetArray(W, CEED_MEM_HOST, CEED_COPY_VALUES, &u[len]);
+  CeedVectorRestoreArray(Uq, &u);
+  CeedBasisApply(b, 1, CEED_TRANSPOSE, CEED_EVAL_GRAD, W, G);
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
+  CeedVectorGetArray(U, CEED_MEM_HOST, &u);
+  CeedVectorGetArrayRead(G, CEED_MEM_HOST, &g);
+  for (CeedInt i=0; i<ncomp*P; i++)
+    if (fabs(v[i] - (u[i] + g[i])) > 1E-12)
+      // LCOV_EXCL_START
+      printf("%s transpose [%d] %f != %f\n", name, i, v[i], u[i] + g[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(G, &g);
+  CeedVectorRestoreArray(U, &u);
+  CeedVectorRestoreArrayRead(V, &v);
+
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&Uq);
+  CeedVectorDestroy(&Vq);
+  CeedVectorDestroy(&W);
+  CeedVectorDestroy(&V);
+  CeedVectorDestroy(&G);
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedBasis b;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt dim=1; dim<=3; dim++) {
+    // Collocated gradient, Q > P
+    CeedBasisCreateTensorH1Lagrange(ceed, dim, 2, 3, 5, CEED_GAUSS, &b);
+    CheckInterpGrad(ceed, b, "Q > P");
+    CeedBasisDestroy(&b);
+    // Quadrature collocated with nodes
+    CeedBasisCreateTensorH1Lagrange(ceed, dim, 2, 4, 4, CEED_GAUSS_LOBATTO, &b);
+    CheckInterpGrad(ceed, b, "collocated");
+    CeedBasisDestroy(&b);
+    // Underintegration, Q < P
+    CeedBasisCreateTensorH1Lagrange(ceed, dim, 2, 5, 3, CEED_GAUSS, &b);
+    CheckInterpGrad(ceed, b, "Q < P");
+    CeedBasisDestroy(&b);
+  }
+
+  // Non-tensor basis
+  const CeedInt P = 6, Q = 4, dim = 2;
+  CeedScalar qref[dim*Q], qweight[Q];
+  CeedScalar interp[P*Q], grad[dim*P*Q];
+  buildmats(qref, qweight, interp, grad);
+  CeedBasisCreateH1(ceed, CEED_TRIANGLE, 1, P, Q, interp, grad, qref,
+                    qweight, &b);
+  CheckInterpGrad(ceed, b, "simplex");
+  CeedBasisDestroy(&b);
+
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,145 @@
+/// @file
+/// Test collapsed coordinate simplex bases
+/// \test Test collapsed coordinate simplex bases
+#include <ceed.h>
+#include <math.h>
+
+// Polynomial of total degree deg and its gradient
+static CeedScalar Eval(CeedInt dim, CeedInt deg, const CeedScalar *x,
+                       CeedScalar *dx) {
+  const CeedScalar c[3] = {0.7, -1.3, 0.4};
+  CeedScalar l = 0.2;
+  for (CeedInt d=0; d<dim; d++)
+    l += c[d]*x[d];
+  for (CeedInt d=0; d<dim; d++)
+    dx[d] = deg*pow(l, deg-1)*c[d];
+  return pow(l, deg);
+}
+
+static void CheckCollapsed(Ceed ceed, CeedElemTopology topo, CeedInt P1d,
+                           CeedInt Q1d, CeedScalar volume) {
+  CeedBasis b;
+  CeedVector W, F, U, Uq, G, V;
+  CeedInt dim, P, Q;
+  const CeedScalar *qref, *interp, *grad, *w, *uq, *g, *v;
+  CeedScalar *f, *u;
+
+  CeedBasisCreateSimplexCollapsed(ceed, topo, 1, P1d, Q1d, &b);
+  CeedBasisGetDimension(b, &dim);
+  CeedBasisGetNumNodes(b, &P);
+  CeedBasisGetNumQuadraturePoints(b, &Q);
+  CeedBasisGetQRef(b, &qref);
+
+  CeedVectorCreate(ceed, Q, &W);
+  CeedVectorCreate(ceed, Q, &F);
+  CeedVectorCreate(ceed, P, &U);
+  CeedVectorCreate(ceed, Q, &Uq);
+  CeedVectorCreate(ceed, dim*Q, &G);
+  CeedVectorCreate(ceed, P, &V);
+
+  // Quadrature weights sum to the volume of the reference simplex
+  CeedBasisApply(b, 1, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT, CEED_VECTOR_NONE, W);
+  CeedVectorGetArrayRead(W, CEED_MEM_HOST, &w);
+  CeedScalar sum = 0;
+  for (CeedInt i=0; i<Q; i++)
+    sum += w[i];
+  if (fabs(sum - volume) > 1E-14)
+    // LCOV_EXCL_START
+    printf("%dD volume %f != %f\n", dim, sum, volume);
+  // LCOV_EXCL_STOP
+
+  // L2 projection with the orthonormal basis, u = B^T W f
+  CeedVectorGetArray(F, CEED_MEM_HOST, &f);
+  for (CeedInt i=0; i<Q; i++) {
+    CeedScalar x[3], dx[3];
+    for (CeedInt d=0; d<dim; d++)
+      x[d] = qref[d*Q+i];
+    f[i] = w[i]*Eval(dim, P1d-1, x, dx);
+  }
+  CeedVectorRestoreArray(F, &f);
+  CeedVectorRestoreArrayRead(W, &w);
+  CeedBasisApply(b, 1, CEED_TRANSPOSE, CEED_EVAL_INTERP, F, U);
+
+  // Interpolation and gradient reproduce the polynomial
+  CeedBasisApply(b, 1, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, U, Uq);
+  CeedBasisApply(b, 1, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, U, G);
+  CeedBasisGetInterp(b, &interp);
+  CeedBasisGetGrad(b, &grad);
+  CeedVectorGetArrayRead(U, CEED_MEM_HOST, &v);
+  CeedVectorGetArrayRead(Uq, CEED_MEM_HOST, &uq);
+  CeedVectorGetArrayRead(G, CEED_MEM_HOST, &g);
+  for (CeedInt i=0; i<Q; i++) {
+    CeedScalar x[3], dx[3];
+    for (CeedInt d=0; d<dim; d++)
+      x[d] = qref[d*Q+i];
+    const CeedScalar fx = Eval(dim, P1d-1, x, dx);
+    // Dense matrices agree with the backend evaluation
+    for (CeedInt d=0; d<=dim; d++) {
+      const CeedScalar *mat = d ? &grad[(d-1)*Q*P] : interp;
+      CeedScalar dense = 0;
+      for (CeedInt j=0; j<P; j++)
+        dense += mat[i*P+j]*v[j];
+      if (fabs(dense - (d ? g[(d-1)*Q+i] : uq[i])) > 1E-11)
+        // LCOV_EXCL_START
+        printf("%dD dense [%d, %d] %f\n", dim, i, d, dense);
+      // LCOV_EXCL_STOP
+    }
+    if (fabs(uq[i] - fx) > 1E-12)
+      // LCOV_EXCL_START
+      printf("%dD interp [%d] %f != %f\n", dim, i, uq[i], fx);
+    // LCOV_EXCL_STOP
+    for (CeedInt d=0; d<dim; d++)
+      if (fabs(g[d*Q+i] - dx[d]) > 1E-11)
+        // LCOV_EXCL_START
+        printf("%dD grad [%d, %d] %f != %f\n", dim, i, d, g[d*Q+i], dx[d]);
+    // LCOV_EXCL_STOP
+  }
+  CeedVectorRestoreArrayRead(G, &g);
+  CeedVectorRestoreArrayRead(Uq, &uq);
+  CeedVectorRestoreArrayRead(U, &v);
+
+  // Transpose gradient is the adjoint, (G u, g) == (u, G^T g)
+  CeedVectorGetArray(G, CEED_MEM_HOST, &u);
+  for (CeedInt i=0; i<dim*Q; i++)
+    u[i] = sin(i + 0.3);
+  CeedVectorRestoreArray(G, &u);
+  CeedBasisApply(b, 1, CEED_TRANSPOSE, CEED_EVAL_GRAD, G, V);
+  CeedVectorDestroy(&Uq);
+  CeedVectorCreate(ceed, dim*Q, &Uq);
+  CeedBasisApply(b, 1, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, U, Uq);
+  CeedVectorGetArrayRead(G, CEED_MEM_HOST, &g);
+  CeedVectorGetArrayRead(Uq, CEED_MEM_HOST, &uq);
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
+  CeedVectorGetArray(U, CEED_MEM_HOST, &u);
+  CeedScalar lhs = 0, rhs = 0;
+  for (CeedInt i=0; i<dim*Q; i++)
+    lhs += uq[i]*g[i];
+  for (CeedInt i=0; i<P; i++)
+    rhs += u[i]*v[i];
+  if (fabs(lhs - rhs) > 1E-11*fabs(lhs))
+    // LCOV_EXCL_START
+    printf("%dD grad transpose %f != %f\n", dim, lhs, rhs);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArray(U, &u);
+  CeedVectorRestoreArrayRead(V, &v);
+  CeedVectorRestoreArrayRead(Uq, &uq);
+  CeedVectorRestoreArrayRead(G, &g);
+
+  CeedVectorDestroy(&W);
+  CeedVectorDestroy(&F);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&Uq);
+  CeedVectorDestroy(&G);
+  CeedVectorDestroy(&V);
+  CeedBasisDestroy(&b);
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+
+  CeedInit(argv[1], &ceed);
+  CheckCollapsed(ceed, CEED_TRIANGLE, 5, 6, 1./2);
+  CheckCollapsed(ceed, CEED_TET, 4, 5, 1./6);
+  CeedDestroy(&ceed);
+  return 0;
+}
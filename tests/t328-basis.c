@@ -0,0 +1,82 @@
+/// @file
+/// Test sharing of identical tensor product bases
+/// \test Test sharing of identical tensor product bases
+#include <ceed.h>
+#include <math.h>
+
+// Interpolate a constant with a basis
+static void CheckInterp(Ceed ceed, CeedBasis b, CeedInt P, CeedInt Q) {
+  CeedVector U, V;
+  const CeedScalar *v;
+
+  CeedVectorCreate(ceed, P*P, &U);
+  CeedVectorSetValue(U, 1.0);
+  CeedVectorCreate(ceed, Q*Q, &V);
+  CeedBasisApply(b, 1, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, U, V);
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
+  for (CeedInt i=0; i<Q*Q; i++)
+    if (fabs(v[i] - 1.0) > 1e-14)
+      // LCOV_EXCL_START
+      printf("[%d] Interpolated constant %f != 1.0\n", i, v[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V, &v);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedBasis b[4], h[3];
+  CeedInt P = 4, Q = 5;
+  CeedScalar interp[2*2] = {1.0, 0.0, 0.0, 1.0},
+             grad[2*2] = {-0.5, 0.5, -0.5, 0.5},
+             qref[2] = {-1.0, 1.0}, qweight[2] = {1.0, 1.0};
+
+  CeedInit(argv[1], &ceed);
+
+  // Lagrange bases with the same sizes and quadrature are shared
+  CeedBasisCreateTensorH1Lagrange(ceed, 2, 1, P, Q, CEED_GAUSS, &b[0]);
+  CeedBasisCreateTensorH1Lagrange(ceed, 2, 1, P, Q, CEED_GAUSS, &b[1]);
+  CeedBasisCreateTensorH1Lagrange(ceed, 2, 1, P, Q, CEED_GAUSS_LOBATTO, &b[2]);
+  CeedBasisCreateTensorH1Lagrange(ceed, 2, 2, P, Q, CEED_GAUSS, &b[3]);
+  if (b[1] != b[0])
+    // LCOV_EXCL_START
+    printf("Identical Lagrange bases are not shared\n");
+  // LCOV_EXCL_STOP
+  if (b[2] == b[0] || b[3] == b[0])
+    // LCOV_EXCL_START
+    printf("Distinct Lagrange bases are shared\n");
+  // LCOV_EXCL_STOP
+
+  // A shared basis remains usable until its last reference is destroyed
+  CeedBasisDestroy(&b[0]);
+  CheckInterp(ceed, b[1], P, Q);
+  CeedBasisDestroy(&b[1]);
+  CeedBasisCreateTensorH1Lagrange(ceed, 2, 1, P, Q, CEED_GAUSS, &b[0]);
+  CheckInterp(ceed, b[0], P, Q);
+
+  // Bases from the same matrices and quadrature are shared
+  CeedBasisCreateTensorH1(ceed, 2, 1, 2, 2, interp, grad, qref, qweight,
+                          &h[0]);
+  CeedBasisCreateTensorH1(ceed, 2, 1, 2, 2, interp, grad, qref, qweight,
+                          &h[1]);
+  qweight[1] = 0.5;
+  CeedBasisCreateTensorH1(ceed, 2, 1, 2, 2, interp, grad, qref, qweight,
+                          &h[2]);
+  if (h[1] != h[0])
+    // LCOV_EXCL_START
+    printf("Identical bases are not shared\n");
+  // LCOV_EXCL_STOP
+  if (h[2] == h[0])
+    // LCOV_EXCL_START
+    printf("Bases with distinct quadrature weights are shared\n");
+  // LCOV_EXCL_STOP
+
+  CeedBasisDestroy(&b[0]);
+  CeedBasisDestroy(&b[2]);
+  CeedBasisDestroy(&b[3]);
+  for (CeedInt i=0; i<3; i++)
+    CeedBasisDestroy(&h[i]);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,59 @@
+/// @file
+/// Test vectorizable math functions in qfunction
+/// \test Test vectorizable math functions in qfunction
+#include <ceed.h>
+#include <math.h>
+
+#include "t403-qfunction.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector in[16], out[16];
+  CeedVector U, V;
+  CeedQFunction qf_math;
+  CeedInt Q = 32;
+  const CeedScalar *vv;
+  CeedScalar u[Q];
+  const char *names[5] = {"exp", "log", "log1p", "pow", "sqrt"};
+
+  CeedInit(argv[1], &ceed);
+
+  CeedQFunctionCreateInterior(ceed, 1, eval_math, eval_math_loc, &qf_math);
+  CeedQFunctionAddInput(qf_math, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_math, "v", 5, CEED_EVAL_INTERP);
+
+  // Arguments spanning several orders of magnitude
+  for (CeedInt i=0; i<Q; i++)
+    u[i] = pow(10., -8 + 10.*i/(Q-1));
+
+  CeedVectorCreate(ceed, Q, &U);
+  CeedVectorSetArray(U, CEED_MEM_HOST, CEED_USE_POINTER, u);
+  CeedVectorCreate(ceed, 5*Q, &V);
+  CeedVectorSetValue(V, 0);
+
+  {
+    in[0] = U;
+    out[0] = V;
+    CeedQFunctionApply(qf_math, Q, in, out);
+  }
+
+  CeedVectorGetArrayRead(V, CEED_MEM_HOST, &vv);
+  for (CeedInt i=0; i<Q; i++) {
+    const CeedScalar exact[5] = {exp(u[i]), log(u[i]), log1p(u[i]),
+                                 pow(u[i], 2.5), sqrt(u[i])
+                                };
+    for (CeedInt j=0; j<5; j++)
+      if (fabs(vv[i+j*Q] - exact[j]) > 1e-14*fabs(exact[j]))
+        // LCOV_EXCL_START
+        printf("[%d] %s(%e) %.16e != %.16e\n", i, names[j], u[i], vv[i+j*Q],
+               exact[j]);
+    // LCOV_EXCL_STOP
+  }
+  CeedVectorRestoreArrayRead(V, &vv);
+
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedQFunctionDestroy(&qf_math);
+  CeedDestroy(&ceed);
+  return 0;
+}
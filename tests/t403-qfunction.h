@@ -0,0 +1,33 @@
+// Copyright (c) 2017-2018, Lawrence Livermore National Security, LLC.
+// Produced at the Lawrence Livermore National Laboratory. LLNL-CODE-734707.
+// All Rights reserved. See files LICENSE and NOTICE for details.
+//
+// This file is part of CEED, a collection of benchmarks, miniapps, software
+// libraries and APIs for efficient high-order finite element and spectral
+// element discretizations for exascale applications. For more information and
+// source code availability see http://github.com/ceed.
+//
+// The CEED research is supported by the Exascale Computing Project 17-SC-20-SC,
+// a collaborative effort of two U.S. Department of Energy organizations (Office
+// of Science and the National Nuclear Security Administration) responsible for
+// the planning and preparation of a capable exascale ecosystem, including
+// software, applications, hardware, advanced system engineering and early
+// testbed platforms, in support of the nation's exascale computing imperative.
+
+#include <ceed-math.h>
+
+CEED_QFUNCTION(eval_math)(void *ctx, const CeedInt Q,
+                          const CeedScalar *const *in,
+                          CeedScalar *const *out) {
+  const CeedScalar *u = in[0];
+  CeedScalar *v = out[0];
+  CeedPragmaSIMD
+  for (CeedInt i=0; i<Q; i++) {
+    v[i+0*Q] = CeedExp(u[i]);
+    v[i+1*Q] = CeedLog(u[i]);
+    v[i+2*Q] = CeedLog1p(u[i]);
+    v[i+3*Q] = CeedPow(u[i], 2.5);
+    v[i+4*Q] = CeedSqrt(u[i]);
+  }
+  return 0;
+}
@@ -0,0 +1,98 @@
+/// @file
+/// Test compile-time specialized C++ qfunction against gallery qfunction
+/// \test Test compile-time specialized C++ qfunction against gallery qfunction
+#include <ceed.hpp>
+#include <math.h>
+#include <stdio.h>
+
+// Poisson3DApply written with typed field views
+struct Poisson3D {
+  template <CeedInt QC>
+  static int Apply(void *ctx, CeedInt Q, const CeedScalar *const *in,
+                   CeedScalar *const *out) {
+    const ceed::Field<const CeedScalar, 3, QC> ug(in[0], Q);
+    const ceed::Field<const CeedScalar, 6, QC> qd(in[1], Q);
+    const ceed::Field<CeedScalar, 3, QC> vg(out[0], Q);
+    const CeedInt npts = vg.Size();
+
+    CeedPragmaSIMD
+    for (CeedInt i=0; i<npts; i++) {
+      CeedScalar du[3], q[6];
+      ug.Load(i, du);
+      qd.Load(i, q);
+      // Voigt ordering of the symmetric matrix
+      const CeedScalar v[3] = {du[0]*q[0] + du[1]*q[5] + du[2]*q[4],
+                               du[0]*q[5] + du[1]*q[1] + du[2]*q[3],
+                               du[0]*q[4] + du[1]*q[3] + du[2]*q[2]
+                              };
+      vg.Store(i, v);
+    }
+    return 0;
+  }
+};
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedVector in[16], out[16];
+  CeedVector DU, QD, V, Vtrue;
+  CeedQFunction qf_gallery, qf_spec;
+  const CeedInt Qmax = 8*ceed::BlockSize;
+
+  CeedInit(argv[1], &ceed);
+
+  CeedQFunctionCreateInteriorByName(ceed, "Poisson3DApply", &qf_gallery);
+  CeedQFunctionCreateInterior(ceed, 1,
+                              ceed::QFunction<Poisson3D, 8, 8*ceed::BlockSize>,
+                              __FILE__ ":Poisson3D", &qf_spec);
+  CeedQFunctionAddInput(qf_spec, "du", 3, CEED_EVAL_GRAD);
+  CeedQFunctionAddInput(qf_spec, "qdata", 6, CEED_EVAL_NONE);
+  CeedQFunctionAddOutput(qf_spec, "dv", 3, CEED_EVAL_GRAD);
+
+  // Specialized sizes and the runtime fallback
+  const CeedInt Qs[3] = {8, Qmax, 5};
+  for (CeedInt k=0; k<3; k++) {
+    const CeedInt Q = Qs[k];
+    CeedScalar *du, *qd;
+    const CeedScalar *v, *vtrue;
+
+    CeedVectorCreate(ceed, 3*Q, &DU);
+    CeedVectorCreate(ceed, 6*Q, &QD);
+    CeedVectorCreate(ceed, 3*Q, &V);
+    CeedVectorCreate(ceed, 3*Q, &Vtrue);
+    CeedVectorGetArray(DU, CEED_MEM_HOST, &du);
+    for (CeedInt i=0; i<3*Q; i++)
+      du[i] = sin(i);
+    CeedVectorRestoreArray(DU, &du);
+    CeedVectorGetArray(QD, CEED_MEM_HOST, &qd);
+    for (CeedInt i=0; i<6*Q; i++)
+      qd[i] = cos(i);
+    CeedVectorRestoreArray(QD, &qd);
+
+    in[0] = DU;
+    in[1] = QD;
+    out[0] = Vtrue;
+    CeedQFunctionApply(qf_gallery, Q, in, out);
+    out[0] = V;
+    CeedQFunctionApply(qf_spec, Q, in, out);
+
+    CeedVectorGetArrayRead(V, CEED_MEM_HOST, &v);
+    CeedVectorGetArrayRead(Vtrue, CEED_MEM_HOST, &vtrue);
+    for (CeedInt i=0; i<3*Q; i++)
+      if (fabs(v[i] - vtrue[i]) > 1e-14)
+        // LCOV_EXCL_START
+        printf("[%d] Q=%d v %f != vtrue %f\n", i, Q, v[i], vtrue[i]);
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArrayRead(V, &v);
+    CeedVectorRestoreArrayRead(Vtrue, &vtrue);
+
+    CeedVectorDestroy(&DU);
+    CeedVectorDestroy(&QD);
+    CeedVectorDestroy(&V);
+    CeedVectorDestroy(&Vtrue);
+  }
+
+  CeedQFunctionDestroy(&qf_gallery);
+  CeedQFunctionDestroy(&qf_spec);
+  CeedDestroy(&ceed);
+  return 0;
+}
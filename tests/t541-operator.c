@@ -0,0 +1,157 @@
+/// @file
+/// Test concurrent application of operators sharing objects from several threads
+/// \test Test concurrent application of operators sharing objects from several threads
+#define _POSIX_C_SOURCE 200112
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+#include <pthread.h>
+
+#include "t541-operator.h"
+
+#define NTHREADS 4
+
+// Objects shared by all threads
+typedef struct {
+  Ceed ceed;
+  CeedElemRestriction Erestrictu, Erestrictui;
+  CeedBasis bu;
+  CeedQFunction qf_mass;
+  CeedVector qdata, U;
+  CeedInt Nu;
+} Shared;
+
+typedef struct {
+  Shared *shared;
+  CeedVector V;
+} Work;
+
+// Each thread builds its own operator from the shared objects, applies it
+//   repeatedly into its own output vector, and destroys it
+static void *ApplyMass(void *arg) {
+  Work *work = arg;
+  Shared *s = work->shared;
+  CeedOperator op_mass;
+
+  CeedOperatorCreate(s->ceed, s->qf_mass, CEED_QFUNCTION_NONE,
+                     CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "rho", s->Erestrictui, CEED_BASIS_COLLOCATED,
+                       s->qdata);
+  CeedOperatorSetField(op_mass, "u", s->Erestrictu, s->bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", s->Erestrictu, s->bu, CEED_VECTOR_ACTIVE);
+
+  for (CeedInt i=0; i<50; i++)
+    CeedOperatorApply(op_mass, s->U, work->V, CEED_REQUEST_IMMEDIATE);
+
+  CeedOperatorDestroy(&op_mass);
+  return NULL;
+}
+
+int main(int argc, char **argv) {
+  Shared s;
+  Work work[NTHREADS];
+  pthread_t threads[NTHREADS];
+  CeedElemRestriction Erestrictx;
+  CeedBasis bx;
+  CeedQFunction qf_setup;
+  CeedQFunctionContext ctx;
+  CeedOperator op_setup;
+  CeedVector X;
+  CeedInt nelem = 15, P = 5, Q = 8;
+  CeedInt Nx = nelem+1, Nu = nelem*(P-1)+1;
+  CeedInt indx[nelem*2], indu[nelem*P];
+  CeedScalar x[Nx], scale = 2.0;
+
+  CeedInit(argv[1], &s.ceed);
+  s.Nu = Nu;
+
+  for (CeedInt i=0; i<Nx; i++)
+    x[i] = (CeedScalar) i / (Nx - 1);
+  for (CeedInt i=0; i<nelem; i++) {
+    indx[2*i+0] = i;
+    indx[2*i+1] = i+1;
+  }
+  CeedElemRestrictionCreate(s.ceed, nelem, 2, 1, 1, Nx, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictx);
+  for (CeedInt i=0; i<nelem; i++)
+    for (CeedInt j=0; j<P; j++)
+      indu[P*i+j] = i*(P-1) + j;
+  CeedElemRestrictionCreate(s.ceed, nelem, P, 1, 1, Nu, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indu, &s.Erestrictu);
+  CeedInt stridesu[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(s.ceed, nelem, Q, 1, Q*nelem, stridesu,
+                                   &s.Erestrictui);
+
+  CeedBasisCreateTensorH1Lagrange(s.ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(s.ceed, 1, 1, P, Q, CEED_GAUSS, &s.bu);
+
+  CeedQFunctionCreateInterior(s.ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(s.ceed, 1, scaled_mass, scaled_mass_loc,
+                              &s.qf_mass);
+  CeedQFunctionAddInput(s.qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(s.qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(s.qf_mass, "v", 1, CEED_EVAL_INTERP);
+  CeedQFunctionContextCreate(s.ceed, &ctx);
+  CeedQFunctionContextSetData(ctx, CEED_MEM_HOST, CEED_USE_POINTER,
+                              sizeof(scale), &scale);
+  CeedQFunctionSetContext(s.qf_mass, ctx);
+
+  CeedOperatorCreate(s.ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", s.Erestrictui, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  CeedVectorCreate(s.ceed, Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(s.ceed, nelem*Q, &s.qdata);
+  CeedOperatorApply(op_setup, X, s.qdata, CEED_REQUEST_IMMEDIATE);
+
+  CeedVectorCreate(s.ceed, Nu, &s.U);
+  CeedVectorSetValue(s.U, 1.0);
+
+  // Apply from several threads at once
+  for (CeedInt t=0; t<NTHREADS; t++) {
+    work[t].shared = &s;
+    CeedVectorCreate(s.ceed, Nu, &work[t].V);
+    pthread_create(&threads[t], NULL, ApplyMass, &work[t]);
+  }
+  for (CeedInt t=0; t<NTHREADS; t++)
+    pthread_join(threads[t], NULL);
+
+  // Each output integrates the scaled mass over the unit interval
+  for (CeedInt t=0; t<NTHREADS; t++) {
+    const CeedScalar *v;
+    CeedScalar sum = 0.;
+    CeedVectorGetArrayRead(work[t].V, CEED_MEM_HOST, &v);
+    for (CeedInt i=0; i<Nu; i++)
+      sum += v[i];
+    CeedVectorRestoreArrayRead(work[t].V, &v);
+    if (fabs(sum - scale) > 1e-10)
+      // LCOV_EXCL_START
+      printf("Thread %d computed area: %f != %f\n", t, sum, scale);
+    // LCOV_EXCL_STOP
+    CeedVectorDestroy(&work[t].V);
+  }
+
+  CeedQFunctionContextDestroy(&ctx);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&s.qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedElemRestrictionDestroy(&s.Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&s.Erestrictui);
+  CeedBasisDestroy(&s.bu);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&s.U);
+  CeedVectorDestroy(&s.qdata);
+  CeedDestroy(&s.ceed);
+  return 0;
+}
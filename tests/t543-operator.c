@@ -0,0 +1,179 @@
+/// @file
+/// Test scaled application of mass matrix operator and composite operator
+/// \test Test scaled application of mass matrix operator and composite operator
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t502-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictu, Erestrictui;
+  CeedBasis bx, bu;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup, op_mass, op_composite;
+  CeedVector qdata, X, U, V, W, S;
+  const CeedScalar *hv, *hw;
+  CeedScalar *hu, *hs;
+  CeedInt nelem = 15, P = 5, Q = 8, ncomp = 2;
+  CeedInt Nx = nelem+1, Nu = nelem*(P-1)+1;
+  CeedInt indx[nelem*2], indu[nelem*P];
+  CeedScalar x[Nx];
+  const CeedScalar alpha = 0.5, beta = -2.0;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i=0; i<Nx; i++)
+    x[i] = (CeedScalar) i / (Nx - 1);
+  for (CeedInt i=0; i<nelem; i++) {
+    indx[2*i+0] = i;
+    indx[2*i+1] = i+1;
+  }
+  // Restrictions
+  CeedElemRestrictionCreate(ceed, nelem, 2, 1, 1, Nx, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictx);
+
+  for (CeedInt i=0; i<nelem; i++) {
+    for (CeedInt j=0; j<P; j++) {
+      indu[P*i+j] = i*(P-1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, nelem, P, ncomp, Nu, ncomp*Nu, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indu, &Erestrictu);
+
+  CeedInt stridesu[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, Q*nelem, stridesu,
+                                   &Erestrictui);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, ncomp, P, Q, CEED_GAUSS, &bu);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weights", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1*1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "qdata", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "qdata", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", ncomp, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", ncomp, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass);
+
+  CeedVectorCreate(ceed, Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, nelem*Q, &qdata);
+
+  CeedOperatorSetField(op_setup, "weights", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "qdata", Erestrictui, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  CeedOperatorSetField(op_mass, "qdata", Erestrictui, CEED_BASIS_COLLOCATED,
+                       qdata);
+  CeedOperatorSetField(op_mass, "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+
+  // Composite operator, twice the mass matrix
+  CeedCompositeOperatorCreate(ceed, &op_composite);
+  CeedCompositeOperatorAddSub(op_composite, op_mass);
+  CeedCompositeOperatorAddSub(op_composite, op_mass);
+
+  // Vectors
+  CeedVectorCreate(ceed, ncomp*Nu, &U);
+  CeedVectorGetArray(U, CEED_MEM_HOST, &hu);
+  for (CeedInt i=0; i<ncomp*Nu; i++)
+    hu[i] = sin(i);
+  CeedVectorRestoreArray(U, &hu);
+  CeedVectorCreate(ceed, ncomp*Nu, &S);
+  CeedVectorGetArray(S, CEED_MEM_HOST, &hs);
+  for (CeedInt i=0; i<ncomp*Nu; i++)
+    hs[i] = 1. + i % 3;
+  CeedVectorRestoreArray(S, &hs);
+  CeedVectorCreate(ceed, ncomp*Nu, &V);
+  CeedVectorCreate(ceed, ncomp*Nu, &W);
+
+  for (CeedInt k=0; k<2; k++) {
+    CeedOperator op = k ? op_composite : op_mass;
+
+    // Scaled apply
+    CeedOperatorApply(op, U, W, CEED_REQUEST_IMMEDIATE);
+    CeedOperatorApplyScaled(op, U, V, S, CEED_REQUEST_IMMEDIATE);
+
+    // Check output
+    CeedVectorGetArrayRead(V, CEED_MEM_HOST, &hv);
+    CeedVectorGetArrayRead(W, CEED_MEM_HOST, &hw);
+    CeedVectorGetArray(S, CEED_MEM_HOST, &hs);
+    for (CeedInt i=0; i<ncomp*Nu; i++)
+      if (fabs(hv[i] - hs[i]*hw[i]) > 1e-14)
+        // LCOV_EXCL_START
+        printf("[%d] Scaled apply %f != %f\n", i, hv[i], hs[i]*hw[i]);
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArray(S, &hs);
+    CeedVectorRestoreArrayRead(W, &hw);
+    CeedVectorRestoreArrayRead(V, &hv);
+
+    // Scaled apply add, with V = S D op(U) from above
+    CeedOperatorApplyScaledAdd(op, U, V, alpha, beta, S,
+                               CEED_REQUEST_IMMEDIATE);
+
+    // Check output
+    CeedVectorGetArrayRead(V, CEED_MEM_HOST, &hv);
+    CeedVectorGetArrayRead(W, CEED_MEM_HOST, &hw);
+    CeedVectorGetArray(S, CEED_MEM_HOST, &hs);
+    for (CeedInt i=0; i<ncomp*Nu; i++)
+      if (fabs(hv[i] - (alpha + beta)*hs[i]*hw[i]) > 1e-14)
+        // LCOV_EXCL_START
+        printf("[%d] Scaled apply add %f != %f\n", i, hv[i],
+               (alpha + beta)*hs[i]*hw[i]);
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArray(S, &hs);
+    CeedVectorRestoreArrayRead(W, &hw);
+    CeedVectorRestoreArrayRead(V, &hv);
+
+    // Unscaled apply add, with V = (alpha + beta) S op(U) from above
+    CeedOperatorApplyScaledAdd(op, U, V, 0.0, beta, CEED_VECTOR_NONE,
+                               CEED_REQUEST_IMMEDIATE);
+
+    // Check output
+    CeedVectorGetArrayRead(V, CEED_MEM_HOST, &hv);
+    CeedVectorGetArrayRead(W, CEED_MEM_HOST, &hw);
+    for (CeedInt i=0; i<ncomp*Nu; i++)
+      if (fabs(hv[i] - beta*hw[i]) > 1e-14)
+        // LCOV_EXCL_START
+        printf("[%d] Unscaled apply add %f != %f\n", i, hv[i], beta*hw[i]);
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArrayRead(W, &hw);
+    CeedVectorRestoreArrayRead(V, &hv);
+  }
+
+  // Cleanup
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_composite);
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedVectorDestroy(&W);
+  CeedVectorDestroy(&S);
+  CeedVectorDestroy(&qdata);
+  CeedDestroy(&ceed);
+  return 0;
+}
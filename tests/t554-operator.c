@@ -0,0 +1,246 @@
+/// @file
+/// Test creation, action, and destruction for composite mass matrix operator with multigrid hierarchy
+/// \test Test creation, action, and destruction for composite mass matrix operator with multigrid hierarchy
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t502-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictui, Erestrictu[3];
+  CeedBasis bx, bu[3];
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup, op_mass, op_fine, op_coarse, op_level,
+               op_prolong, op_restrict;
+  CeedMultigrid mg;
+  CeedVector qdata, X, U[3], V[3], W[2], PMult[2];
+  const CeedScalar *hv, *hw;
+  CeedInt nelem = 15, P[3] = {5, 3, 2}, Q = 8, ncomp = 2, numlevels;
+  CeedInt Nx = nelem+1, Nu[3], indx[nelem*2];
+  CeedScalar x[Nx];
+  CeedScalar sum;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i=0; i<Nx; i++)
+    x[i] = (CeedScalar) i / (Nx - 1);
+  for (CeedInt i=0; i<nelem; i++) {
+    indx[2*i+0] = i;
+    indx[2*i+1] = i+1;
+  }
+  // Restrictions
+  CeedElemRestrictionCreate(ceed, nelem, 2, 1, 1, Nx, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictx);
+
+  for (CeedInt l=0; l<3; l++) {
+    CeedInt indu[nelem*P[l]];
+    Nu[l] = nelem*(P[l]-1)+1;
+    for (CeedInt i=0; i<nelem; i++) {
+      for (CeedInt j=0; j<P[l]; j++) {
+        indu[P[l]*i+j] = i*(P[l]-1) + j;
+      }
+    }
+    CeedElemRestrictionCreate(ceed, nelem, P[l], ncomp, Nu[l], ncomp*Nu[l],
+                              CEED_MEM_HOST, CEED_COPY_VALUES, indu,
+                              &Erestrictu[l]);
+  }
+
+  CeedInt stridesu[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, Q*nelem, stridesu,
+                                   &Erestrictui);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+  for (CeedInt l=0; l<3; l++)
+    CeedBasisCreateTensorH1Lagrange(ceed, 1, ncomp, P[l], Q, CEED_GAUSS,
+                                    &bu[l]);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weights", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1*1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "qdata", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "qdata", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", ncomp, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", ncomp, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass);
+
+  CeedVectorCreate(ceed, Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, nelem*Q, &qdata);
+
+  CeedOperatorSetField(op_setup, "weights", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "qdata", Erestrictui, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  CeedOperatorSetField(op_mass, "qdata", Erestrictui, CEED_BASIS_COLLOCATED,
+                       qdata);
+  CeedOperatorSetField(op_mass, "u", Erestrictu[0], bu[0], CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", Erestrictu[0], bu[0], CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+
+  // Composite fine grid operator, twice the mass matrix
+  CeedCompositeOperatorCreate(ceed, &op_fine);
+  CeedCompositeOperatorAddSub(op_fine, op_mass);
+  CeedCompositeOperatorAddSub(op_fine, op_mass);
+
+  // Create multigrid hierarchy
+  for (CeedInt l=0; l<2; l++) {
+    CeedVectorCreate(ceed, ncomp*Nu[l], &PMult[l]);
+    CeedVectorSetValue(PMult[l], 1.0);
+  }
+  CeedMultigridCreate(op_fine, 3, PMult, &Erestrictu[1], &bu[1], &mg);
+  CeedMultigridGetNumLevels(mg, &numlevels);
+  if (numlevels != 3)
+    // LCOV_EXCL_START
+    printf("Incorrect number of levels: %d != 3\n", numlevels);
+  // LCOV_EXCL_STOP
+
+  for (CeedInt l=0; l<3; l++) {
+    CeedVectorCreate(ceed, ncomp*Nu[l], &U[l]);
+    CeedVectorCreate(ceed, ncomp*Nu[l], &V[l]);
+  }
+
+  // Coarsest problem
+  CeedVectorSetValue(U[2], 1.0);
+  CeedMultigridGetOperator(mg, 2, &op_coarse);
+  CeedOperatorApply(op_coarse, U[2], V[2], CEED_REQUEST_IMMEDIATE);
+
+  // Check output
+  CeedVectorGetArrayRead(V[2], CEED_MEM_HOST, &hv);
+  sum = 0.;
+  for (CeedInt i=0; i<ncomp*Nu[2]; i++) {
+    sum += hv[i];
+  }
+  if (fabs(sum-4.)>1e-10)
+    // LCOV_EXCL_START
+    printf("Computed Area Coarsest Grid: %f != True Area: 4.0\n", sum);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V[2], &hv);
+
+  // Prolong to fine grid and apply fine problem
+  CeedMultigridProlong(mg, 1, U[2], U[1], CEED_REQUEST_IMMEDIATE);
+  CeedMultigridProlong(mg, 0, U[1], U[0], CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_fine, U[0], V[0], CEED_REQUEST_IMMEDIATE);
+
+  // Check output
+  CeedVectorGetArrayRead(V[0], CEED_MEM_HOST, &hv);
+  sum = 0.;
+  for (CeedInt i=0; i<ncomp*Nu[0]; i++) {
+    sum += hv[i];
+  }
+  if (fabs(sum-4.)>1e-10)
+    // LCOV_EXCL_START
+    printf("Computed Area Fine Grid: %f != True Area: 4.0\n", sum);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V[0], &hv);
+
+  // Restrict to coarsest grid
+  CeedMultigridRestrict(mg, 0, V[0], V[1], CEED_REQUEST_IMMEDIATE);
+  CeedMultigridRestrict(mg, 1, V[1], V[2], CEED_REQUEST_IMMEDIATE);
+
+  // Check output
+  CeedVectorGetArrayRead(V[2], CEED_MEM_HOST, &hv);
+  sum = 0.;
+  for (CeedInt i=0; i<ncomp*Nu[2]; i++) {
+    sum += hv[i];
+  }
+  if (fabs(sum-4.)>1e-10)
+    // LCOV_EXCL_START
+    printf("Computed Area Coarsest Grid: %f != True Area: 4.0\n", sum);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V[2], &hv);
+
+  // Compare first level with single level creation
+  CeedOperatorMultigridLevelCreate(op_fine, PMult[0], Erestrictu[1], bu[1],
+                                   &op_level, &op_prolong, &op_restrict);
+  for (CeedInt l=0; l<2; l++)
+    CeedVectorCreate(ceed, ncomp*Nu[l], &W[l]);
+
+  // -- Prolongation
+  {
+    CeedScalar *hu;
+    CeedVectorGetArray(U[1], CEED_MEM_HOST, &hu);
+    for (CeedInt i=0; i<ncomp*Nu[1]; i++)
+      hu[i] = sin(i);
+    CeedVectorRestoreArray(U[1], &hu);
+  }
+  CeedMultigridProlong(mg, 0, U[1], U[0], CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_prolong, U[1], W[0], CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetArrayRead(U[0], CEED_MEM_HOST, &hv);
+  CeedVectorGetArrayRead(W[0], CEED_MEM_HOST, &hw);
+  for (CeedInt i=0; i<ncomp*Nu[0]; i++)
+    if (fabs(hv[i]-hw[i])>1e-12)
+      // LCOV_EXCL_START
+      printf("[%d] Prolongation %f != %f\n", i, hv[i], hw[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(U[0], &hv);
+  CeedVectorRestoreArrayRead(W[0], &hw);
+
+  // -- Restriction
+  CeedMultigridRestrict(mg, 0, U[0], V[1], CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_restrict, U[0], W[1], CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetArrayRead(V[1], CEED_MEM_HOST, &hv);
+  CeedVectorGetArrayRead(W[1], CEED_MEM_HOST, &hw);
+  for (CeedInt i=0; i<ncomp*Nu[1]; i++)
+    if (fabs(hv[i]-hw[i])>1e-12)
+      // LCOV_EXCL_START
+      printf("[%d] Restriction %f != %f\n", i, hv[i], hw[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V[1], &hv);
+  CeedVectorRestoreArrayRead(W[1], &hw);
+
+  // -- Coarse operator
+  CeedMultigridGetOperator(mg, 1, &op_coarse);
+  CeedOperatorApply(op_coarse, U[1], V[1], CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_level, U[1], W[1], CEED_REQUEST_IMMEDIATE);
+  CeedVectorGetArrayRead(V[1], CEED_MEM_HOST, &hv);
+  CeedVectorGetArrayRead(W[1], CEED_MEM_HOST, &hw);
+  for (CeedInt i=0; i<ncomp*Nu[1]; i++)
+    if (fabs(hv[i]-hw[i])>1e-12)
+      // LCOV_EXCL_START
+      printf("[%d] Coarse operator %f != %f\n", i, hv[i], hw[i]);
+  // LCOV_EXCL_STOP
+  CeedVectorRestoreArrayRead(V[1], &hv);
+  CeedVectorRestoreArrayRead(W[1], &hw);
+
+  // Cleanup
+  CeedMultigridDestroy(&mg);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_fine);
+  CeedOperatorDestroy(&op_level);
+  CeedOperatorDestroy(&op_prolong);
+  CeedOperatorDestroy(&op_restrict);
+  for (CeedInt l=0; l<3; l++) {
+    CeedElemRestrictionDestroy(&Erestrictu[l]);
+    CeedBasisDestroy(&bu[l]);
+    CeedVectorDestroy(&U[l]);
+    CeedVectorDestroy(&V[l]);
+  }
+  for (CeedInt l=0; l<2; l++) {
+    CeedVectorDestroy(&W[l]);
+    CeedVectorDestroy(&PMult[l]);
+  }
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&qdata);
+  CeedDestroy(&ceed);
+  return 0;
+}
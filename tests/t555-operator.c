@@ -0,0 +1,164 @@
+/// @file
+/// Test operator with interpolated values and gradients of the same field
+/// \test Test operator with interpolated values and gradients of the same field
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t555-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictu, Erestrictui;
+  CeedBasis bx, bu, bdu;
+  CeedQFunction qf_setup, qf_interpgrad;
+  CeedOperator op_setup, op_fused, op_split, op_composite;
+  CeedVector qdata, X, U, V, W;
+  const CeedScalar *hv, *hw, *interp1d, *grad1d, *qref1d, *qweight1d;
+  CeedScalar *hu;
+  CeedInt nelem = 15, P = 5, Q = 8, ncomp = 2;
+  CeedInt Nx = nelem+1, Nu = nelem*(P-1)+1;
+  CeedInt indx[nelem*2], indu[nelem*P];
+  CeedScalar x[Nx];
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i=0; i<Nx; i++)
+    x[i] = (CeedScalar) i / (Nx - 1);
+  for (CeedInt i=0; i<nelem; i++) {
+    indx[2*i+0] = i;
+    indx[2*i+1] = i+1;
+  }
+  // Restrictions
+  CeedElemRestrictionCreate(ceed, nelem, 2, 1, 1, Nx, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictx);
+
+  for (CeedInt i=0; i<nelem; i++) {
+    for (CeedInt j=0; j<P; j++) {
+      indu[P*i+j] = i*(P-1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, nelem, P, ncomp, Nu, ncomp*Nu, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indu, &Erestrictu);
+
+  CeedInt stridesu[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, Q*nelem, stridesu,
+                                   &Erestrictui);
+
+  // Bases; bdu is a distinct basis with the matrices of bu, so the gradient
+  //   is evaluated apart
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, ncomp, P, Q, CEED_GAUSS, &bu);
+  CeedBasisGetInterp1D(bu, &interp1d);
+  CeedBasisGetGrad1D(bu, &grad1d);
+  CeedBasisGetQRef(bu, &qref1d);
+  CeedBasisGetQWeights(bu, &qweight1d);
+  CeedBasisCreateH1(ceed, CEED_LINE, ncomp, P, Q, interp1d, grad1d, qref1d,
+                    qweight1d, &bdu);
+  if (bdu == bu)
+    // LCOV_EXCL_START
+    printf("Basis for du is shared with u\n");
+  // LCOV_EXCL_STOP
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weights", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1*1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "qdata", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, interpgrad, interpgrad_loc,
+                              &qf_interpgrad);
+  CeedQFunctionAddInput(qf_interpgrad, "qdata", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_interpgrad, "u", ncomp, CEED_EVAL_INTERP);
+  CeedQFunctionAddInput(qf_interpgrad, "du", ncomp*1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_interpgrad, "v", ncomp, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_interpgrad, "dv", ncomp*1, CEED_EVAL_GRAD);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+  CeedOperatorCreate(ceed, qf_interpgrad, CEED_QFUNCTION_NONE,
+                     CEED_QFUNCTION_NONE, &op_fused);
+  CeedOperatorCreate(ceed, qf_interpgrad, CEED_QFUNCTION_NONE,
+                     CEED_QFUNCTION_NONE, &op_split);
+
+  CeedVectorCreate(ceed, Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, nelem*Q, &qdata);
+
+  CeedOperatorSetField(op_setup, "weights", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "qdata", Erestrictui, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  CeedOperatorSetField(op_fused, "qdata", Erestrictui, CEED_BASIS_COLLOCATED,
+                       qdata);
+  CeedOperatorSetField(op_fused, "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_fused, "du", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_fused, "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_fused, "dv", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorSetField(op_split, "qdata", Erestrictui, CEED_BASIS_COLLOCATED,
+                       qdata);
+  CeedOperatorSetField(op_split, "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_split, "du", Erestrictu, bdu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_split, "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_split, "dv", Erestrictu, bdu, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+
+  // Composite operator, sharing the active restriction
+  CeedCompositeOperatorCreate(ceed, &op_composite);
+  CeedCompositeOperatorAddSub(op_composite, op_fused);
+  CeedCompositeOperatorAddSub(op_composite, op_fused);
+
+  // Vectors
+  CeedVectorCreate(ceed, ncomp*Nu, &U);
+  CeedVectorGetArray(U, CEED_MEM_HOST, &hu);
+  for (CeedInt i=0; i<ncomp*Nu; i++)
+    hu[i] = sin(i);
+  CeedVectorRestoreArray(U, &hu);
+  CeedVectorCreate(ceed, ncomp*Nu, &V);
+  CeedVectorCreate(ceed, ncomp*Nu, &W);
+
+  for (CeedInt k=0; k<2; k++) {
+    // Apply with and without a shared basis for u and du
+    CeedOperatorApply(k ? op_composite : op_fused, U, V,
+                      CEED_REQUEST_IMMEDIATE);
+    CeedOperatorApply(op_split, U, W, CEED_REQUEST_IMMEDIATE);
+
+    // Check output
+    CeedVectorGetArrayRead(V, CEED_MEM_HOST, &hv);
+    CeedVectorGetArrayRead(W, CEED_MEM_HOST, &hw);
+    for (CeedInt i=0; i<ncomp*Nu; i++)
+      if (fabs(hv[i] - (k+1)*hw[i]) > 1e-13)
+        // LCOV_EXCL_START
+        printf("[%d] %s apply %f != %f\n", i, k ? "Composite" : "Single",
+               hv[i], (k+1)*hw[i]);
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArrayRead(V, &hv);
+    CeedVectorRestoreArrayRead(W, &hw);
+  }
+
+  // Cleanup
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_interpgrad);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_fused);
+  CeedOperatorDestroy(&op_split);
+  CeedOperatorDestroy(&op_composite);
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bx);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bdu);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedVectorDestroy(&W);
+  CeedVectorDestroy(&qdata);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,152 @@
+/// @file
+/// Test mass matrix operator with reduced precision qdata storage
+/// \test Test mass matrix operator with reduced precision qdata storage
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t500-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictu, Erestrictui;
+  CeedBasis bx, bu;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup, op_mass[3];
+  CeedVector qdata, X, U, V[3];
+  CeedScalar *hu;
+  const CeedScalar *hv[3];
+  CeedFieldPrecision prec[3] = {CEED_PRECISION_SCALAR, CEED_PRECISION_FP32,
+                                CEED_PRECISION_BF16
+                               };
+  CeedScalar tol[3] = {1e-10, 1e-6, 1e-2};
+  CeedInt nelem = 15, P = 5, Q = 8;
+  CeedInt Nx = nelem+1, Nu = nelem*(P-1)+1;
+  CeedInt indx[nelem*2], indu[nelem*P];
+  CeedScalar x[Nx];
+  CeedScalar sum, sum0 = 0., scale = 1.0;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i=0; i<Nx; i++)
+    x[i] = (CeedScalar) i / (Nx - 1);
+  for (CeedInt i=0; i<nelem; i++) {
+    indx[2*i+0] = i;
+    indx[2*i+1] = i+1;
+  }
+  // Restrictions
+  CeedElemRestrictionCreate(ceed, nelem, 2, 1, 1, Nx, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictx);
+
+  for (CeedInt i=0; i<nelem; i++) {
+    for (CeedInt j=0; j<P; j++) {
+      indu[P*i+j] = i*(P-1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, nelem, P, 1, 1, Nu, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indu, &Erestrictu);
+  CeedInt stridesu[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, Q*nelem, stridesu,
+                                   &Erestrictui);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &bu);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+
+  CeedVectorCreate(ceed, Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, nelem*Q, &qdata);
+
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  // Mass operators sharing qdata, stored in CeedScalar, FP32, and BF16
+  for (CeedInt k=0; k<3; k++) {
+    CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                       &op_mass[k]);
+    CeedOperatorSetField(op_mass[k], "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                         qdata);
+    CeedOperatorSetField(op_mass[k], "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_mass[k], "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetFieldPrecision(op_mass[k], "rho", prec[k]);
+    CeedVectorCreate(ceed, Nu, &V[k]);
+  }
+
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+
+  CeedVectorCreate(ceed, Nu, &U);
+  CeedVectorGetArray(U, CEED_MEM_HOST, &hu);
+  for (CeedInt i=0; i<Nu; i++)
+    hu[i] = 1.0 + sin(3.0*i/(Nu - 1));
+  CeedVectorRestoreArray(U, &hu);
+
+  // Apply twice, rescaling qdata in between to check the stored copy is updated
+  for (CeedInt pass=0; pass<2; pass++) {
+    for (CeedInt k=0; k<3; k++)
+      CeedOperatorApply(op_mass[k], U, V[k], CEED_REQUEST_IMMEDIATE);
+
+    // Check output
+    for (CeedInt k=0; k<3; k++)
+      CeedVectorGetArrayRead(V[k], CEED_MEM_HOST, &hv[k]);
+    for (CeedInt k=1; k<3; k++)
+      for (CeedInt i=0; i<Nu; i++)
+        if (fabs(hv[k][i] - hv[0][i]) > tol[k]*fabs(hv[0][i]))
+          // LCOV_EXCL_START
+          printf("[%d] %s precision: %f != %f\n", i, CeedFieldPrecisions[prec[k]],
+                 hv[k][i], hv[0][i]);
+    // LCOV_EXCL_STOP
+    for (CeedInt k=0; k<3; k++) {
+      sum = 0.;
+      for (CeedInt i=0; i<Nu; i++)
+        sum += hv[k][i];
+      if (pass == 0 && k == 0)
+        sum0 = sum;
+      if (fabs(sum - scale*sum0) > tol[k]*scale*sum0)
+        // LCOV_EXCL_START
+        printf("%s precision: Computed Integral: %f != Expected Integral: %f\n",
+               CeedFieldPrecisions[prec[k]], sum, scale*sum0);
+      // LCOV_EXCL_STOP
+    }
+    for (CeedInt k=0; k<3; k++)
+      CeedVectorRestoreArrayRead(V[k], &hv[k]);
+
+    scale *= 2.0;
+    CeedVectorScale(qdata, 2.0);
+  }
+
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  for (CeedInt k=0; k<3; k++) {
+    CeedOperatorDestroy(&op_mass[k]);
+    CeedVectorDestroy(&V[k]);
+  }
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&qdata);
+  CeedDestroy(&ceed);
+  return 0;
+}
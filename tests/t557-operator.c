@@ -0,0 +1,172 @@
+/// @file
+/// Test memory usage accounting of mass matrix operator
+/// \test Test memory usage accounting of mass matrix operator
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t500-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictu, Erestrictui;
+  CeedBasis bx, bu;
+  CeedQFunction qf_setup, qf_mass;
+  CeedOperator op_setup, op_mass, op_composite;
+  CeedVector qdata, X, U, V;
+  CeedInt nelem = 15, P = 5, Q = 8;
+  CeedInt Nx = nelem+1, Nu = nelem*(P-1)+1;
+  CeedInt indx[nelem*2], indu[nelem*P];
+  CeedScalar x[Nx];
+  size_t start, current, peak, bytes, sum, usage[CEED_MEMORY_TOTAL+1];
+
+  CeedInit(argv[1], &ceed);
+  CeedSetMemoryTracking(true);
+  CeedGetMemoryUsage(&start, NULL);
+
+  for (CeedInt i=0; i<Nx; i++)
+    x[i] = (CeedScalar) i / (Nx - 1);
+  for (CeedInt i=0; i<nelem; i++) {
+    indx[2*i+0] = i;
+    indx[2*i+1] = i+1;
+  }
+  // Restrictions
+  CeedElemRestrictionCreate(ceed, nelem, 2, 1, 1, Nx, CEED_MEM_HOST,
+                            CEED_COPY_VALUES, indx, &Erestrictx);
+
+  for (CeedInt i=0; i<nelem; i++) {
+    for (CeedInt j=0; j<P; j++) {
+      indu[P*i+j] = i*(P-1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, nelem, P, 1, 1, Nu, CEED_MEM_HOST,
+                            CEED_COPY_VALUES, indu, &Erestrictu);
+  CeedInt stridesu[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, Q*nelem, stridesu,
+                                   &Erestrictui);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &bu);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass);
+
+  CeedVectorCreate(ceed, Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, nelem*Q, &qdata);
+
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  CeedOperatorSetField(op_mass, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       qdata);
+  CeedOperatorSetField(op_mass, "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+
+  CeedVectorCreate(ceed, Nu, &U);
+  CeedVectorSetValue(U, 1.0);
+  CeedVectorCreate(ceed, Nu, &V);
+  CeedOperatorApply(op_mass, U, V, CEED_REQUEST_IMMEDIATE);
+
+  // Check usage by category
+  for (CeedInt i=0; i<=CEED_MEMORY_TOTAL; i++)
+    CeedOperatorGetMemoryUsage(op_mass, (CeedMemoryCategory)i, &usage[i]);
+  sum = 0;
+  for (CeedInt i=0; i<CEED_MEMORY_TOTAL; i++)
+    sum += usage[i];
+  if (sum != usage[CEED_MEMORY_TOTAL])
+    // LCOV_EXCL_START
+    printf("Total memory %zu != sum of categories %zu\n",
+           usage[CEED_MEMORY_TOTAL], sum);
+  // LCOV_EXCL_STOP
+  if (usage[CEED_MEMORY_OFFSETS] < nelem*P*sizeof(CeedInt))
+    // LCOV_EXCL_START
+    printf("Offsets memory %zu < %zu\n", usage[CEED_MEMORY_OFFSETS],
+           nelem*P*sizeof(CeedInt));
+  // LCOV_EXCL_STOP
+  CeedBasisGetMemoryUsage(bu, &bytes);
+  if (usage[CEED_MEMORY_BASIS] != bytes)
+    // LCOV_EXCL_START
+    printf("Basis memory %zu != %zu\n", usage[CEED_MEMORY_BASIS], bytes);
+  // LCOV_EXCL_STOP
+  CeedVectorGetMemoryUsage(qdata, &bytes);
+  if (usage[CEED_MEMORY_PASSIVE] != bytes ||
+      bytes != nelem*Q*sizeof(CeedScalar))
+    // LCOV_EXCL_START
+    printf("Passive memory %zu != %zu\n", usage[CEED_MEMORY_PASSIVE],
+           nelem*Q*sizeof(CeedScalar));
+  // LCOV_EXCL_STOP
+  if (usage[CEED_MEMORY_EVEC] + usage[CEED_MEMORY_QVEC] == 0)
+    // LCOV_EXCL_START
+    printf("No work vector memory reported\n");
+  // LCOV_EXCL_STOP
+
+  // Shared objects in a composite operator are counted once
+  CeedCompositeOperatorCreate(ceed, &op_composite);
+  CeedCompositeOperatorAddSub(op_composite, op_mass);
+  CeedCompositeOperatorAddSub(op_composite, op_mass);
+  CeedOperatorGetMemoryUsage(op_composite, CEED_MEMORY_TOTAL, &bytes);
+  if (bytes != usage[CEED_MEMORY_TOTAL])
+    // LCOV_EXCL_START
+    printf("Composite memory %zu != %zu\n", bytes, usage[CEED_MEMORY_TOTAL]);
+  // LCOV_EXCL_STOP
+  FILE *stream = tmpfile();
+  CeedOperatorViewMemoryUsage(op_composite, stream);
+  fclose(stream);
+
+  // Tracked allocations
+  CeedGetMemoryUsage(&current, &peak);
+  if (current < start + usage[CEED_MEMORY_TOTAL] || peak < current)
+    // LCOV_EXCL_START
+    printf("Tracked memory %zu, peak %zu, less than operator memory %zu\n",
+           current - start, peak - start, usage[CEED_MEMORY_TOTAL]);
+  // LCOV_EXCL_STOP
+
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_composite);
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&V);
+  CeedVectorDestroy(&qdata);
+
+  // All tracked allocations are freed
+  CeedGetMemoryUsage(&current, NULL);
+  if (current != start)
+    // LCOV_EXCL_START
+    printf("Tracked memory %zu != %zu after destroying objects\n", current,
+           start);
+  // LCOV_EXCL_STOP
+
+  CeedSetMemoryTracking(false);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,155 @@
+/// @file
+/// Test operator with inputs sharing a vector and restriction
+/// \test Test operator with inputs sharing a vector and restriction
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t559-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictu[3], Erestrictui;
+  CeedBasis bx, bu, bu2;
+  CeedQFunction qf_setup, qf_multi;
+  CeedOperator op_setup, op_multi[2][2];
+  CeedVector qdata, X, U, V[2][2];
+  CeedScalar *hu;
+  const CeedScalar *hv, *hw;
+  CeedInt nelem = 15, P = 5, Q = 8;
+  CeedInt Nx = nelem+1, Nu = nelem*(P-1)+1;
+  CeedInt indx[nelem*2], indu[nelem*P];
+  CeedScalar x[Nx];
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i=0; i<Nx; i++)
+    x[i] = (CeedScalar) i / (Nx - 1);
+  for (CeedInt i=0; i<nelem; i++) {
+    indx[2*i+0] = i;
+    indx[2*i+1] = i+1;
+  }
+  // Restrictions
+  CeedElemRestrictionCreate(ceed, nelem, 2, 1, 1, Nx, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictx);
+
+  for (CeedInt i=0; i<nelem; i++) {
+    for (CeedInt j=0; j<P; j++) {
+      indu[P*i+j] = i*(P-1) + j;
+    }
+  }
+  for (CeedInt k=0; k<3; k++)
+    CeedElemRestrictionCreate(ceed, nelem, P, 1, 1, Nu, CEED_MEM_HOST,
+                              CEED_USE_POINTER, indu, &Erestrictu[k]);
+  CeedInt stridesu[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, Q*nelem, stridesu,
+                                   &Erestrictui);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &bu);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &bu2);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, multi, multi_loc, &qf_multi);
+  CeedQFunctionAddInput(qf_multi, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_multi, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddInput(qf_multi, "du", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddInput(qf_multi, "w", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_multi, "v", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_multi, "dv", 1, CEED_EVAL_GRAD);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_setup);
+
+  CeedVectorCreate(ceed, Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, nelem*Q, &qdata);
+  CeedVectorCreate(ceed, Nu, &U);
+  CeedVectorGetArray(U, CEED_MEM_HOST, &hu);
+  for (CeedInt i=0; i<Nu; i++)
+    hu[i] = 1.0 + sin(3.0*i/(Nu - 1));
+  CeedVectorRestoreArray(U, &hu);
+
+  CeedOperatorSetField(op_setup, "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                       CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                       CEED_VECTOR_ACTIVE);
+
+  // Inputs u, du, and w use one restriction in op_multi[0][*] and distinct
+  //   restrictions with the same offsets in op_multi[1][*], with active
+  //   fields in op_multi[*][0] and passive fields in op_multi[*][1]
+  for (CeedInt k=0; k<2; k++) {
+    for (CeedInt p=0; p<2; p++) {
+      CeedVectorCreate(ceed, Nu, &V[k][p]);
+      CeedVector in = p ? U : CEED_VECTOR_ACTIVE;
+      CeedVector out = p ? V[k][p] : CEED_VECTOR_ACTIVE;
+      CeedOperatorCreate(ceed, qf_multi, CEED_QFUNCTION_NONE,
+                         CEED_QFUNCTION_NONE, &op_multi[k][p]);
+      CeedOperatorSetField(op_multi[k][p], "rho", Erestrictui,
+                           CEED_BASIS_COLLOCATED, qdata);
+      CeedOperatorSetField(op_multi[k][p], "u", Erestrictu[0], bu, in);
+      CeedOperatorSetField(op_multi[k][p], "du", Erestrictu[k], bu2, in);
+      CeedOperatorSetField(op_multi[k][p], "w", Erestrictu[2*k], bu, in);
+      CeedOperatorSetField(op_multi[k][p], "v", Erestrictu[0], bu, out);
+      CeedOperatorSetField(op_multi[k][p], "dv", Erestrictu[0], bu, out);
+    }
+  }
+
+  CeedOperatorApply(op_setup, X, qdata, CEED_REQUEST_IMMEDIATE);
+
+  // Apply twice, to reuse restricted passive inputs
+  for (CeedInt pass=0; pass<2; pass++) {
+    for (CeedInt k=0; k<2; k++) {
+      CeedOperatorApply(op_multi[k][0], U, V[k][0], CEED_REQUEST_IMMEDIATE);
+      CeedVectorSetValue(V[k][1], 0.0);
+      CeedOperatorApply(op_multi[k][1], CEED_VECTOR_NONE, CEED_VECTOR_NONE,
+                        CEED_REQUEST_IMMEDIATE);
+    }
+
+    // Check output
+    CeedVectorGetArrayRead(V[1][0], CEED_MEM_HOST, &hw);
+    for (CeedInt k=0; k<2; k++) {
+      for (CeedInt p=0; p<2; p++) {
+        CeedVectorGetArrayRead(V[k][p], CEED_MEM_HOST, &hv);
+        for (CeedInt i=0; i<Nu; i++)
+          if (fabs(hv[i] - hw[i]) > 1e-13)
+            // LCOV_EXCL_START
+            printf("[%d] %s %s inputs: %f != %f\n", i, k ? "Distinct" : "Shared",
+                   p ? "passive" : "active", hv[i], hw[i]);
+        // LCOV_EXCL_STOP
+        CeedVectorRestoreArrayRead(V[k][p], &hv);
+      }
+    }
+    CeedVectorRestoreArrayRead(V[1][0], &hw);
+  }
+
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_multi);
+  CeedOperatorDestroy(&op_setup);
+  for (CeedInt k=0; k<2; k++) {
+    for (CeedInt p=0; p<2; p++) {
+      CeedOperatorDestroy(&op_multi[k][p]);
+      CeedVectorDestroy(&V[k][p]);
+    }
+  }
+  for (CeedInt k=0; k<3; k++)
+    CeedElemRestrictionDestroy(&Erestrictu[k]);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bu2);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&U);
+  CeedVectorDestroy(&qdata);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,149 @@
+/// @file
+/// Test operator applied in batches of elements
+/// \test Test operator applied in batches of elements
+#include <ceed.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "t559-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictx, Erestrictu, Erestrictui;
+  CeedBasis bx, bu;
+  CeedQFunction qf_setup, qf_multi;
+  CeedOperator op_setup[3], op_multi[3];
+  CeedVector qdata[3], X, U, V[3], D[3];
+  CeedScalar *hu;
+  const CeedScalar *hv, *hw;
+  CeedInt nelem = 15, P = 5, Q = 8;
+  CeedInt Nx = nelem+1, Nu = nelem*(P-1)+1;
+  CeedInt indx[nelem*2], indu[nelem*P];
+  CeedScalar x[Nx];
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i=0; i<Nx; i++)
+    x[i] = (CeedScalar) i / (Nx - 1);
+  for (CeedInt i=0; i<nelem; i++) {
+    indx[2*i+0] = i;
+    indx[2*i+1] = i+1;
+  }
+  // Restrictions
+  CeedElemRestrictionCreate(ceed, nelem, 2, 1, 1, Nx, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indx, &Erestrictx);
+
+  for (CeedInt i=0; i<nelem; i++) {
+    for (CeedInt j=0; j<P; j++) {
+      indu[P*i+j] = i*(P-1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, nelem, P, 1, 1, Nu, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indu, &Erestrictu);
+  CeedInt stridesu[3] = {1, Q, Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q, 1, Q*nelem, stridesu,
+                                   &Erestrictui);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, Q, CEED_GAUSS, &bx);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, P, Q, CEED_GAUSS, &bu);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "_weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, multi, multi_loc, &qf_multi);
+  CeedQFunctionAddInput(qf_multi, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_multi, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddInput(qf_multi, "du", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddInput(qf_multi, "w", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_multi, "v", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_multi, "dv", 1, CEED_EVAL_GRAD);
+
+  CeedVectorCreate(ceed, Nx, &X);
+  CeedVectorSetArray(X, CEED_MEM_HOST, CEED_USE_POINTER, x);
+  CeedVectorCreate(ceed, Nu, &U);
+  CeedVectorGetArray(U, CEED_MEM_HOST, &hu);
+  for (CeedInt i=0; i<Nu; i++)
+    hu[i] = 1.0 + sin(3.0*i/(Nu - 1));
+  CeedVectorRestoreArray(U, &hu);
+
+  // Operators applied one element at a time, in batches that do not divide
+  //   the number of elements, and in batches of one element
+  for (CeedInt b=0; b<3; b++) {
+    CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                       &op_setup[b]);
+    CeedOperatorSetField(op_setup[b], "_weight", CEED_ELEMRESTRICTION_NONE, bx,
+                         CEED_VECTOR_NONE);
+    CeedOperatorSetField(op_setup[b], "dx", Erestrictx, bx, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_setup[b], "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                         CEED_VECTOR_ACTIVE);
+
+    CeedVectorCreate(ceed, nelem*Q, &qdata[b]);
+    CeedOperatorCreate(ceed, qf_multi, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                       &op_multi[b]);
+    CeedOperatorSetField(op_multi[b], "rho", Erestrictui, CEED_BASIS_COLLOCATED,
+                         qdata[b]);
+    CeedOperatorSetField(op_multi[b], "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_multi[b], "du", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_multi[b], "w", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_multi[b], "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(op_multi[b], "dv", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+
+    if (b) {
+      CeedOperatorSetBatchSize(op_setup[b], b == 1 ? 4 : 1);
+      CeedOperatorSetBatchSize(op_multi[b], b == 1 ? 4 : 1);
+    }
+
+    CeedOperatorApply(op_setup[b], X, qdata[b], CEED_REQUEST_IMMEDIATE);
+    CeedVectorCreate(ceed, Nu, &V[b]);
+    CeedOperatorApply(op_multi[b], U, V[b], CEED_REQUEST_IMMEDIATE);
+    CeedVectorCreate(ceed, Nu, &D[b]);
+    CeedOperatorLinearAssembleDiagonal(op_multi[b], D[b],
+                                       CEED_REQUEST_IMMEDIATE);
+  }
+
+  // Check output
+  for (CeedInt b=1; b<3; b++) {
+    CeedVectorGetArrayRead(V[0], CEED_MEM_HOST, &hw);
+    CeedVectorGetArrayRead(V[b], CEED_MEM_HOST, &hv);
+    for (CeedInt i=0; i<Nu; i++)
+      if (fabs(hv[i] - hw[i]) > 1e-13)
+        // LCOV_EXCL_START
+        printf("[%d] Batch %d apply: %f != %f\n", i, b, hv[i], hw[i]);
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArrayRead(V[b], &hv);
+    CeedVectorRestoreArrayRead(V[0], &hw);
+
+    CeedVectorGetArrayRead(D[0], CEED_MEM_HOST, &hw);
+    CeedVectorGetArrayRead(D[b], CEED_MEM_HOST, &hv);
+    for (CeedInt i=0; i<Nu; i++)
+      if (fabs(hv[i] - hw[i]) > 1e-13)
+        // LCOV_EXCL_START
+        printf("[%d] Batch %d diagonal: %f != %f\n", i, b, hv[i], hw[i]);
+    // LCOV_EXCL_STOP
+    CeedVectorRestoreArrayRead(D[b], &hv);
+    CeedVectorRestoreArrayRead(D[0], &hw);
+  }
+
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_multi);
+  for (CeedInt b=0; b<3; b++) {
+    CeedOperatorDestroy(&op_setup[b]);
+    CeedOperatorDestroy(&op_multi[b]);
+    CeedVectorDestroy(&qdata[b]);
+    CeedVectorDestroy(&V[b]);
+    CeedVectorDestroy(&D[b]);
+  }
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictx);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bu);
+  CeedBasisDestroy(&bx);
+  CeedVectorDestroy(&X);
+  CeedVectorDestroy(&U);
+  CeedDestroy(&ceed);
+  return 0;
+}
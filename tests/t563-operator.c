@@ -0,0 +1,88 @@
+/// @file
+/// Test flops and bytes estimates of mass matrix operator
+/// \test Test flops and bytes estimates of mass matrix operator
+#include <ceed.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+  CeedElemRestriction Erestrictu, Erestrictui;
+  CeedBasis bu;
+  CeedQFunction qf_mass;
+  CeedOperator op_mass, op_composite;
+  CeedVector qdata;
+  CeedInt nelemx = 2, nelem = nelemx*nelemx, P = 3, Q = 4;
+  CeedInt Nx = nelemx*(P-1)+1, indu[nelem*P*P];
+  size_t flops, bytes;
+
+  CeedInit(argv[1], &ceed);
+
+  // Restrictions
+  for (CeedInt e=0; e<nelem; e++)
+    for (CeedInt i=0; i<P; i++)
+      for (CeedInt j=0; j<P; j++)
+        indu[(e*P + i)*P + j] = ((e/nelemx)*(P-1) + i)*Nx +
+                                (e%nelemx)*(P-1) + j;
+  CeedElemRestrictionCreate(ceed, nelem, P*P, 1, 1, Nx*Nx, CEED_MEM_HOST,
+                            CEED_USE_POINTER, indu, &Erestrictu);
+  CeedInt stridesu[3] = {1, Q*Q, Q*Q};
+  CeedElemRestrictionCreateStrided(ceed, nelem, Q*Q, 1, Q*Q*nelem, stridesu,
+                                   &Erestrictui);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 2, 1, P, Q, CEED_GAUSS, &bu);
+
+  // QFunction
+  CeedQFunctionCreateInteriorByName(ceed, "MassApply", &qf_mass);
+  CeedQFunctionSetUserFlopsEstimate(qf_mass, 3);
+
+  // Operators
+  CeedVectorCreate(ceed, nelem*Q*Q, &qdata);
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE,
+                     &op_mass);
+  CeedOperatorSetField(op_mass, "u", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "qdata", Erestrictui, CEED_BASIS_COLLOCATED,
+                       qdata);
+  CeedOperatorSetField(op_mass, "v", Erestrictu, bu, CEED_VECTOR_ACTIVE);
+  CeedCompositeOperatorCreate(ceed, &op_composite);
+  CeedCompositeOperatorAddSub(op_composite, op_mass);
+  CeedCompositeOperatorAddSub(op_composite, op_mass);
+
+  // Per element, the interpolation and its transpose take 2 (Q P^2 + Q^2 P)
+  //   flops, the transpose restriction P^2, and the QFunction 3 Q^2; values
+  //   of u, qdata, and v are read and written at the quadrature points, the
+  //   restrictions read Q^2 + P^2 values, read and write P^2 values, and
+  //   read 2 P^2 offsets
+  const size_t expflops = nelem*(2*2*(Q*P*P + Q*Q*P) + P*P + 3*Q*Q),
+               expbytes = nelem*((3*Q*Q + Q*Q + 3*P*P)*sizeof(CeedScalar) +
+                                 2*P*P*sizeof(CeedInt));
+  CeedOperatorGetFlopsEstimate(op_mass, &flops);
+  CeedOperatorGetBytesEstimate(op_mass, &bytes);
+  if (flops != expflops)
+    // LCOV_EXCL_START
+    printf("Estimated flops %zu != %zu\n", flops, expflops);
+  // LCOV_EXCL_STOP
+  if (bytes != expbytes)
+    // LCOV_EXCL_START
+    printf("Estimated bytes %zu != %zu\n", bytes, expbytes);
+  // LCOV_EXCL_STOP
+
+  // Composite operators sum the estimates of sub-operators
+  CeedOperatorGetFlopsEstimate(op_composite, &flops);
+  CeedOperatorGetBytesEstimate(op_composite, &bytes);
+  if (flops != 2*expflops || bytes != 2*expbytes)
+    // LCOV_EXCL_START
+    printf("Composite estimates %zu flops, %zu bytes != %zu flops, %zu bytes\n",
+           flops, bytes, 2*expflops, 2*expbytes);
+  // LCOV_EXCL_STOP
+
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_composite);
+  CeedElemRestrictionDestroy(&Erestrictu);
+  CeedElemRestrictionDestroy(&Erestrictui);
+  CeedBasisDestroy(&bu);
+  CeedVectorDestroy(&qdata);
+  CeedDestroy(&ceed);
+  return 0;
+}
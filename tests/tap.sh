@@ -51,7 +51,7 @@ fi
 
 printf "1..$[3*${#backends[@]}*${#allargs[@]}]\n";
 
-tmpfiles="${output} ${output}.out ${output}.diff ${output}.err SESSION.NAME"
+tmpfiles="${output} ${output}.out ${output}.diff ${output}.err ${output}.perf SESSION.NAME"
 trap 'rm -f ${tmpfiles}' EXIT
 
 # test configurations loop
@@ -88,6 +88,12 @@ for ((i=0;i<${#backends[@]};++i)); do
     (build/$1 ${args/\{ceed_resource\}/$backend} || false) > ${output}.out 2> ${output}.err
     status=$?
 
+    # Performance diagnostics of perfcheck backends are reported on stderr
+    if [[ "$backend" = *perfcheck* ]]; then
+        sed '/^perfcheck: /d' ${output}.err > ${output}.perf
+        mv ${output}.perf ${output}.err
+    fi
+
     # grep to skip test if backend chooses to whitelist test
     if grep -F -q -e 'Backend does not implement' \
             ${output}.err ; then